@@ -10,7 +10,9 @@
 #include "4C_global_data.hpp"
 #include "4C_global_full_init_control.hpp"
 #include "4C_global_full_inp_control.hpp"
+#include "4C_io_control.hpp"
 #include "4C_io_pstream.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <chrono>
 
@@ -60,9 +62,22 @@ void ntam(int argc, char* argv[])
   }
 
   /*--------------------------------------------------calculation phase */
+  const Teuchos::ParameterList& profilingparams =
+      Global::Problem::instance()->io_params().sublist("PROFILING");
+  if (profilingparams.get<bool>("TRACE"))
+  {
+    Core::Utils::Profiling::enable(Global::Problem::instance()->get_communicators()->local_comm(),
+        Global::Problem::instance()->output_control_file()->file_name(),
+        profilingparams.get<int>("MAX_DEPTH"));
+  }
+
   t0 = walltime_in_seconds();
 
-  ntacal();
+  {
+    FOUR_C_PROFILE_REGION("calculation");
+    ntacal();
+  }
+  Core::Utils::Profiling::finalize();
 
   tc = walltime_in_seconds() - t0;
   if (Core::Communication::my_mpi_rank(gcomm) == 0)
@@ -473,37 +473,50 @@ function(four_c_test)
 endfunction()
 
 ###------------------------------------------------------------------ Nested Parallelism
-# Usage in tests/lists_of_tests.cmake: "four_c_test_nested_parallelism(<name_of_input_file_1> <name_of_input_file_2> <restart_step>)"
+# Usage in tests/lists_of_tests.cmake: "four_c_test_nested_parallelism(<name_of_input_file_1> <name_of_input_file_2> <restart_step> [<group_layout>])"
 # <name_of_input_file_1>: must equal the name of an input file in directory tests/input_files for the first test; This test will be executed using 1 process.
 # <name_of_input_file_2>: must equal the name of an input file in directory tests/input_files for the second test; This test will be executed using 2 processes.
 # <restart_step>: number of restart step; <""> indicates no restart
+# <group_layout>: optional number of processes of the two groups, e.g. "2,3" (default: "1,2"); The name of the test gets the suffix -<macro>x<support>.
 function(four_c_test_nested_parallelism name_of_input_file_1 name_of_input_file_2 restart_step)
-  set(test_directory ${PROJECT_BINARY_DIR}/framework_test_output/${name_of_input_file_1})
+  set(glayout "1,2")
+  set(name_of_test ${name_of_input_file_1}-nestedPar)
+  if(ARGC GREATER 3)
+    set(glayout ${ARGV3})
+    string(REPLACE "," "x" layout_suffix ${glayout})
+    set(name_of_test ${name_of_test}-${layout_suffix})
+  endif()
+
+  string(REPLACE "," ";" group_sizes ${glayout})
+  set(num_proc 0)
+  foreach(group_size ${group_sizes})
+    math(EXPR num_proc "${num_proc} + ${group_size}")
+  endforeach()
+
+  set(test_directory ${PROJECT_BINARY_DIR}/framework_test_output/${name_of_test})
 
   add_test(
-    NAME ${name_of_input_file_1}-nestedPar
+    NAME ${name_of_test}
     COMMAND
       bash -c
-      "mkdir -p ${test_directory} &&  ${MPIEXEC_EXECUTABLE} ${MPIEXEC_EXTRA_OPTS_FOR_TESTING} -np 3 $<TARGET_FILE:${FOUR_C_EXECUTABLE_NAME}> -ngroup=2 -glayout=1,2 -nptype=separateDatFiles ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_1} ${test_directory}/xxx ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_2} ${test_directory}/xxxAdditional"
+      "mkdir -p ${test_directory} &&  ${MPIEXEC_EXECUTABLE} ${MPIEXEC_EXTRA_OPTS_FOR_TESTING} -np ${num_proc} $<TARGET_FILE:${FOUR_C_EXECUTABLE_NAME}> -ngroup=2 -glayout=${glayout} -nptype=separateDatFiles ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_1} ${test_directory}/xxx ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_2} ${test_directory}/xxxAdditional"
     )
 
-  require_fixture(${name_of_input_file_1}-nestedPar test_cleanup)
-  set_processors(${name_of_input_file_1}-nestedPar 3)
-  define_setup_fixture(${name_of_input_file_1}-nestedPar ${name_of_input_file_1}-nestedPar-p3)
-  set_timeout(${name_of_input_file_1}-nestedPar)
+  require_fixture(${name_of_test} test_cleanup)
+  set_processors(${name_of_test} ${num_proc})
+  define_setup_fixture(${name_of_test} ${name_of_test}-p${num_proc})
+  set_timeout(${name_of_test})
 
   if(${restart_step})
     add_test(
-      NAME ${name_of_input_file_1}-nestedPar-restart
+      NAME ${name_of_test}-restart
       COMMAND
         bash -c
-        "${MPIEXEC_EXECUTABLE} ${MPIEXEC_EXTRA_OPTS_FOR_TESTING} -np 3 $<TARGET_FILE:${FOUR_C_EXECUTABLE_NAME}> -ngroup=2 -glayout=1,2 -nptype=separateDatFiles ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_1} ${test_directory}/xxx restart=${restart_step} ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_2} ${test_directory}/xxxAdditional restart=${restart_step}"
+        "${MPIEXEC_EXECUTABLE} ${MPIEXEC_EXTRA_OPTS_FOR_TESTING} -np ${num_proc} $<TARGET_FILE:${FOUR_C_EXECUTABLE_NAME}> -ngroup=2 -glayout=${glayout} -nptype=separateDatFiles ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_1} ${test_directory}/xxx restart=${restart_step} ${PROJECT_SOURCE_DIR}/tests/input_files/${name_of_input_file_2} ${test_directory}/xxxAdditional restart=${restart_step}"
       )
 
-    require_fixture(
-      ${name_of_input_file_1}-nestedPar-restart "${name_of_input_file_1}-nestedPar-p3;test_cleanup"
-      )
-    set_processors(${name_of_input_file_1}-nestedPar-restart 3)
+    require_fixture(${name_of_test}-restart "${name_of_test}-p${num_proc};test_cleanup")
+    set_processors(${name_of_test}-restart ${num_proc})
   endif()
 endfunction()
 
@@ -671,6 +684,52 @@ function(
   set_run_serial(${name_of_test})
 endfunction()
 
+###------------------------------------------------------------------ Postprocessing Test with distributed result steps
+# Run vtu postprocessor on previous test serially and with the result steps distributed over the
+# processors, the produced files have to be identical
+# CAUTION: This tests bases on results of a previous simulation/test
+# Usage in tests/lists_of_tests.cmake: "four_c_test_post_processing_parallel_steps(<name_of_input_file> <num_proc> <num_proc_base_run> <fields>)"
+# <name_of_input_file>: must equal the name of an input file from a previous tests
+# <num_proc>: number of processors the result steps are distributed over
+# <num_proc_base_run>: number of processors of precursor base run
+# <fields>: comma separated list of results to be written
+function(
+  four_c_test_post_processing_parallel_steps
+  name_of_input_file
+  num_proc
+  num_proc_base_run
+  fields
+  )
+  set(test_directory
+      ${PROJECT_BINARY_DIR}/framework_test_output/${name_of_input_file}-p${num_proc_base_run}
+      )
+
+  set(name_of_test "${name_of_input_file}-p${num_proc}-pp-parallelsteps")
+  # serial and step parallel runs write into different directories but with the same file names
+  set(RUNPOSTFILTER_SER
+      ${FOUR_C_ENABLE_ADDRESS_SANITIZER_TEST_OPTIONS}\ ./post_ensight\ --file=${test_directory}/xxx\ --output=${test_directory}/steps_SER/xxx\ --filter=vtu\ --fields=${fields}
+      )
+  set(RUNPOSTFILTER_PAR
+      ${MPIEXEC_EXECUTABLE}\ ${MPIEXEC_EXTRA_OPTS_FOR_TESTING}\ -np\ ${num_proc}\ ./post_ensight\ --file=${test_directory}/xxx\ --output=${test_directory}/steps_PAR/xxx\ --filter=vtu\ --fields=${fields}\ --parallelsteps=yes
+      )
+
+  # specify test case
+  add_test(
+    NAME "${name_of_test}"
+    COMMAND
+      sh -c
+      "mkdir -p ${test_directory}/steps_SER ${test_directory}/steps_PAR && ${RUNPOSTFILTER_SER} && ${RUNPOSTFILTER_PAR} && diff -r ${test_directory}/steps_SER ${test_directory}/steps_PAR"
+    )
+
+  require_fixture("${name_of_test}" "${name_of_input_file}-p${num_proc_base_run};test_cleanup")
+  set_environment(${name_of_test})
+  set_processors(${name_of_test} ${num_proc})
+  set_timeout(${name_of_test})
+
+  # Set "RUN_SERIAL TRUE" because result files can only be read by one process.
+  set_run_serial(${name_of_test})
+endfunction()
+
 ###------------------------------------------------------------------ Compare VTK
 # Compare XML formatted .vtk result data set referenced by .pvd files to corresponding reference files
 # CAUTION: This tests bases on results of a previous simulation/test
@@ -678,8 +678,7 @@ void Adapter::FluidBaseAlgorithm::setup_fluid(const Teuchos::ParameterList& prbd
                  coupling == fsi_iter_stagg_CHEB_rel_param or
                  coupling == fsi_iter_stagg_AITKEN_rel_force or
                  coupling == fsi_iter_stagg_steep_desc_force or
-                 coupling == fsi_iter_stagg_steep_desc_force or
-                 coupling == fsi_iter_stagg_steep_desc_force)
+                 coupling == fsi_iter_stagg_IQN_ILS)
         {
           condition_name = "XFEMSurfFSIPart";
         }
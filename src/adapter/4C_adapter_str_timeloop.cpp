@@ -9,6 +9,7 @@
 
 #include "4C_global_data.hpp"
 #include "4C_inpar_structure.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
@@ -27,6 +28,8 @@ int Adapter::StructureTimeLoop::integrate()
   while (not_finished() and (convergencestatus == Inpar::Solid::conv_success or
                                 convergencestatus == Inpar::Solid::conv_fail_repeat))
   {
+    Core::Utils::Profiling::begin_step(step());
+
     // call the predictor
     pre_predict();
     prepare_time_step();
@@ -59,6 +62,8 @@ int Adapter::StructureTimeLoop::integrate()
 
       // print info about finished time step
       print_step();
+
+      Core::Utils::Profiling::end_step();
     }
     // todo: remove this as soon as old structure time integration is gone
     else if (Teuchos::getIntegralValue<Inpar::Solid::IntegrationStrategy>(
@@ -25,6 +25,8 @@
 
 #include <Sacado.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -218,17 +220,16 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
   int numgp_persegment = gausspoints.nquad;
   int numgp_perelement = num_integration_segments * numgp_persegment;
 
-  // vectors for shape functions
-  // Attention: these are individual shape function values, NOT shape function matrices
-  std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N1_i(numgp_persegment);
-  std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N2_i(numgp_persegment);
-
-  // Evaluate shape functions at gauss points and store values
-  // Todo think about pre-computing and storing values for inner Gauss point loops here
+  // evaluate shape functions, centerline positions and jacobi factors at all Gauss points of
+  // both elements once and store them for the nested Gauss point loops below
+  GaussPointDataAllSegments gp_data1;
+  GaussPointDataAllSegments gp_data2;
+  evaluate_gauss_point_data_all_segments(
+      *beam_element1(), ele1length_, ele1pos_, gausspoints, num_integration_segments, gp_data1);
+  evaluate_gauss_point_data_all_segments(
+      *beam_element2(), ele2length_, ele2pos_, gausspoints, num_integration_segments, gp_data2);
 
-  // coords of the two gauss points
-  Core::LinAlg::Matrix<3, 1, T> r1(true);    // = r1
-  Core::LinAlg::Matrix<3, 1, T> r2(true);    // = r2
+  // distance vector of the two gauss points
   Core::LinAlg::Matrix<3, 1, T> dist(true);  // = r1-r2
   T norm_dist = 0.0;                         // = |r1-r2|
 
@@ -280,6 +281,15 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
   moments_pot_gp_1_.resize(numgp_perelement, Core::LinAlg::Matrix<3, 1, double>(true));
   moments_pot_gp_2_.resize(numgp_perelement, Core::LinAlg::Matrix<3, 1, double>(true));
 
+  // store for visualization
+  for (int igp_total = 0; igp_total < numgp_perelement; ++igp_total)
+  {
+    centerline_coords_gp_1_[igp_total] =
+        Core::FADUtils::cast_to_double<T, 3, 1>(gp_data1.r[igp_total]);
+    centerline_coords_gp_2_[igp_total] =
+        Core::FADUtils::cast_to_double<T, 3, 1>(gp_data2.r[igp_total]);
+  }
+
   for (unsigned int isegment1 = 0; isegment1 < num_integration_segments; ++isegment1)
   {
     // compute element parameter coordinate for lower and upper limit of current integration segment
@@ -290,10 +300,6 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     double jacobifactor_segment1 =
         0.5 * (integration_segment1_upper_limit - integration_segment1_lower_limit);
 
-    Discret::Utils::Beam::evaluate_shape_functions_all_gps<numnodes, numnodalvalues>(gausspoints,
-        N1_i, beam_element1()->shape(), ele1length_, integration_segment1_lower_limit,
-        integration_segment1_upper_limit);
-
     for (unsigned int isegment2 = 0; isegment2 < num_integration_segments; ++isegment2)
     {
       // compute element parameter coordinate for lower and upper limit of current integration
@@ -305,9 +311,12 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
       double jacobifactor_segment2 =
           0.5 * (integration_segment2_upper_limit - integration_segment2_lower_limit);
 
-      Discret::Utils::Beam::evaluate_shape_functions_all_gps<numnodes, numnodalvalues>(gausspoints,
-          N2_i, beam_element2()->shape(), ele2length_, integration_segment2_lower_limit,
-          integration_segment2_upper_limit);
+      // check cutoff criterion on segment level: skip all Gauss point pairs of this segment pair
+      // if the bounding spheres of the segments' Gauss points are separated by more than cutoff
+      if (cutoff_radius != -1.0 and
+          are_segments_more_separated_than_cutoff_distance(
+              gp_data1, isegment1, gp_data2, isegment2))
+        continue;
 
 
       // loop over Gauss points in current segment on ele1
@@ -315,41 +324,20 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
       {
         int igp1_total = isegment1 * numgp_persegment + igp1;
 
-        // Get location of GP in element parameter space xi \in [-1;1]
-        const double xi_GP1_tilde = gausspoints.qxg[igp1][0];
-
-        /* do a mapping into integration segment, i.e. coordinate transformation
-         * note: this has no effect if integration interval is [-1;1] */
-        const double xi_GP1 = 0.5 * ((1.0 - xi_GP1_tilde) * integration_segment1_lower_limit +
-                                        (1.0 + xi_GP1_tilde) * integration_segment1_upper_limit);
-
-        compute_centerline_position(r1, N1_i[igp1], ele1pos_);
-
-        // store for visualization
-        centerline_coords_gp_1_[igp1_total] = Core::FADUtils::cast_to_double<T, 3, 1>(r1);
-
-        double jacobifac1 = beam_element1()->get_jacobi_fac_at_xi(xi_GP1);
+        const Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>& N1_i_GP1 =
+            gp_data1.N_i[igp1_total];
+        const Core::LinAlg::Matrix<3, 1, T>& r1 = gp_data1.r[igp1_total];
+        const double jacobifac1 = gp_data1.jacobifac[igp1_total];
 
         // loop over Gauss points in current segment on ele2
         for (int igp2 = 0; igp2 < numgp_persegment; ++igp2)
         {
           int igp2_total = isegment2 * numgp_persegment + igp2;
 
-          // Get location of GP in element parameter space xi \in [-1;1]
-          const double xi_GP2_tilde = gausspoints.qxg[igp2][0];
-
-          /* do a mapping into integration segment, i.e. coordinate transformation
-           * note: this has no effect if integration interval is [-1;1] */
-          const double xi_GP2 = 0.5 * ((1.0 - xi_GP2_tilde) * integration_segment2_lower_limit +
-                                          (1.0 + xi_GP2_tilde) * integration_segment2_upper_limit);
-
-          // compute coord vector
-          compute_centerline_position(r2, N2_i[igp2], ele2pos_);
-
-          // store for visualization
-          centerline_coords_gp_2_[igp2_total] = Core::FADUtils::cast_to_double<T, 3, 1>(r2);
-
-          double jacobifac2 = beam_element2()->get_jacobi_fac_at_xi(xi_GP2);
+          const Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>& N2_i_GP2 =
+              gp_data2.N_i[igp2_total];
+          const Core::LinAlg::Matrix<3, 1, T>& r2 = gp_data2.r[igp2_total];
+          const double jacobifac2 = gp_data2.jacobifac[igp2_total];
 
           dist = Core::FADUtils::diff_vector(r1, r2);
 
@@ -389,7 +377,7 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
             // loop over dimensions
             for (unsigned int j = 0; j < 3; ++j)
             {
-              force_pot1(3 * i + j) -= N1_i[igp1](i) * fpot_tmp(j);
+              force_pot1(3 * i + j) -= N1_i_GP1(i) * fpot_tmp(j);
             }
           }
 
@@ -402,7 +390,7 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
             // loop over dimensions
             for (unsigned int j = 0; j < 3; ++j)
             {
-              force_pot2(3 * i + j) += N2_i[igp2](i) * fpot_tmp(j);
+              force_pot2(3 * i + j) += N2_i_GP2(i) * fpot_tmp(j);
             }
           }
 
@@ -411,7 +399,7 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
               stiffmat22 != nullptr)
           {
             evaluate_stiffpot_analytic_contributions_large_sep_approx(dist, norm_dist,
-                norm_dist_exp1, q1q2_JacFac_GaussWeights, N1_i[igp1], N2_i[igp2], *stiffmat11,
+                norm_dist_exp1, q1q2_JacFac_GaussWeights, N1_i_GP1, N2_i_GP2, *stiffmat11,
                 *stiffmat12, *stiffmat21, *stiffmat22);
           }
 
@@ -597,17 +585,16 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
   int numgp_persegment = gausspoints.nquad;
   int numgp_perelement = num_integration_segments * numgp_persegment;
 
-  // vectors for shape function values
-  // Attention: these are individual shape function values, NOT shape function matrices
-  std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N1_i(numgp_persegment);
-  std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N2_i(numgp_persegment);
+  // evaluate shape functions, centerline positions and jacobi factors at all Gauss points of
+  // both elements once and store them for the nested Gauss point loops below
+  GaussPointDataAllSegments gp_data1;
+  GaussPointDataAllSegments gp_data2;
+  evaluate_gauss_point_data_all_segments(
+      *beam_element1(), ele1length_, ele1pos_, gausspoints, num_integration_segments, gp_data1);
+  evaluate_gauss_point_data_all_segments(
+      *beam_element2(), ele2length_, ele2pos_, gausspoints, num_integration_segments, gp_data2);
 
-  // Evaluate shape functions at gauss points and store values
-  // Todo think about pre-computing and storing values for inner Gauss point loops here
-
-  // coords of the two gauss points
-  Core::LinAlg::Matrix<3, 1, T> r1(true);    // = r1
-  Core::LinAlg::Matrix<3, 1, T> r2(true);    // = r2
+  // distance vector of the two gauss points
   Core::LinAlg::Matrix<3, 1, T> dist(true);  // = r1-r2
   T norm_dist = 0.0;                         // = |r1-r2|
   T gap = 0.0;                               // = |r1-r2|-R1-R2
@@ -687,6 +674,15 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
   moments_pot_gp_1_.resize(numgp_perelement, Core::LinAlg::Matrix<3, 1, double>(true));
   moments_pot_gp_2_.resize(numgp_perelement, Core::LinAlg::Matrix<3, 1, double>(true));
 
+  // store for visualization
+  for (int igp_total = 0; igp_total < numgp_perelement; ++igp_total)
+  {
+    centerline_coords_gp_1_[igp_total] =
+        Core::FADUtils::cast_to_double<T, 3, 1>(gp_data1.r[igp_total]);
+    centerline_coords_gp_2_[igp_total] =
+        Core::FADUtils::cast_to_double<T, 3, 1>(gp_data2.r[igp_total]);
+  }
+
   // auxiliary variables
   Core::LinAlg::Matrix<3, 1, T> fpot_tmp(true);
 
@@ -703,10 +699,6 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
     double jacobifactor_segment1 =
         0.5 * (integration_segment1_upper_limit - integration_segment1_lower_limit);
 
-    Discret::Utils::Beam::evaluate_shape_functions_all_gps<numnodes, numnodalvalues>(gausspoints,
-        N1_i, beam_element1()->shape(), ele1length_, integration_segment1_lower_limit,
-        integration_segment1_upper_limit);
-
     for (unsigned int isegment2 = 0; isegment2 < num_integration_segments; ++isegment2)
     {
       // compute element parameter coordinate for lower and upper limit of current integration
@@ -718,51 +710,32 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
       double jacobifactor_segment2 =
           0.5 * (integration_segment2_upper_limit - integration_segment2_lower_limit);
 
-      Discret::Utils::Beam::evaluate_shape_functions_all_gps<numnodes, numnodalvalues>(gausspoints,
-          N2_i, beam_element2()->shape(), ele2length_, integration_segment2_lower_limit,
-          integration_segment2_upper_limit);
+      // check cutoff criterion on segment level: skip all Gauss point pairs of this segment pair
+      // if the bounding spheres of the segments' Gauss points are separated by more than cutoff
+      if (cutoff_radius != -1.0 and
+          are_segments_more_separated_than_cutoff_distance(
+              gp_data1, isegment1, gp_data2, isegment2))
+        continue;
 
       // loop over gauss points of current segment on element 1
       for (int igp1 = 0; igp1 < numgp_persegment; ++igp1)
       {
         int igp1_total = isegment1 * numgp_persegment + igp1;
 
-        // Get location of GP in element parameter space xi \in [-1;1]
-        const double xi_GP1_tilde = gausspoints.qxg[igp1][0];
-
-        /* do a mapping into integration segment, i.e. coordinate transformation
-         * note: this has no effect if integration interval is [-1;1] */
-        const double xi_GP1 = 0.5 * ((1.0 - xi_GP1_tilde) * integration_segment1_lower_limit +
-                                        (1.0 + xi_GP1_tilde) * integration_segment1_upper_limit);
-
-        // compute coord vector
-        compute_centerline_position(r1, N1_i[igp1], ele1pos_);
-
-        // store for visualization
-        centerline_coords_gp_1_[igp1_total] = Core::FADUtils::cast_to_double<T, 3, 1>(r1);
-
-        double jacobifac1 = beam_element1()->get_jacobi_fac_at_xi(xi_GP1);
+        const Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>& N1_i_GP1 =
+            gp_data1.N_i[igp1_total];
+        const Core::LinAlg::Matrix<3, 1, T>& r1 = gp_data1.r[igp1_total];
+        const double jacobifac1 = gp_data1.jacobifac[igp1_total];
 
         // loop over gauss points of current segment on element 2
         for (int igp2 = 0; igp2 < numgp_persegment; ++igp2)
         {
           int igp2_total = isegment2 * numgp_persegment + igp2;
 
-          // Get location of GP in element parameter space xi \in [-1;1]
-          const double xi_GP2_tilde = gausspoints.qxg[igp2][0];
-
-          /* do a mapping into integration segment, i.e. coordinate transformation
-           * note: this has no effect if integration interval is [-1;1] */
-          const double xi_GP2 = 0.5 * ((1.0 - xi_GP2_tilde) * integration_segment2_lower_limit +
-                                          (1.0 + xi_GP2_tilde) * integration_segment2_upper_limit);
-
-          // compute coord vector
-          compute_centerline_position(r2, N2_i[igp2], ele2pos_);
-
-          // store for visualization
-          centerline_coords_gp_2_[igp2_total] = Core::FADUtils::cast_to_double<T, 3, 1>(r2);
-
-          double jacobifac2 = beam_element2()->get_jacobi_fac_at_xi(xi_GP2);
+          const Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>& N2_i_GP2 =
+              gp_data2.N_i[igp2_total];
+          const Core::LinAlg::Matrix<3, 1, T>& r2 = gp_data2.r[igp2_total];
+          const double jacobifac2 = gp_data2.jacobifac[igp2_total];
 
           dist = Core::FADUtils::diff_vector(r1, r2);
 
@@ -870,7 +843,7 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
             // loop over dimensions
             for (unsigned int j = 0; j < 3; ++j)
             {
-              force_pot1(3 * i + j) -= N1_i[igp1](i) * fpot_tmp(j);
+              force_pot1(3 * i + j) -= N1_i_GP1(i) * fpot_tmp(j);
             }
           }
 
@@ -883,7 +856,7 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
             // loop over dimensions
             for (unsigned int j = 0; j < 3; ++j)
             {
-              force_pot2(3 * i + j) += N2_i[igp2](i) * fpot_tmp(j);
+              force_pot2(3 * i + j) += N2_i_GP2(i) * fpot_tmp(j);
             }
           }
 
@@ -892,8 +865,8 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues, T>::
               stiffmat22 != nullptr)
           {
             evaluate_stiffpot_analytic_contributions_double_length_specific_small_sep_approx(dist,
-                norm_dist, gap, gap_regularized, gap_exp1, q1q2_JacFac_GaussWeights, N1_i[igp1],
-                N2_i[igp2], *stiffmat11, *stiffmat12, *stiffmat21, *stiffmat22);
+                norm_dist, gap, gap_regularized, gap_exp1, q1q2_JacFac_GaussWeights, N1_i_GP1,
+                N2_i_GP2, *stiffmat11, *stiffmat12, *stiffmat21, *stiffmat22);
           }
 
           // store for visualization
@@ -3685,6 +3658,94 @@ void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues,
       eledofvec, N_i_xi, r_xi);
 }
 
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
+void BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues,
+    T>::evaluate_gauss_point_data_all_segments(const Discret::Elements::Beam3Base& beam_element,
+    const double elelength, const Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, T>& elepos,
+    const Core::FE::IntegrationPoints1D& gausspoints, const unsigned int num_integration_segments,
+    GaussPointDataAllSegments& gp_data) const
+{
+  const int numgp_persegment = gausspoints.nquad;
+  const int numgp_perelement = num_integration_segments * numgp_persegment;
+
+  gp_data.N_i.resize(numgp_perelement);
+  gp_data.r.resize(numgp_perelement);
+  gp_data.jacobifac.resize(numgp_perelement);
+  gp_data.segment_sphere_midpoint.resize(num_integration_segments);
+  gp_data.segment_sphere_radius.resize(num_integration_segments);
+
+  std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N_i(numgp_persegment);
+
+  for (unsigned int isegment = 0; isegment < num_integration_segments; ++isegment)
+  {
+    // compute element parameter coordinate for lower and upper limit of current integration segment
+    const double integration_segment_lower_limit = -1.0 + isegment * 2.0 / num_integration_segments;
+    const double integration_segment_upper_limit =
+        -1.0 + (isegment + 1) * 2.0 / num_integration_segments;
+
+    Discret::Utils::Beam::evaluate_shape_functions_all_gps<numnodes, numnodalvalues>(gausspoints,
+        N_i, beam_element.shape(), elelength, integration_segment_lower_limit,
+        integration_segment_upper_limit);
+
+    Core::LinAlg::Matrix<3, 1, double>& midpoint = gp_data.segment_sphere_midpoint[isegment];
+    midpoint.clear();
+
+    for (int igp = 0; igp < numgp_persegment; ++igp)
+    {
+      const int igp_total = isegment * numgp_persegment + igp;
+
+      // Get location of GP in element parameter space xi \in [-1;1]
+      const double xi_GP_tilde = gausspoints.qxg[igp][0];
+
+      /* do a mapping into integration segment, i.e. coordinate transformation
+       * note: this has no effect if integration interval is [-1;1] */
+      const double xi_GP = 0.5 * ((1.0 - xi_GP_tilde) * integration_segment_lower_limit +
+                                     (1.0 + xi_GP_tilde) * integration_segment_upper_limit);
+
+      gp_data.N_i[igp_total] = N_i[igp];
+      compute_centerline_position(gp_data.r[igp_total], N_i[igp], elepos);
+      gp_data.jacobifac[igp_total] = beam_element.get_jacobi_fac_at_xi(xi_GP);
+
+      midpoint.update(1.0 / numgp_persegment,
+          Core::FADUtils::cast_to_double<T, 3, 1>(gp_data.r[igp_total]), 1.0);
+    }
+
+    // the bounding sphere encloses all Gauss points (not the continuous centerline) of the segment,
+    // since the cutoff criterion is only applied to pairs of Gauss points
+    double& radius = gp_data.segment_sphere_radius[isegment];
+    radius = 0.0;
+    for (int igp = 0; igp < numgp_persegment; ++igp)
+    {
+      Core::LinAlg::Matrix<3, 1, double> midpoint_to_gp =
+          Core::FADUtils::cast_to_double<T, 3, 1>(gp_data.r[isegment * numgp_persegment + igp]);
+      midpoint_to_gp.update(-1.0, midpoint, 1.0);
+      radius = std::max(radius, midpoint_to_gp.norm2());
+    }
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
+bool BeamInteraction::BeamToBeamPotentialPair<numnodes, numnodalvalues,
+    T>::are_segments_more_separated_than_cutoff_distance(const GaussPointDataAllSegments& gp_data1,
+    const unsigned int isegment1, const GaussPointDataAllSegments& gp_data2,
+    const unsigned int isegment2) const
+{
+  Core::LinAlg::Matrix<3, 1, double> midpoint_distance(true);
+  midpoint_distance.update(1.0, gp_data1.segment_sphere_midpoint[isegment1], -1.0,
+      gp_data2.segment_sphere_midpoint[isegment2]);
+
+  // lower bound for the separation of any pair of Gauss points of both segments
+  const double minimal_gauss_point_separation = midpoint_distance.norm2() -
+                                                gp_data1.segment_sphere_radius[isegment1] -
+                                                gp_data2.segment_sphere_radius[isegment2];
+
+  return minimal_gauss_point_separation > params()->cutoff_radius();
+}
+
 /*-----------------------------------------------------------------------------------------------*
  *-----------------------------------------------------------------------------------------------*/
 template <unsigned int numnodes, unsigned int numnodalvalues, typename T>
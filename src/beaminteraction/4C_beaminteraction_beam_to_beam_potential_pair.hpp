@@ -151,6 +151,25 @@ namespace BeamInteraction
     //@}
 
    private:
+    //! data evaluated at all Gauss points of all integration segments of one element
+    struct GaussPointDataAllSegments
+    {
+      //! individual shape function values at Gauss points
+      std::vector<Core::LinAlg::Matrix<1, numnodes * numnodalvalues, double>> N_i;
+
+      //! centerline positions at Gauss points
+      std::vector<Core::LinAlg::Matrix<3, 1, T>> r;
+
+      //! jacobi factors at Gauss points
+      std::vector<double> jacobifac;
+
+      //! midpoints of the bounding spheres of the Gauss points of each integration segment
+      std::vector<Core::LinAlg::Matrix<3, 1, double>> segment_sphere_midpoint;
+
+      //! radii of the bounding spheres of the Gauss points of each integration segment
+      std::vector<double> segment_sphere_radius;
+    };
+
     //! @name Private evaluation methods
 
     /** \brief Evaluate forces and stiffness contribution resulting from potential-based interaction
@@ -541,6 +560,25 @@ namespace BeamInteraction
         const Core::LinAlg::Matrix<1, numnodes * numnodalvalues, T2>& N_i,
         const Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, T> eledofvec) const;
 
+    /*!
+    \brief Evaluate shape functions, centerline positions and jacobi factors at all Gauss points
+    of all integration segments of one element and compute a bounding sphere of the Gauss points of
+    each integration segment
+    */
+    void evaluate_gauss_point_data_all_segments(const Discret::Elements::Beam3Base& beam_element,
+        const double elelength,
+        const Core::LinAlg::Matrix<3 * numnodes * numnodalvalues, 1, T>& elepos,
+        const Core::FE::IntegrationPoints1D& gausspoints,
+        const unsigned int num_integration_segments, GaussPointDataAllSegments& gp_data) const;
+
+    /*!
+    \brief Check whether all pairs of Gauss points of two integration segments are separated by
+    more than the cutoff radius, based on the bounding spheres of the segments' Gauss points
+    */
+    bool are_segments_more_separated_than_cutoff_distance(
+        const GaussPointDataAllSegments& gp_data1, const unsigned int isegment1,
+        const GaussPointDataAllSegments& gp_data2, const unsigned int isegment2) const;
+
     /*!
     \brief Compute tangent vector at centerline point
     */
@@ -0,0 +1,387 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_beaminteraction_crosslinker_container.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_comm_pack_helpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  //! number of integer entries per crosslinker in serialized data
+  constexpr int int_stride = 4 + 2 * BeamInteraction::CrosslinkerContainer::num_bspots;
+
+  //! number of floating point entries per crosslinker in serialized data
+  constexpr int double_stride = 6;
+
+  /*!
+   * \brief reorder entries of data according to permutation (stride entries per crosslinker)
+   */
+  template <typename T>
+  void apply_permutation(std::vector<T>& data, const std::vector<int>& permutation, int stride)
+  {
+    std::vector<T> sorted(data.size());
+    for (std::size_t k = 0; k < permutation.size(); ++k)
+      std::copy_n(&data[stride * permutation[k]], stride, &sorted[stride * k]);
+    data.swap(sorted);
+  }
+
+  /*!
+   * \brief exchange serialized crosslinkers between all processors
+   *
+   * sendindices[p] holds the indices of all crosslinkers that are sent to processor p, the
+   * serialized data of the crosslinkers is expected in the same order in sendints and senddoubles.
+   */
+  void exchange_crosslinkers(MPI_Comm comm, const std::vector<std::vector<int>>& sendindices,
+      const std::vector<int>& sendints, const std::vector<double>& senddoubles,
+      std::vector<int>& recvints, std::vector<double>& recvdoubles)
+  {
+    const int numproc = Core::Communication::num_mpi_ranks(comm);
+
+    std::vector<int> sendcount(numproc, 0);
+    for (int proc = 0; proc < numproc; ++proc)
+      sendcount[proc] = static_cast<int>(sendindices[proc].size());
+
+    std::vector<int> senddispl(numproc + 1, 0);
+    std::partial_sum(sendcount.begin(), sendcount.end(), senddispl.begin() + 1);
+
+    // communicate number of crosslinkers to be received
+    std::vector<int> recvcount(numproc, 0);
+    MPI_Alltoall(sendcount.data(), 1, MPI_INT, recvcount.data(), 1, MPI_INT, comm);
+
+    std::vector<int> recvdispl(numproc + 1, 0);
+    std::partial_sum(recvcount.begin(), recvcount.end(), recvdispl.begin() + 1);
+
+    // exchange all crosslinker data in one step for integer and double data, respectively
+    auto scaled = [](const std::vector<int>& counts, int stride)
+    {
+      std::vector<int> scaledcounts(counts.size());
+      std::transform(counts.begin(), counts.end(), scaledcounts.begin(),
+          [stride](const int count) { return stride * count; });
+      return scaledcounts;
+    };
+
+    recvints.resize(int_stride * recvdispl[numproc]);
+    recvdoubles.resize(double_stride * recvdispl[numproc]);
+
+    MPI_Alltoallv(sendints.data(), scaled(sendcount, int_stride).data(),
+        scaled(senddispl, int_stride).data(), MPI_INT, recvints.data(),
+        scaled(recvcount, int_stride).data(), scaled(recvdispl, int_stride).data(), MPI_INT, comm);
+    MPI_Alltoallv(senddoubles.data(), scaled(sendcount, double_stride).data(),
+        scaled(senddispl, double_stride).data(), MPI_DOUBLE, recvdoubles.data(),
+        scaled(recvcount, double_stride).data(), scaled(recvdispl, double_stride).data(),
+        MPI_DOUBLE, comm);
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::reserve(int numlinker)
+{
+  gid_.reserve(numlinker);
+  type_.reserve(numlinker);
+  bin_.reserve(numlinker);
+  position_.reserve(3 * numlinker);
+  reference_position_.reserve(3 * numlinker);
+  number_of_bonds_.reserve(numlinker);
+  bspot_ele_gid_.reserve(num_bspots * numlinker);
+  bspot_loc_id_.reserve(num_bspots * numlinker);
+  index_of_gid_.reserve(numlinker);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::clear()
+{
+  resize(0);
+  index_of_gid_.clear();
+  sorted_bins_.clear();
+  bin_offsets_.assign(1, 0);
+  is_sorted_ = true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+int BeamInteraction::CrosslinkerContainer::add_crosslinker(int gid, int type,
+    const Core::LinAlg::Matrix<3, 1>& position, int numbonds,
+    const std::vector<std::pair<int, int>>& bspots, int bingid)
+{
+  FOUR_C_ASSERT(numbonds >= 0 and numbonds <= num_bspots,
+      "Crosslinker with gid %i has unrealistic number %i of bonds!", gid, numbonds);
+  FOUR_C_ASSERT(static_cast<int>(bspots.size()) == num_bspots,
+      "Crosslinker with gid %i has %i instead of %i binding spots!", gid,
+      static_cast<int>(bspots.size()), num_bspots);
+  FOUR_C_ASSERT(index_of(gid) < 0, "Crosslinker with gid %i is already in container!", gid);
+
+  gid_.push_back(gid);
+  type_.push_back(type);
+  bin_.push_back(bingid);
+  for (int dim = 0; dim < 3; ++dim)
+  {
+    position_.push_back(position(dim));
+    reference_position_.push_back(position(dim));
+  }
+  number_of_bonds_.push_back(numbonds);
+  for (const auto& [elegid, locbspotid] : bspots)
+  {
+    bspot_ele_gid_.push_back(elegid);
+    bspot_loc_id_.push_back(locbspotid);
+  }
+
+  const int index = size() - 1;
+  index_of_gid_[gid] = index;
+  is_sorted_ = false;
+
+  return index;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::remove_crosslinker(int index)
+{
+  FOUR_C_ASSERT(index >= 0 and index < size(), "Index %i out of bounds!", index);
+
+  index_of_gid_.erase(gid_[index]);
+
+  const int last = size() - 1;
+  if (index != last)
+  {
+    copy_crosslinker(last, index);
+    index_of_gid_[gid_[index]] = index;
+  }
+  resize(last);
+  is_sorted_ = false;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::sort_by_bin()
+{
+  std::vector<int> permutation(size());
+  std::iota(permutation.begin(), permutation.end(), 0);
+  std::sort(permutation.begin(), permutation.end(), [this](const int a, const int b)
+      { return std::make_pair(bin_[a], gid_[a]) < std::make_pair(bin_[b], gid_[b]); });
+
+  apply_permutation(gid_, permutation, 1);
+  apply_permutation(type_, permutation, 1);
+  apply_permutation(bin_, permutation, 1);
+  apply_permutation(position_, permutation, 3);
+  apply_permutation(reference_position_, permutation, 3);
+  apply_permutation(number_of_bonds_, permutation, 1);
+  apply_permutation(bspot_ele_gid_, permutation, num_bspots);
+  apply_permutation(bspot_loc_id_, permutation, num_bspots);
+
+  for (int i = 0; i < size(); ++i) index_of_gid_[gid_[i]] = i;
+
+  sorted_bins_.clear();
+  bin_offsets_.assign(1, 0);
+  for (int i = 0; i < size(); ++i)
+  {
+    if (sorted_bins_.empty() or sorted_bins_.back() != bin_[i])
+    {
+      if (not sorted_bins_.empty()) bin_offsets_.push_back(i);
+      sorted_bins_.push_back(bin_[i]);
+    }
+  }
+  if (size() > 0) bin_offsets_.push_back(size());
+
+  is_sorted_ = true;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::pair<int, int> BeamInteraction::CrosslinkerContainer::bin_range(int bingid) const
+{
+  FOUR_C_ASSERT(is_sorted_, "Crosslinker container is not sorted by bin!");
+
+  const auto it = std::lower_bound(sorted_bins_.begin(), sorted_bins_.end(), bingid);
+  if (it == sorted_bins_.end() or *it != bingid) return {0, 0};
+
+  const auto k = std::distance(sorted_bins_.begin(), it);
+  return {bin_offsets_[k], bin_offsets_[k + 1]};
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::migrate(
+    MPI_Comm comm, const std::vector<int>& targetrank)
+{
+  FOUR_C_ASSERT(static_cast<int>(targetrank.size()) == size(),
+      "Target rank needs to be given for each crosslinker!");
+
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+  const int numproc = Core::Communication::num_mpi_ranks(comm);
+
+  // collect crosslinkers to be sent per target processor and those to be removed
+  std::vector<std::vector<int>> sendindices(numproc);
+  std::vector<int> removeindices;
+  for (int i = 0; i < size(); ++i)
+  {
+    if (targetrank[i] == myrank) continue;
+
+    removeindices.push_back(i);
+    if (targetrank[i] >= 0) sendindices[targetrank[i]].push_back(i);
+  }
+
+  std::vector<int> sendorder;
+  for (const auto& indices : sendindices)
+    sendorder.insert(sendorder.end(), indices.begin(), indices.end());
+
+  std::vector<int> sendints, recvints;
+  std::vector<double> senddoubles, recvdoubles;
+  pack_crosslinkers(sendorder, sendints, senddoubles);
+
+  exchange_crosslinkers(comm, sendindices, sendints, senddoubles, recvints, recvdoubles);
+
+  // remove sent crosslinkers (in descending order of indices to keep swap-removal valid)
+  std::sort(removeindices.begin(), removeindices.end(), std::greater<int>());
+  for (const int i : removeindices) remove_crosslinker(i);
+
+  append_crosslinkers(recvints, recvdoubles);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::export_copies(MPI_Comm comm,
+    const std::vector<std::vector<int>>& indicesperrank, CrosslinkerContainer& copies) const
+{
+  FOUR_C_ASSERT(static_cast<int>(indicesperrank.size()) == Core::Communication::num_mpi_ranks(comm),
+      "Indices need to be given for each processor!");
+
+  std::vector<int> sendorder;
+  for (const auto& indices : indicesperrank)
+    sendorder.insert(sendorder.end(), indices.begin(), indices.end());
+
+  std::vector<int> sendints, recvints;
+  std::vector<double> senddoubles, recvdoubles;
+  pack_crosslinkers(sendorder, sendints, senddoubles);
+
+  exchange_crosslinkers(comm, indicesperrank, sendints, senddoubles, recvints, recvdoubles);
+
+  copies.clear();
+  copies.append_crosslinkers(recvints, recvdoubles);
+  copies.sort_by_bin();
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::pack(Core::Communication::PackBuffer& data) const
+{
+  std::vector<int> indices(size());
+  std::iota(indices.begin(), indices.end(), 0);
+
+  std::vector<int> intdata;
+  std::vector<double> doubledata;
+  pack_crosslinkers(indices, intdata, doubledata);
+
+  Core::Communication::add_to_pack(data, intdata);
+  Core::Communication::add_to_pack(data, doubledata);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::unpack(Core::Communication::UnpackBuffer& buffer)
+{
+  std::vector<int> intdata;
+  std::vector<double> doubledata;
+  Core::Communication::extract_from_pack(buffer, intdata);
+  Core::Communication::extract_from_pack(buffer, doubledata);
+
+  append_crosslinkers(intdata, doubledata);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::pack_crosslinkers(const std::vector<int>& indices,
+    std::vector<int>& intdata, std::vector<double>& doubledata) const
+{
+  intdata.resize(int_stride * indices.size());
+  doubledata.resize(double_stride * indices.size());
+
+  for (std::size_t k = 0; k < indices.size(); ++k)
+  {
+    const int i = indices[k];
+
+    int* ints = &intdata[int_stride * k];
+    ints[0] = gid_[i];
+    ints[1] = type_[i];
+    ints[2] = bin_[i];
+    ints[3] = number_of_bonds_[i];
+    for (int j = 0; j < num_bspots; ++j)
+    {
+      ints[4 + j] = bspot_ele_gid_[num_bspots * i + j];
+      ints[4 + num_bspots + j] = bspot_loc_id_[num_bspots * i + j];
+    }
+
+    double* doubles = &doubledata[double_stride * k];
+    std::copy_n(&position_[3 * i], 3, doubles);
+    std::copy_n(&reference_position_[3 * i], 3, doubles + 3);
+  }
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::append_crosslinkers(
+    const std::vector<int>& intdata, const std::vector<double>& doubledata)
+{
+  const int numlinker = static_cast<int>(intdata.size()) / int_stride;
+  FOUR_C_ASSERT(static_cast<int>(doubledata.size()) == double_stride * numlinker,
+      "Serialized crosslinker data is inconsistent!");
+
+  reserve(size() + numlinker);
+
+  std::vector<std::pair<int, int>> bspots(num_bspots);
+  Core::LinAlg::Matrix<3, 1> position;
+  for (int k = 0; k < numlinker; ++k)
+  {
+    const int* ints = &intdata[int_stride * k];
+    const double* doubles = &doubledata[double_stride * k];
+
+    for (int j = 0; j < num_bspots; ++j) bspots[j] = {ints[4 + j], ints[4 + num_bspots + j]};
+    for (int dim = 0; dim < 3; ++dim) position(dim) = doubles[dim];
+
+    const int index = add_crosslinker(ints[0], ints[1], position, ints[3], bspots, ints[2]);
+    std::copy_n(doubles + 3, 3, &reference_position_[3 * index]);
+  }
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::copy_crosslinker(int source, int target)
+{
+  gid_[target] = gid_[source];
+  type_[target] = type_[source];
+  bin_[target] = bin_[source];
+  std::copy_n(&position_[3 * source], 3, &position_[3 * target]);
+  std::copy_n(&reference_position_[3 * source], 3, &reference_position_[3 * target]);
+  number_of_bonds_[target] = number_of_bonds_[source];
+  std::copy_n(
+      &bspot_ele_gid_[num_bspots * source], num_bspots, &bspot_ele_gid_[num_bspots * target]);
+  std::copy_n(&bspot_loc_id_[num_bspots * source], num_bspots, &bspot_loc_id_[num_bspots * target]);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::CrosslinkerContainer::resize(int numlinker)
+{
+  gid_.resize(numlinker);
+  type_.resize(numlinker);
+  bin_.resize(numlinker);
+  position_.resize(3 * numlinker);
+  reference_position_.resize(3 * numlinker);
+  number_of_bonds_.resize(numlinker);
+  bspot_ele_gid_.resize(num_bspots * numlinker);
+  bspot_loc_id_.resize(num_bspots * numlinker);
+}
+
+FOUR_C_NAMESPACE_CLOSE
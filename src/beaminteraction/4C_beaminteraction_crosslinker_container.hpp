@@ -0,0 +1,263 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_BEAMINTERACTION_CROSSLINKER_CONTAINER_HPP
+#define FOUR_C_BEAMINTERACTION_CROSSLINKER_CONTAINER_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <mpi.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::Communication
+{
+  class PackBuffer;
+  class UnpackBuffer;
+}  // namespace Core::Communication
+
+namespace BeamInteraction
+{
+  /*!
+   * \brief Compact structure-of-arrays container owning the crosslinkers of one processor
+   *
+   * All per-linker quantities are stored in contiguous arrays indexed by the position of the linker
+   * in the container. Linkers are removed by swapping with the last linker, i.e., indices are not
+   * stable under removal. Each linker is assigned to the bin it resides in. After a call to
+   * sort_by_bin() the linkers of one bin are stored contiguously and can be accessed via
+   * bin_range() until the next linker is added or removed.
+   *
+   * Linkers change their owning processor in bulk via migrate(), copies of linkers for ghosted bins
+   * are sent via export_copies().
+   */
+  class CrosslinkerContainer
+  {
+   public:
+    //! number of binding spots of a crosslinker
+    static constexpr int num_bspots = 2;
+
+    /*!
+     * \brief reserve memory for a given number of crosslinkers
+     */
+    void reserve(int numlinker);
+
+    /*!
+     * \brief remove all crosslinkers while keeping the allocated memory
+     */
+    void clear();
+
+    /*!
+     * \brief number of crosslinkers stored in the container
+     */
+    [[nodiscard]] int size() const { return static_cast<int>(gid_.size()); }
+
+    /*!
+     * \brief add a crosslinker to the container
+     *
+     * The reference position of the crosslinker is initialized with its current position.
+     *
+     * \param[in] gid       global id of crosslinker
+     * \param[in] type      crosslinker type, i.e. index of its material in the list of
+     *                      crosslinker materials
+     * \param[in] position  current position of crosslinker
+     * \param[in] numbonds  number of active bonds (0, 1 or 2)
+     * \param[in] bspots    element gid and local binding spot number of both crosslinker
+     *                      binding spots (-1 if not bonded)
+     * \param[in] bingid    gid of bin the crosslinker resides in (-1 if not yet known)
+     *
+     * \return index of crosslinker in container
+     */
+    int add_crosslinker(int gid, int type, const Core::LinAlg::Matrix<3, 1>& position,
+        int numbonds, const std::vector<std::pair<int, int>>& bspots, int bingid = -1);
+
+    /*!
+     * \brief remove crosslinker at index by swapping it with the last crosslinker
+     */
+    void remove_crosslinker(int index);
+
+    /*!
+     * \brief index of crosslinker with global id gid (-1 if it is not stored in this container)
+     */
+    [[nodiscard]] int index_of(int gid) const
+    {
+      const auto it = index_of_gid_.find(gid);
+      return (it == index_of_gid_.end()) ? -1 : it->second;
+    }
+
+    //!@name data access functions
+    //! @{
+
+    [[nodiscard]] int gid(int index) const { return gid_[index]; }
+
+    [[nodiscard]] int type(int index) const { return type_[index]; }
+
+    [[nodiscard]] int bin(int index) const { return bin_[index]; }
+
+    [[nodiscard]] double* position(int index) { return &position_[3 * index]; }
+
+    [[nodiscard]] const double* position(int index) const { return &position_[3 * index]; }
+
+    [[nodiscard]] const double* reference_position(int index) const
+    {
+      return &reference_position_[3 * index];
+    }
+
+    [[nodiscard]] int number_of_bonds(int index) const { return number_of_bonds_[index]; }
+
+    [[nodiscard]] std::pair<int, int> bspot(int index, int bspotid) const
+    {
+      return {bspot_ele_gid_[num_bspots * index + bspotid],
+          bspot_loc_id_[num_bspots * index + bspotid]};
+    }
+
+    [[nodiscard]] std::vector<std::pair<int, int>> bspots(int index) const
+    {
+      return {bspot(index, 0), bspot(index, 1)};
+    }
+
+    void set_position(int index, const Core::LinAlg::Matrix<3, 1>& position)
+    {
+      for (int dim = 0; dim < 3; ++dim) position_[3 * index + dim] = position(dim);
+    }
+
+    void set_bin(int index, int bingid)
+    {
+      bin_[index] = bingid;
+      is_sorted_ = false;
+    }
+
+    void set_number_of_bonds(int index, int numbonds) { number_of_bonds_[index] = numbonds; }
+
+    void set_bspot(int index, int bspotid, const std::pair<int, int>& bspot)
+    {
+      bspot_ele_gid_[num_bspots * index + bspotid] = bspot.first;
+      bspot_loc_id_[num_bspots * index + bspotid] = bspot.second;
+    }
+
+    //! @}
+
+    /*!
+     * \brief current positions of all crosslinkers become their new reference positions
+     */
+    void reset_reference_positions() { reference_position_ = position_; }
+
+    /*!
+     * \brief sort crosslinkers by bin (and by gid within one bin)
+     */
+    void sort_by_bin();
+
+    /*!
+     * \brief gids of all bins containing at least one crosslinker in ascending order
+     *
+     * \note only valid after sort_by_bin()
+     */
+    [[nodiscard]] const std::vector<int>& bins() const
+    {
+      FOUR_C_ASSERT(is_sorted_, "Crosslinker container is not sorted by bin!");
+      return sorted_bins_;
+    }
+
+    /*!
+     * \brief index range [first, second) of crosslinkers residing in bin with gid bingid
+     *
+     * \note only valid after sort_by_bin()
+     */
+    [[nodiscard]] std::pair<int, int> bin_range(int bingid) const;
+
+    /*!
+     * \brief send crosslinkers to other processors
+     *
+     * Crosslinker at index i is sent to processor targetrank[i]. Crosslinkers with a negative
+     * target rank are removed. Received crosslinkers are appended to the container.
+     *
+     * \note collective call
+     */
+    void migrate(MPI_Comm comm, const std::vector<int>& targetrank);
+
+    /*!
+     * \brief send copies of crosslinkers to other processors
+     *
+     * Copies of the crosslinkers at indicesperrank[p] are sent to processor p. The container
+     * copies is filled with all copies received by this processor and sorted by bin.
+     *
+     * \note collective call
+     */
+    void export_copies(MPI_Comm comm, const std::vector<std::vector<int>>& indicesperrank,
+        CrosslinkerContainer& copies) const;
+
+    /*!
+     * \brief pack all crosslinkers into buffer
+     */
+    void pack(Core::Communication::PackBuffer& data) const;
+
+    /*!
+     * \brief append all crosslinkers stored in buffer
+     */
+    void unpack(Core::Communication::UnpackBuffer& buffer);
+
+   private:
+    //! copy crosslinker data from index source to index target
+    void copy_crosslinker(int source, int target);
+
+    //! shrink all arrays to the given number of crosslinkers
+    void resize(int numlinker);
+
+    //! serialize crosslinkers at given indices into integer and floating point data
+    void pack_crosslinkers(const std::vector<int>& indices, std::vector<int>& intdata,
+        std::vector<double>& doubledata) const;
+
+    //! append crosslinkers from serialized integer and floating point data
+    void append_crosslinkers(const std::vector<int>& intdata, const std::vector<double>& doubledata);
+
+    //! global ids of crosslinkers
+    std::vector<int> gid_;
+
+    //! crosslinker types (index of crosslinker material)
+    std::vector<int> type_;
+
+    //! gids of bins the crosslinkers reside in
+    std::vector<int> bin_;
+
+    //! positions of crosslinkers (3 entries per linker)
+    std::vector<double> position_;
+
+    //! positions of crosslinkers at last redistribution (3 entries per linker)
+    std::vector<double> reference_position_;
+
+    //! number of active bonds
+    std::vector<int> number_of_bonds_;
+
+    //! element gid of binding spots (num_bspots entries per linker)
+    std::vector<int> bspot_ele_gid_;
+
+    //! local binding spot number of binding spots (num_bspots entries per linker)
+    std::vector<int> bspot_loc_id_;
+
+    //! index of crosslinker in container (key is crosslinker gid)
+    std::unordered_map<int, int> index_of_gid_;
+
+    //! flag indicating that crosslinkers are sorted by bin
+    bool is_sorted_ = true;
+
+    //! gids of non-empty bins in ascending order
+    std::vector<int> sorted_bins_;
+
+    //! index of first crosslinker of each bin in sorted_bins_ (one additional entry at the end)
+    std::vector<int> bin_offsets_ = {0};
+  };
+}  // namespace BeamInteraction
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
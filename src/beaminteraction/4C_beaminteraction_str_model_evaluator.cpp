@@ -10,8 +10,6 @@
 #include "4C_beam3_base.hpp"
 #include "4C_beamcontact_input.hpp"
 #include "4C_beaminteraction_calc_utils.hpp"
-#include "4C_beaminteraction_crosslinker_handler.hpp"
-#include "4C_beaminteraction_crosslinker_node.hpp"
 #include "4C_beaminteraction_data.hpp"
 #include "4C_beaminteraction_str_model_evaluator_datastate.hpp"
 #include "4C_beaminteraction_submodel_evaluator_beamcontact.hpp"
@@ -61,7 +59,6 @@ Solid::ModelEvaluator::BeamInteraction::BeamInteraction()
       ia_force_beaminteraction_(nullptr),
       force_beaminteraction_(nullptr),
       stiff_beaminteraction_(nullptr),
-      beam_crosslinker_handler_(nullptr),
       binstrategy_(nullptr),
       bindis_(nullptr),
       rowbins_(nullptr),
@@ -139,7 +136,7 @@ void Solid::ModelEvaluator::BeamInteraction::setup()
   siatransform_ = std::make_shared<Coupling::Adapter::MatrixRowTransform>();
 
   // -------------------------------------------------------------------------
-  // initialize and setup binning strategy and beam crosslinker handler
+  // initialize and setup binning strategy
   // -------------------------------------------------------------------------
   // construct, init and setup binning strategy
   std::vector<std::shared_ptr<Core::FE::Discretization>> discret_vec(1, ia_discret_);
@@ -199,15 +196,6 @@ void Solid::ModelEvaluator::BeamInteraction::setup()
 
   bindis_ = binstrategy_->bin_discret();
 
-  // construct, init and setup beam crosslinker handler and binning strategy
-  // todo: move this and its single call during partition to crosslinker submodel
-  if (have_sub_model_type(Inpar::BeamInteraction::submodel_crosslinking))
-  {
-    beam_crosslinker_handler_ = std::make_shared<FourC::BeamInteraction::BeamCrosslinkerHandler>();
-    beam_crosslinker_handler_->init(global_state().get_my_rank(), binstrategy_);
-    beam_crosslinker_handler_->setup();
-  }
-
   // some screen output for binning
   print_binning_info_to_screen();
 
@@ -365,7 +353,7 @@ void Solid::ModelEvaluator::BeamInteraction::init_and_setup_sub_model_evaluators
   {
     (*some_iter)
         ->init(ia_discret_, bindis_, global_state_ptr(), global_in_output_ptr(), ia_state_ptr_,
-            beam_crosslinker_handler_, binstrategy_,
+            binstrategy_,
             tim_int().get_data_sdyn_ptr()->get_periodic_bounding_box(),
             std::dynamic_pointer_cast<FourC::BeamInteraction::Utils::MapExtractor>(
                 eletypeextractor_));
@@ -446,17 +434,15 @@ void Solid::ModelEvaluator::BeamInteraction::partition_problem()
   rowbins_ =
       binstrategy_->weighted_distribution_of_bins_to_procs(discret_vec, disnp, nodesinbin, weight);
 
-  // extract noderowmap because it will be called reset() after adding elements
-  std::shared_ptr<Epetra_Map> noderowmap = std::make_shared<Epetra_Map>(*bindis_->node_row_map());
   // delete old bins ( in case you partition during your simulation or after a restart)
   bindis_->delete_elements();
   binstrategy_->fill_bins_into_bin_discretization(*rowbins_);
 
-  // now node (=crosslinker) to bin (=element) relation needs to be
-  // established in binning discretization. Therefore some nodes need to
-  // change their owner according to the bins owner they reside in
+  // crosslinker need to change their owner according to the owner of the bin they reside in
   if (have_sub_model_type(Inpar::BeamInteraction::submodel_crosslinking))
-    beam_crosslinker_handler_->distribute_linker_to_bins(noderowmap);
+    std::dynamic_pointer_cast<FourC::BeamInteraction::SUBMODELEVALUATOR::Crosslinking>(
+        me_map_ptr_->at(Inpar::BeamInteraction::submodel_crosslinking))
+        ->distribute_crosslinker_to_bins(*rowbins_);
 
   // determine boundary bins (physical boundary as well as boundary to other procs)
   binstrategy_->determine_boundary_row_bins();
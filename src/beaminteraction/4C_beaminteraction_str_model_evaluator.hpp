@@ -40,8 +40,6 @@ namespace BeamInteraction
 {
   class BeamInteractionParams;
 
-  class BeamCrosslinkerHandler;
-
   namespace SUBMODELEVALUATOR
   {
     class Generic;
@@ -284,9 +282,6 @@ namespace Solid
       //! structural stiffness matrix based on discret()
       std::shared_ptr<Core::LinAlg::SparseMatrix> stiff_beaminteraction_;
 
-      //! beam crosslinker handler
-      std::shared_ptr<FourC::BeamInteraction::BeamCrosslinkerHandler> beam_crosslinker_handler_;
-
       //! binning strategy
       std::shared_ptr<Core::Binstrategy::BinningStrategy> binstrategy_;
 
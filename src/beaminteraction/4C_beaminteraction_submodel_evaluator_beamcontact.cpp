@@ -77,6 +77,14 @@ void BeamInteraction::SUBMODELEVALUATOR::BeamContact::setup()
   geometric_search_params_ptr_ = std::make_shared<Core::GeometricSearch::GeometricSearchParams>(
       Global::Problem::instance()->geometric_search_params(),
       Global::Problem::instance()->io_params());
+  if (beam_interaction_params_ptr_->get_search_strategy() ==
+      Inpar::BeamInteraction::SearchStrategy::bounding_volume_hierarchy)
+  {
+    collision_search_tree_ptr_ = std::make_shared<Core::GeometricSearch::CollisionSearchTree>(
+        discret_ptr()->get_comm(),
+        geometric_search_params_ptr_->get_collision_search_tree_parameters(),
+        geometric_search_params_ptr_->verbosity_);
+  }
   if (beam_interaction_params_ptr_->get_search_strategy() ==
           Inpar::BeamInteraction::SearchStrategy::bounding_volume_hierarchy &&
       geometric_search_params_ptr_->get_write_visualization_flag())
@@ -890,9 +898,10 @@ void BeamInteraction::SUBMODELEVALUATOR::BeamContact::find_and_store_neighboring
       }
     }
 
-    // Get colliding pairs.
-    const auto& [indices, offsets] = collision_search(other_bounding_boxes, beam_bounding_boxes,
-        discret().get_comm(), geometric_search_params_ptr_->verbosity_);
+    // Get colliding pairs. The search tree is only rebuilt if the bounding volumes changed
+    // considerably since the last search, otherwise it is refitted.
+    collision_search_tree_ptr_->update_primitives(other_bounding_boxes);
+    const auto& [indices, offsets] = collision_search_tree_ptr_->query(beam_bounding_boxes);
 
     // Create the beam-to-xxx pair pointers according to the search.
     for (size_t i_beam = 0; i_beam < beam_bounding_boxes.size(); i_beam++)
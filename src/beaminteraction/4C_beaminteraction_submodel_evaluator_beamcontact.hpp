@@ -26,6 +26,7 @@ namespace Core::GeometricSearch
 {
   class geometric_search_params;
   class GeometricSearchVisualization;
+  class CollisionSearchTree;
 }  // namespace Core::GeometricSearch
 namespace BeamInteraction
 {
@@ -262,6 +263,10 @@ namespace BeamInteraction
       //! data container holding all geometric search related parameters
       std::shared_ptr<Core::GeometricSearch::GeometricSearchParams> geometric_search_params_ptr_;
 
+      //! persistent search tree containing the bounding volumes of all possible interacting
+      //! elements (only used with the bounding volume hierarchy search strategy)
+      std::shared_ptr<Core::GeometricSearch::CollisionSearchTree> collision_search_tree_ptr_;
+
       //! element types considered for beam to ? contact
       std::vector<Core::Binstrategy::Utils::BinContentType> contactelementtypes_;
 
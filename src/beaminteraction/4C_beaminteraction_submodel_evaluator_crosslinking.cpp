@@ -9,8 +9,6 @@
 
 #include "4C_beam3_base.hpp"
 #include "4C_beaminteraction_calc_utils.hpp"
-#include "4C_beaminteraction_crosslinker_handler.hpp"
-#include "4C_beaminteraction_crosslinker_node.hpp"
 #include "4C_beaminteraction_crosslinking_params.hpp"
 #include "4C_beaminteraction_data.hpp"
 #include "4C_beaminteraction_link.hpp"
@@ -18,14 +16,15 @@
 #include "4C_beaminteraction_link_beam3_reissner_line2_rigidjointed.hpp"
 #include "4C_beaminteraction_str_model_evaluator_datastate.hpp"
 #include "4C_binstrategy_meshfree_multibin.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_fem_condition.hpp"
 #include "4C_fem_geometry_intersection_math.hpp"
 #include "4C_fem_geometry_periodic_boundingbox.hpp"
 #include "4C_global_data.hpp"
 #include "4C_inpar_beaminteraction.hpp"
 #include "4C_io.hpp"
-#include "4C_io_discretization_visualization_writer_nodes.hpp"
 #include "4C_io_pstream.hpp"
+#include "4C_io_visualization_manager.hpp"
 #include "4C_linalg_multi_vector.hpp"
 #include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_serialdensevector.hpp"
@@ -38,6 +37,8 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <iterator>
+#include <numeric>
 #include <unordered_set>
 
 FOUR_C_NAMESPACE_OPEN
@@ -46,18 +47,12 @@ FOUR_C_NAMESPACE_OPEN
  *-------------------------------------------------------------------------------*/
 BeamInteraction::SUBMODELEVALUATOR::Crosslinking::Crosslinking()
     : crosslinking_params_ptr_(nullptr),
-      cl_exporter_(nullptr),
       beam_exporter_(nullptr),
-      visualization_output_writer_ptr_(nullptr),
-      linker_disnp_(nullptr),
-      dis_at_last_redistr_(nullptr),
+      visualization_manager_ptr_(nullptr),
       half_interaction_distance_(0.0),
-      cl_noderowmap_prior_redistr_(nullptr),
-      cl_nodecolmap_prior_redistr_(nullptr),
       beam_elerowmap_prior_redistr_(nullptr),
       beam_elecolmap_prior_redistr_(nullptr)
 {
-  crosslinker_data_.clear();
   beam_data_.clear();
   doublebondcl_.clear();
 }
@@ -73,21 +68,25 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::setup()
   crosslinking_params_ptr_->init(g_state());
   crosslinking_params_ptr_->setup();
 
+  // materials of all crosslinker types
+  crosslinker_materials_.clear();
+  for (int const matid : crosslinking_params_ptr_->mat_crosslinker_per_type())
+    crosslinker_materials_.push_back(
+        std::dynamic_pointer_cast<Mat::CrosslinkerMat>(Mat::factory(matid)));
+
   // set binding spot positions on filament elements according input file specifications
   set_filament_types();
   // this includes temporary change in ghosting
   BeamInteraction::Utils::set_filament_binding_spot_positions(
       discret_ptr(), *crosslinking_params_ptr_);
 
-  // add crosslinker to bin discretization
-  add_crosslinker_to_bin_discretization();
+  // add free crosslinker to container (they are distributed to their bins during partitioning)
+  add_initial_crosslinker();
 
   // build runtime visualization output writer
   if (g_in_output().get_runtime_vtp_output_params() != nullptr) init_output_runtime_structure();
 
   // store old maps prior to redistribution
-  cl_noderowmap_prior_redistr_ = std::make_shared<Epetra_Map>(*bin_discret().node_row_map());
-  cl_nodecolmap_prior_redistr_ = std::make_shared<Epetra_Map>(*bin_discret().node_col_map());
   beam_elerowmap_prior_redistr_ =
       std::make_shared<Epetra_Map>(*ele_type_map_extractor().beam_map());
   beam_elecolmap_prior_redistr_ = std::make_shared<Epetra_Map>(*discret().element_col_map());
@@ -147,36 +146,11 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::post_partition_problem()
   std::map<int, NewDoubleBonds> mynewdbondcl;
   set_all_possible_initial_double_bonded_crosslinker(newlinker, mynewdbondcl);
 
-  // set row map of newly created linker discretization
-  bin_discret_ptr()->fill_complete(false, false, false);
-
-  // init crosslinker data container
-  crosslinker_data_.clear();
-  unsigned int numrowcl = bin_discret().num_my_row_nodes();
-  crosslinker_data_.resize(bin_discret().num_my_col_nodes());
-  for (unsigned int i = 0; i < numrowcl; ++i)
-  {
-    Core::Nodes::Node* cl = bin_discret().l_row_node(i);
-    crosslinker_data_[cl->lid()] = std::make_shared<BeamInteraction::Data::CrosslinkerData>();
-
-    crosslinker_data_[cl->lid()]->set_id(cl->id());
-  }
-
-  // set initially set crosslinker
-  for (auto& iter : newlinker)
-  {
-    int cl_lid = bin_discret().node_col_map()->LID(iter->get_id());
-    crosslinker_data_[cl_lid]->set_b_spots(iter->get_b_spots());
-    crosslinker_data_[cl_lid]->set_number_of_bonds(iter->get_number_of_bonds());
-    crosslinker_data_[cl_lid]->set_position(iter->get_position());
-  }
-
   // setup new double bonds and insert them in doublebondcl_
   create_new_double_bonded_crosslinker_element_pairs(mynewdbondcl);
 
   // store maps
   store_maps_prior_redistribution();
-  update_and_export_crosslinker_data();
   update_and_export_beam_data(false);
 
   // local flag if one proc has new linker
@@ -200,30 +174,9 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::post_setup()
 
   if (not Global::Problem::instance()->restart())
   {
-    // in case of initially set crosslinker
-    if (crosslinking_params_ptr_->total_num_init_crosslinker() > 0)
-      update_my_double_bonds_remote_id_list();
-
-    // store displacement of restart step as displacement state of last redistribution
-    dis_at_last_redistr_ =
-        std::make_shared<Core::LinAlg::Vector<double>>(*bin_discret().dof_row_map(), true);
-    for (int i = 0; i < bin_discret().num_my_row_nodes(); ++i)
-    {
-      CrossLinking::CrosslinkerNode* crosslinker_i =
-          dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret().l_row_node(i));
-
-      // std::vector holding gids of dofs
-      std::vector<int> dofnode = bin_discret().dof(crosslinker_i);
-
-      // loop over all dofs
-      for (unsigned int dim = 0; dim < 3; ++dim)
-      {
-        int doflid = dis_at_last_redistr_->Map().LID(dofnode[dim]);
-        (*dis_at_last_redistr_)[doflid] = crosslinker_i->x()[dim];
-      }
-    }
-    // build up column linker information
-    update_and_export_crosslinker_data();
+    // build up ghosted linker information
+    build_ghosted_bins_per_rank();
+    export_ghost_crosslinker();
     update_and_export_beam_data(false);
   }
 
@@ -650,18 +603,29 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::setup_my_initial_double_b
   int mystartgid = 0;
   for (int i = 0; i < g_state().get_my_rank(); ++i) mystartgid += numnewlinks[i];
 
+  // get largest crosslinker gid over all procs
+  int mymaxgid = -1;
+  for (int i = 0; i < crosslinkers_.size(); ++i)
+    mymaxgid = std::max(mymaxgid, crosslinkers_.gid(i));
+  int maxgid = -1;
+  Core::Communication::max_all(&mymaxgid, &maxgid, 1, com);
+
   // loop over new linker on myrank
-  int gid = bin_discret_ptr()->node_row_map()->MaxAllGID() + 1 + mystartgid;
-  std::vector<double> X(3);
+  std::vector<int> const& matcrosslinkerpertype =
+      crosslinking_params_ptr_->mat_crosslinker_per_type();
+  int gid = maxgid + 1 + mystartgid;
   for (unsigned int i = 0; i < newlinker.size(); ++i)
   {
-    for (unsigned int dim = 0; dim < 3; ++dim) X[dim] = newlinker[i]->get_position()(dim);
+    // crosslinker type is index of material in list of crosslinker materials
+    int const type = static_cast<int>(std::distance(matcrosslinkerpertype.begin(),
+        std::find(matcrosslinkerpertype.begin(), matcrosslinkerpertype.end(), newlinkermatid[i])));
+    Inpar::BeamInteraction::CrosslinkerType const linkertype =
+        crosslinker_material(type).linker_type();
 
-    std::shared_ptr<CrossLinking::CrosslinkerNode> newcrosslinker =
-        std::make_shared<CrossLinking::CrosslinkerNode>(gid, X, g_state().get_my_rank());
-    newcrosslinker->set_material(std::dynamic_pointer_cast<Mat::CrosslinkerMat>(
-        Mat::factory(newlinkermatid[i])));  // HACK HACK HACK
-    bin_discret_ptr()->add_node(newcrosslinker);
+    // add double bonded crosslinker to container, it is sent to the owner of its bin during the
+    // following repartitioning of the problem
+    crosslinkers_.add_crosslinker(
+        gid, type, newlinker[i]->get_position(), 2, newlinker[i]->get_b_spots());
 
     NewDoubleBonds dbondcl;
     std::vector<std::pair<int, int>> bspots = newlinker[i]->get_b_spots();
@@ -671,32 +635,26 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::setup_my_initial_double_b
 
     int colelelid = discret_ptr()->element_col_map()->LID(bspots[0].first);
     int nb_colelelid = discret_ptr()->element_col_map()->LID(bspots[1].first);
-    dbondcl.bspotposs.push_back(beam_data_[colelelid]->get_b_spot_position(
-        newcrosslinker->get_material()->linker_type(), bspots[0].second));
-    dbondcl.bspotposs.push_back(beam_data_[nb_colelelid]->get_b_spot_position(
-        newcrosslinker->get_material()->linker_type(), bspots[1].second));
-    dbondcl.bspottriads.push_back(beam_data_[colelelid]->get_b_spot_triad(
-        newcrosslinker->get_material()->linker_type(), bspots[0].second));
-    dbondcl.bspottriads.push_back(beam_data_[nb_colelelid]->get_b_spot_triad(
-        newcrosslinker->get_material()->linker_type(), bspots[1].second));
+    dbondcl.bspotposs.push_back(
+        beam_data_[colelelid]->get_b_spot_position(linkertype, bspots[0].second));
+    dbondcl.bspotposs.push_back(
+        beam_data_[nb_colelelid]->get_b_spot_position(linkertype, bspots[1].second));
+    dbondcl.bspottriads.push_back(
+        beam_data_[colelelid]->get_b_spot_triad(linkertype, bspots[0].second));
+    dbondcl.bspottriads.push_back(
+        beam_data_[nb_colelelid]->get_b_spot_triad(linkertype, bspots[1].second));
 
     mynewdbondcl[dbondcl.id] = dbondcl;
 
     // set correct states for linker
     newlinker[i]->set_id(gid);
 
-    std::vector<double> newpos(3, 0.0);
-    for (int dim = 0; dim < 3; ++dim) newpos[dim] = newlinker[i]->get_position()(dim);
-    newcrosslinker->set_pos(newpos);
-
     beam_data_[discret_ptr()->element_col_map()->LID(newlinker[i]->get_b_spots()[0].first)]
-        ->add_bond_to_binding_spot(newcrosslinker->get_material()->linker_type(),
-            newlinker[i]->get_b_spots()[0].second, gid);
+        ->add_bond_to_binding_spot(linkertype, newlinker[i]->get_b_spots()[0].second, gid);
 
     if (discret().have_global_element(newlinker[i]->get_b_spots()[1].first))
       beam_data_[discret_ptr()->element_col_map()->LID(newlinker[i]->get_b_spots()[1].first)]
-          ->add_bond_to_binding_spot(newcrosslinker->get_material()->linker_type(),
-              newlinker[i]->get_b_spots()[1].second, gid);
+          ->add_bond_to_binding_spot(linkertype, newlinker[i]->get_b_spots()[1].second, gid);
 
     // update gid
     ++gid;
@@ -705,7 +663,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::setup_my_initial_double_b
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::add_crosslinker_to_bin_discretization()
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::add_initial_crosslinker()
 {
   check_init();
 
@@ -719,11 +677,15 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::add_crosslinker_to_bin_di
   // (only proc 0 is doing this (as the number of crosslinker is manageable)
   std::vector<int> const& numcrosslinkerpertype =
       crosslinking_params_ptr_->num_crosslinker_per_type();
-  std::vector<int> const& matcrosslinkerpertype =
-      crosslinking_params_ptr_->mat_crosslinker_per_type();
+  crosslinkers_.clear();
+  ghost_crosslinkers_.clear();
   int gid = 0;
   if (g_state().get_my_rank() == 0)
   {
+    crosslinkers_.reserve(
+        std::accumulate(numcrosslinkerpertype.begin(), numcrosslinkerpertype.end(), 0));
+    std::vector<std::pair<int, int>> const freebspots(
+        BeamInteraction::CrosslinkerContainer::num_bspots, std::make_pair(-1, -1));
     for (int cltype_i = 0; cltype_i < static_cast<int>(numcrosslinkerpertype.size()); ++cltype_i)
     {
       for (int cltype_i_cl_j = 0; cltype_i_cl_j < numcrosslinkerpertype[cltype_i]; ++cltype_i_cl_j)
@@ -732,20 +694,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::add_crosslinker_to_bin_di
         Core::LinAlg::Matrix<3, 1> Xmat;
         linker_init_box.random_pos_within(Xmat, Global::Problem::instance()->random());
 
-        std::vector<double> X(3);
-        for (int dim = 0; dim < 3; ++dim) X[dim] = Xmat(dim);
-
-        // construct node, init data container, set material and add to bin discret
-        std::shared_ptr<CrossLinking::CrosslinkerNode> newcrosslinker =
-            std::make_shared<CrossLinking::CrosslinkerNode>(gid++, X, g_state().get_my_rank());
-        newcrosslinker->set_material(matcrosslinkerpertype[cltype_i]);
-        bin_discret_ptr()->add_node(newcrosslinker);
+        crosslinkers_.add_crosslinker(gid++, cltype_i, Xmat, 0, freebspots);
       }
     }
   }
-
-  // set row map of newly created linker discretization
-  bin_discret_ptr()->fill_complete(false, false, false);
 }
 
 /*-------------------------------------------------------------------------------*
@@ -760,15 +712,11 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::reset()
     std::shared_ptr<BeamInteraction::BeamLink> elepairptr = iter.second;
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-
-    CrossLinking::CrosslinkerNode* cl_i =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->g_node(elepairptr->id()));
     // safety check
-    BeamInteraction::Data::CrosslinkerData const* cldata_i = crosslinker_data_[cl_i->lid()].get();
-
-    if (cldata_i->get_number_of_bonds() != 2)
-      FOUR_C_THROW("Cl with gid %i Owner %i on myrank %i and numbonds %i", elepairptr->id(),
-          cl_i->owner(), g_state_ptr()->get_my_rank(), cldata_i->get_number_of_bonds());
+    const int cl_index = crosslinkers_.index_of(elepairptr->id());
+    if (cl_index < 0 or crosslinkers_.number_of_bonds(cl_index) != 2)
+      FOUR_C_THROW("Cl with gid %i on myrank %i is not a row crosslinker with two bonds",
+          elepairptr->id(), g_state_ptr()->get_my_rank());
 #endif
 
     // init positions and triads
@@ -993,50 +941,26 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::pre_update_step_element(b
 {
   check_init_setup();
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-  // safety check
-  if (not dis_at_last_redistr_->Map().SameAs(*bin_discret().dof_row_map()))
-    FOUR_C_THROW(
-        "current linker dof map and map of disp vector after last redistribution are\n "
-        "are not the same. Something went wrong");
-#endif
-
-  linker_disnp_ =
-      std::make_shared<Core::LinAlg::Vector<double>>(*bin_discret().dof_row_map(), true);
-  Core::LinAlg::Vector<double> dis_increment(*bin_discret().dof_row_map(), true);
-
+  // get maximal movement of a linker since last redistribution
   Core::LinAlg::Matrix<3, 1> d;
   Core::LinAlg::Matrix<3, 1> ref;
-  int doflid[3];
-
-  for (int i = 0; i < bin_discret().num_my_row_nodes(); ++i)
+  double maxdisincr = 0.0;
+  for (int i = 0; i < crosslinkers_.size(); ++i)
   {
-    d.clear();
-    ref.clear();
-
-    // get a pointer at i-th row node
-    Core::Nodes::Node* node = bin_discret().l_row_node(i);
-
-    // get GIDs of this node's degrees of freedom
-    std::vector<int> dofnode = bin_discret().dof(node);
-
     for (int dim = 0; dim < 3; ++dim)
     {
-      doflid[dim] = dis_at_last_redistr_->Map().LID(dofnode[dim]);
-      d(dim) = (*dis_at_last_redistr_)[doflid[dim]];
-      (*linker_disnp_)[doflid[dim]] = ref(dim) = node->x()[dim];
+      d(dim) = crosslinkers_.reference_position(i)[dim];
+      ref(dim) = crosslinkers_.position(i)[dim];
     }
     // unshift
     periodic_bounding_box().un_shift_3d(d, ref);
 
-    for (int dim = 0; dim < 3; ++dim) (dis_increment)[doflid[dim]] = d(dim) - ref(dim);
+    for (int dim = 0; dim < 3; ++dim) maxdisincr = std::max(maxdisincr, std::abs(d(dim) - ref(dim)));
   }
 
   // get maximal displacement increment since last redistribution over all procs
-  std::array<double, 2> extrema = {0.0, 0.0};
-  dis_increment.MinValue(&extrema[0]);
-  dis_increment.MaxValue(&extrema[1]);
-  const double gmaxdisincr = std::max(-extrema[0], extrema[1]);
+  double gmaxdisincr = 0.0;
+  Core::Communication::max_all(&maxdisincr, &gmaxdisincr, 1, discret().get_comm());
 
   // some screen output
   if (g_state().get_my_rank() == 0)
@@ -1051,11 +975,14 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::pre_update_step_element(b
 
   if (linker_redist or beam_redist)
   {
-    // current displacement state gets new reference state
-    dis_at_last_redistr_ = std::make_shared<Core::LinAlg::Vector<double>>(*linker_disnp_);
-    // transfer crosslinker to new bins
-    std::shared_ptr<std::list<int>> lostcl = beam_crosslinker_handler_ptr()->transfer_linker(true);
-    if (not lostcl->empty())
+    // transfer crosslinker to new bins, current positions get new reference positions
+    std::array<int, 2> mynumlinker = {crosslinkers_.size(), 0};
+    distribute_crosslinker_to_bins(*bin_discret().element_row_map());
+    mynumlinker[1] = crosslinkers_.size();
+
+    std::array<int, 2> numlinker = {0, 0};
+    Core::Communication::sum_all(mynumlinker.data(), numlinker.data(), 2, discret().get_comm());
+    if (numlinker[0] != numlinker[1])
       FOUR_C_THROW("Crosslinker got lost during transfer, something went wrong");
   }
 
@@ -1069,19 +996,13 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_step_element(
 {
   check_init_setup();
 
-  if (repartition_was_done)
-  {
-    // adapt map of vector to map after redistribution
-    BeamInteraction::Utils::update_dof_map_of_vector(*bin_discret_ptr(), dis_at_last_redistr_);
-
-    // update double bonded linker
-    update_my_double_bonds_after_redistribution();
-  }
+  // ghosting of bins might have changed
+  if (repartition_was_done) build_ghosted_bins_per_rank();
 
-  // gather data for all column crosslinker and column beams initially
+  // gather data for all ghosted crosslinker and column beams
   // this needs to be done every time since e.g. beam positions and triads
   // change every time
-  update_and_export_crosslinker_data();
+  export_ghost_crosslinker();
   update_and_export_beam_data();
 
   // manage binding and unbinding events of crosslinker
@@ -1131,7 +1052,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::runtime_output_step_state
       "BeamInteraction::SUBMODELEVALUATOR::Crosslinking::"
       "runtime_output_step_state");
 
-  if (visualization_output_writer_ptr_ != nullptr) write_output_runtime_structure();
+  if (visualization_manager_ptr_ != nullptr) write_output_runtime_structure();
 }
 
 /*----------------------------------------------------------------------------*
@@ -1140,11 +1061,11 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::init_output_runtime_struc
 {
   check_init();
 
-  visualization_output_writer_ptr_ =
-      std::make_shared<Core::IO::DiscretizationVisualizationWriterNodes>(bin_discret_ptr(),
-          Core::IO::visualization_parameters_factory(
-              Global::Problem::instance()->io_params().sublist("RUNTIME VTK OUTPUT"),
-              *Global::Problem::instance()->output_control_file(), g_state().get_time_n()));
+  visualization_manager_ptr_ = std::make_shared<Core::IO::VisualizationManager>(
+      Core::IO::visualization_parameters_factory(
+          Global::Problem::instance()->io_params().sublist("RUNTIME VTK OUTPUT"),
+          *Global::Problem::instance()->output_control_file(), g_state().get_time_n()),
+      bin_discret_ptr()->get_comm(), bin_discret_ptr()->name());
 }
 
 /*----------------------------------------------------------------------------*
@@ -1153,177 +1074,70 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::write_output_runtime_stru
 {
   check_init_setup();
 
-  // ************** BEGIN RUNTIME VTP OUTPUT *** OPTION 1: DISCRETIZATION *********
-  // this section compiles and seems to do the job correctly :-)
-
-  // initialize the writer object
-  visualization_output_writer_ptr_->set_geometry_from_discretization();
-
-  // append all desired node and dof output data to the writer object's storage
-  Core::FE::Discretization const& bindis = bin_discret();
-  // node
-  std::shared_ptr<Core::LinAlg::Vector<double>> numbond =
-      Core::LinAlg::create_vector(*bindis.node_row_map(), true);
-  std::shared_ptr<Core::LinAlg::Vector<double>> owner =
-      Core::LinAlg::create_vector(*bindis.node_row_map(), true);
-
-  // dof
-  std::shared_ptr<Core::LinAlg::Vector<double>> dis =
-      Core::LinAlg::create_vector(*bindis.dof_row_map(), true);
-  std::shared_ptr<Core::LinAlg::Vector<double>> orientation =
-      Core::LinAlg::create_vector(*bindis.dof_row_map(), true);
-  std::shared_ptr<Core::LinAlg::Vector<double>> force =
-      Core::LinAlg::create_vector(*bindis.dof_row_map(), true);
-
-  fill_state_data_vectors_for_output(*dis, *orientation, *numbond, *owner, *force);
-
-  // append displacement vector if desired
-  // append displacement if desired
-  //   if ( global_in_output().get_runtime_vtp_output_params()->output_displacement_state() )
-  //     visualization_output_writer_ptr_-->append_dof_based_result_data_vector( dis, 3,
-  //     "displacement"
-  //     );
+  // set geometry manually, each row crosslinker is one point
+  const unsigned int num_spatial_dimensions = 3;
+  const int num_row_points = crosslinkers_.size();
 
-  // append owner if desired
-  if (g_in_output().get_runtime_vtp_output_params()->output_owner())
-    visualization_output_writer_ptr_->append_node_based_result_data_vector(*owner, 1, "owner");
+  // get and prepare storage for point coordinate values
+  std::vector<double>& point_coordinates =
+      visualization_manager_ptr_->get_visualization_data().get_point_coordinates();
+  point_coordinates.clear();
+  point_coordinates.reserve(num_spatial_dimensions * num_row_points);
 
-  // append orientation vector if desired
-  if (g_in_output().get_runtime_vtp_output_params()->output_orientation_and_length())
-    visualization_output_writer_ptr_->append_dof_based_result_data_vector(
-        *orientation, 3, "orientation");
+  // init desired output vectors
+  std::vector<double> owner(num_row_points, g_state().get_my_rank());
+  std::vector<double> numberofbonds(num_row_points, 0.0);
+  std::vector<double> orientation(num_row_points * num_spatial_dimensions, 0.0);
+  std::vector<double> force(num_row_points * num_spatial_dimensions, 0.0);
+  Core::LinAlg::SerialDenseVector bspotforce(num_spatial_dimensions);
 
-  // append number of bonds if desired
-  if (g_in_output().get_runtime_vtp_output_params()->output_number_of_bonds())
-    visualization_output_writer_ptr_->append_node_based_result_data_vector(
-        *numbond, 1, "numberofbonds");
-
-  // append number of bonds if desired
-  if (g_in_output().get_runtime_vtp_output_params()->output_linking_force())
-    visualization_output_writer_ptr_->append_dof_based_result_data_vector(*force, 3, "force");
-
-  // finalize everything and write all required files to file system
-  visualization_output_writer_ptr_->write_to_disk(g_state().get_time_n(), g_state().get_step_n());
-
-  // ************** BEGIN RUNTIME VTP OUTPUT *** OPTION 2: DIRECTLY *********
-  // this section is just to get the idea and needs some minor modifications (indicated by Fixme)
-  // this may serve as a template for visualization of stochastic&viscous forces, contact forces,
-  // ...
-
-  //  std::shared_ptr<RuntimeVtpWriter> vtp_writer_ptr =
-  //      Teuchos::rcp( new RuntimeVtpWriter() );
-  //
-  //  // Todo: we need a better upper bound for total number of time steps here
-  //  // however, this 'only' affects the number of leading zeros in the vtk file names
-  //  const unsigned int num_timesteps_in_simulation_upper_bound = 1000000;
-  //
-  //
-  //  // initialize the writer object
-  //  vtp_writer_ptr->initialize();   // Fixme
-  //
-  //  // set geometry manually
-  //  const unsigned int num_spatial_dimensions = 3;
-  //  unsigned int num_row_points = 2000;
-  //
-  //  // get and prepare storage for point coordinate values
-  //  std::vector< double >& point_coordinates = vtp_writer_ptr->GetPointCoordinateVector();
-  //  point_coordinates.clear();
-  //  point_coordinates.reserve( num_spatial_dimensions * num_row_points );
-  //
-  //
-  //  // loop over my points and collect the geometry/grid data, i.e. reference positions of nodes
-  //  for (unsigned int inode=0; inode < num_row_points; ++inode)
-  //  {
-  //    const Core::Nodes::Node* node = BinDiscretPtr()->lRowNode(inode);
-  //
-  //    for (unsigned int idim=0; idim<num_spatial_dimensions; ++idim)
-  //      point_coordinates.push_back( node->X()[idim] );
-  //  }
-  //
-  //
-  //  // reset time and time step and geometry name in the writer object
-  //  vtp_writer_ptr->SetupForNewTimeStepAndGeometry(
-  //      global_state().get_time_n(), global_state().get_step_n(), BinDiscretPtr()->name() );
-  //
-  //
-  //
-  //  // append all desired output data to the writer object's storage
-  //
-  //  // number of bonds: collect data and append to visualization results if desired
-  //  std::vector< double > num_bonds( num_row_points );
-  //
-  //  for ( unsigned int i = 0; i < num_row_points; ++i )
-  //  {
-  //    CrossLinking::CrosslinkerNode *crosslinker_i =
-  //        dynamic_cast< CrossLinking::CrosslinkerNode* >( bindis.lRowNode(i) );
-  //
-  //    num_bonds[i] = crosslinker_i->ClData()->GetNumberOfBonds();
-  //  }
-  //
-  //  vtp_writer_ptr->AppendVisualizationPointDataVector( num_bonds, 1, "num_bonds" );
-  //
-  //
-  //
-  //  // finalize everything and write all required VTU files to filesystem
-  //  vtp_writer_ptr->WriteFiles();
-  //
-  //
-  //  // write a collection file summarizing all previously written files
-  //  vtp_writer_ptr->WriteCollectionFileOfAllWrittenFiles();   // Fixme
-  // ************** END RUNTIME VTP OUTPUT ***************************************
-}
-
-/*----------------------------------------------------------------------*
- *----------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::fill_state_data_vectors_for_output(
-    Core::LinAlg::Vector<double>& displacement, Core::LinAlg::Vector<double>& orientation,
-    Core::LinAlg::Vector<double>& numberofbonds, Core::LinAlg::Vector<double>& owner,
-    Core::LinAlg::Vector<double>& force) const
-{
-  check_init_setup();
-  Core::FE::Discretization const& bindis = bin_discret();
-
-  const unsigned int num_spatial_dim = 3;
-  Core::LinAlg::SerialDenseVector bspotforce(num_spatial_dim);
-
-  // todo: this is of course not nice, this needs to be done somewhere else
-  for (int i = 0; i < bindis.num_my_row_nodes(); ++i)
+  for (int i = 0; i < num_row_points; ++i)
   {
-    Core::Nodes::Node* crosslinker_i = bindis.l_row_node(i);
-    // std::vector holding gids of dofs
-    std::vector<int> dofnode = bindis.dof(crosslinker_i);
-    int numbonds = crosslinker_data_[crosslinker_i->lid()]->get_number_of_bonds();
+    const int numbonds = crosslinkers_.number_of_bonds(i);
+    numberofbonds[i] = numbonds;
 
     std::shared_ptr<BeamInteraction::BeamLink> beamlink = nullptr;
-
     if (numbonds == 2)
     {
-      beamlink = doublebondcl_.at(crosslinker_i->id());
+      beamlink = doublebondcl_.at(crosslinkers_.gid(i));
       beamlink->get_binding_spot_force(0, bspotforce);
     }
 
-    // loop over all dofs
-    for (unsigned int dim = 0; dim < num_spatial_dim; ++dim)
+    for (unsigned int dim = 0; dim < num_spatial_dimensions; ++dim)
     {
-      int doflid = displacement.Map().LID(dofnode[dim]);
-      (displacement)[doflid] = crosslinker_i->x()[dim];
+      point_coordinates.push_back(crosslinkers_.position(i)[dim]);
 
       if (numbonds == 2)
       {
-        (orientation)[doflid] =
+        orientation[i * num_spatial_dimensions + dim] =
             beamlink->get_bind_spot_pos1()(dim) - beamlink->get_bind_spot_pos2()(dim);
-        (force)[doflid] = bspotforce(dim);
-      }
-      else
-      {
-        (orientation)[doflid] = 0.0;
-        (force)[doflid] = 0.0;
+        force[i * num_spatial_dimensions + dim] = bspotforce(dim);
       }
     }
-
-    (numberofbonds)[i] = numbonds;
-    (owner)[i] = crosslinker_i->owner();
   }
+
+  // append all desired output data to the writer object's storage
+  Core::IO::VisualizationData& visualization_data =
+      visualization_manager_ptr_->get_visualization_data();
+
+  // append owner if desired
+  if (g_in_output().get_runtime_vtp_output_params()->output_owner())
+    visualization_data.set_point_data_vector("owner", owner, 1);
+
+  // append orientation vector if desired
+  if (g_in_output().get_runtime_vtp_output_params()->output_orientation_and_length())
+    visualization_data.set_point_data_vector("orientation", orientation, num_spatial_dimensions);
+
+  // append number of bonds if desired
+  if (g_in_output().get_runtime_vtp_output_params()->output_number_of_bonds())
+    visualization_data.set_point_data_vector("numberofbonds", numberofbonds, 1);
+
+  // append linker force if desired
+  if (g_in_output().get_runtime_vtp_output_params()->output_linking_force())
+    visualization_data.set_point_data_vector("force", force, num_spatial_dimensions);
+
+  // finalize everything and write all required files to file system
+  visualization_manager_ptr_->write_to_disk(g_state().get_time_n(), g_state().get_step_n());
 }
 
 /*----------------------------------------------------------------------*
@@ -1351,21 +1165,13 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::write_restart(
   std::swap(*db_linker, linker_buffer());
 
   // -------------------------------------------------------------------------
-  // 2) write crosslinker data
+  // 2) write crosslinker
   // -------------------------------------------------------------------------
-  Core::Communication::PackBuffer cldata_buffer;
-  unsigned int numrowcl = bin_discret().num_my_row_nodes();
-  for (unsigned int i = 0; i < numrowcl; ++i)
-  {
-    int const clgid = bin_discret().node_row_map()->GID(i);
-    std::shared_ptr<BeamInteraction::Data::CrosslinkerData> cl_data_i =
-        crosslinker_data_[bin_discret().node_col_map()->LID(clgid)];
-
-    cl_data_i->pack(cldata_buffer);
-  }
+  Core::Communication::PackBuffer cl_buffer;
+  crosslinkers_.pack(cl_buffer);
 
   std::shared_ptr<std::vector<char>> cldata = std::make_shared<std::vector<char>>();
-  std::swap(*cldata, cldata_buffer());
+  std::swap(*cldata, cl_buffer());
 
   // -------------------------------------------------------------------------
   // 3) beam data
@@ -1393,7 +1199,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::write_restart(
   // write data
   // -------------------------------------------------------------------------
   bin_writer.write_char_data("Linker", *db_linker);
-  bin_writer.write_char_data("ClData", *cldata);
+  bin_writer.write_char_data("Crosslinker", *cldata);
   bin_writer.write_char_data("BeamData", *beamdata);
 }
 
@@ -1402,7 +1208,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::write_restart(
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::pre_read_restart()
 {
   check_init_setup();
-  beam_crosslinker_handler_ptr()->remove_all_linker();
+
+  crosslinkers_.clear();
+  ghost_crosslinkers_.clear();
+  doublebondcl_.clear();
 }
 
 /*----------------------------------------------------------------------------*
@@ -1433,56 +1242,17 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::read_restart(
   }
 
   // -------------------------------------------------------------------------
-  // 2) read crosslinker data
+  // 2) read crosslinker and send them to the owner of their bin
   // -------------------------------------------------------------------------
+  std::shared_ptr<std::vector<char>> cl_charvec;
+  bin_reader.read_char_vector(cl_charvec, "Crosslinker");
 
-  std::shared_ptr<std::vector<char>> cldata_charvec;
-  bin_reader.read_char_vector(cldata_charvec, "ClData");
-  crosslinker_data_.resize(bin_discret().num_my_col_nodes());
-
-  std::map<int, std::shared_ptr<BeamInteraction::Data::CrosslinkerData>> cl_not_owned;
-  std::set<int> not_owned_gids;
-  std::map<int, std::vector<char>> cl_datapacks;
-  std::vector<int> read_node_ids;
-  Core::Communication::UnpackBuffer buffer(*cldata_charvec);
-  while (!buffer.at_end())
   {
-    // unpack
-    std::shared_ptr<BeamInteraction::Data::CrosslinkerData> cl_data(
-        BeamInteraction::Data::create_data_container<BeamInteraction::Data::CrosslinkerData>(
-            buffer));
-
-    int const cl_gid = cl_data->get_id();
-    read_node_ids.push_back(cl_gid);
-
-    // repack it for communication to find owner
-    Core::Communication::PackBuffer data;
-    cl_data->pack(data);
-    cl_datapacks[cl_gid].insert(cl_datapacks[cl_gid].end(), data().begin(), data().end());
+    Core::Communication::UnpackBuffer buffer(*cl_charvec);
+    crosslinkers_.unpack(buffer);
   }
 
-  // build dummy map according to read data on myrank
-  Epetra_Map dummy_cl_map(-1, read_node_ids.size(), read_node_ids.data(), 0,
-      Core::Communication::as_epetra_comm(bin_discret().get_comm()));
-
-  // build exporter object
-  std::shared_ptr<Core::Communication::Exporter> exporter =
-      std::make_shared<Core::Communication::Exporter>(
-          dummy_cl_map, *bin_discret().node_col_map(), bin_discret().get_comm());
-
-  // export
-  exporter->do_export(cl_datapacks);
-
-  // rebuild data container
-  crosslinker_data_.resize(bin_discret().num_my_col_nodes());
-  for (auto& iter : cl_datapacks)
-  {
-    Core::Communication::UnpackBuffer cl_buffer(iter.second);
-    std::shared_ptr<BeamInteraction::Data::CrosslinkerData> cl_data(
-        BeamInteraction::Data::create_data_container<BeamInteraction::Data::CrosslinkerData>(
-            cl_buffer));
-    crosslinker_data_[bin_discret().node_col_map()->LID(cl_data->get_id())] = cl_data;
-  }
+  distribute_crosslinker_to_bins(*bin_discret().element_row_map());
 
   // -------------------------------------------------------------------------
   // 3) read beam data
@@ -1491,8 +1261,6 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::read_restart(
   bin_reader.read_char_vector(beamdata_charvec, "BeamData");
   beam_data_.resize(discret().num_my_col_elements());
 
-  std::map<int, std::shared_ptr<BeamInteraction::Data::BeamData>> beams_not_owned;
-  not_owned_gids.clear();
   std::map<int, std::vector<char>> beam_datapacks;
   std::vector<int> read_ele_ids;
   Core::Communication::UnpackBuffer beamdata_buffer(*beamdata_charvec);
@@ -1517,8 +1285,9 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::read_restart(
       read_ele_ids.data(), 0, Core::Communication::as_epetra_comm(discret().get_comm()));
 
   // build exporter object
-  exporter = std::make_shared<Core::Communication::Exporter>(
-      *dummy_beam_map, *discret().element_col_map(), discret().get_comm());
+  std::shared_ptr<Core::Communication::Exporter> exporter =
+      std::make_shared<Core::Communication::Exporter>(
+          *dummy_beam_map, *discret().element_col_map(), discret().get_comm());
 
   // export
   exporter->do_export(beam_datapacks);
@@ -1546,23 +1315,9 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::post_read_restart()
   // bring each object in doublebondcl_ map to its correct owner
   update_my_double_bonds_remote_id_list();
 
-  // store displacement of restart step as displacement state of last redistribution
-  dis_at_last_redistr_ =
-      std::make_shared<Core::LinAlg::Vector<double>>(*bin_discret().dof_row_map(), true);
-  for (int i = 0; i < bin_discret().num_my_row_nodes(); ++i)
-  {
-    Core::Nodes::Node* crosslinker_i = bin_discret().l_row_node(i);
-
-    // std::vector holding gids of dofs
-    std::vector<int> dofnode = bin_discret().dof(crosslinker_i);
-
-    // loop over all dofs
-    for (unsigned int dim = 0; dim < 3; ++dim)
-    {
-      int doflid = dis_at_last_redistr_->Map().LID(dofnode[dim]);
-      (*dis_at_last_redistr_)[doflid] = crosslinker_i->x()[dim];
-    }
-  }
+  // build up ghosted linker information
+  build_ghosted_bins_per_rank();
+  export_ghost_crosslinker();
 }
 
 /*----------------------------------------------------------------------*
@@ -1580,49 +1335,29 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
 {
   check_init_setup();
 
-  bool map_changed = false;
-  if (not(cl_noderowmap_prior_redistr_->SameAs(*bin_discret().node_row_map()) and
-          cl_nodecolmap_prior_redistr_->SameAs(*bin_discret().node_col_map())))
-    map_changed = true;
+  int const myrank = g_state().get_my_rank();
 
   std::set<int> colbinsext;
   for (auto const& iter : colbins)
   {
-    // get current bin
-    Core::Elements::Element* currbin = bin_discret().g_element(iter);
-    // get all crosslinker in current bin
-    Core::Nodes::Node** clincurrentbin = currbin->nodes();
+    // bins owned by another proc might contain bonded crosslinker that are unknown here,
+    // therefore their neighborhood is ghosted in any case
+    bool relevant = (bin_discret().g_element(iter)->owner() != myrank);
 
-    // loop over all crosslinker in CurrentBin
-    for (int i = 0; i < currbin->num_node(); ++i)
+    // loop over all crosslinker in current row bin
+    auto const [first, last] = crosslinkers_.bin_range(iter);
+    for (int i = first; i < last and not relevant; ++i)
+      relevant = (crosslinkers_.number_of_bonds(i) > 0);
+
+    if (relevant)
     {
-      if (map_changed or (crosslinker_data_.size() == 0) or
-          (crosslinker_data_[clincurrentbin[i]->lid()]->get_number_of_bonds() > 0))
-      {
-        std::vector<int> binvec;
-        bin_strategy().get_neighbor_bin_ids(iter, binvec);
-        colbinsext.insert(binvec.begin(), binvec.end());
-        // go to next bin
-        break;
-      }
+      std::vector<int> binvec;
+      bin_strategy().get_neighbor_bin_ids(iter, binvec);
+      colbinsext.insert(binvec.begin(), binvec.end());
     }
   }
 
   colbins.insert(colbinsext.begin(), colbinsext.end());
-
-  // the following would be a default additional one ghost layer
-
-  //
-  //  std::set< int > colbinsext(colbins.begin(),colbins.end());
-  //  std::set< int >::const_iterator biniter;
-  //  for ( biniter = colbinsext.begin(); biniter != colbinsext.end() ; ++biniter )
-  //  {
-  //    std::vector< int > binvec;
-  //    BinStrategy().get_neighbor_and_own_bin_ids( *biniter, binvec );
-  //    colbinsext.insert( binvec.begin(), binvec.end() );
-  //  }
-  //
-  //  colbins.insert( colbinsext.begin(), colbinsext.end() );
 }
 
 /*-------------------------------------------------------------------------------*
@@ -1632,36 +1367,20 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::get_half_interaction_dist
 {
   check_init_setup();
 
-  // loop over all linker of all linker types and get largest linker (also
-  // considering tolerance)
-  double curr_ia_dist = -1.0;
-  double local_half_interaction_distance = 0.0;
-  const int numrowcl = bin_discret_ptr()->num_my_row_nodes();
-  for (int rowcli = 0; rowcli < numrowcl; ++rowcli)
+  // loop over all linker types and get largest linker (also considering tolerance), the
+  // crosslinker materials are known on all procs
+  half_interaction_distance_ = 0.0;
+  for (auto const& material : crosslinker_materials_)
   {
-    // get current linker
-    CrossLinking::CrosslinkerNode* crosslinker_i =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->l_row_node(rowcli));
-
-    curr_ia_dist = 0.5 * (crosslinker_i->get_material()->linking_length() +
-                             crosslinker_i->get_material()->linking_length_tolerance());
-
-    local_half_interaction_distance = (curr_ia_dist > local_half_interaction_distance)
-                                          ? curr_ia_dist
-                                          : local_half_interaction_distance;
+    double const curr_ia_dist =
+        0.5 * (material->linking_length() + material->linking_length_tolerance());
+    half_interaction_distance_ = std::max(curr_ia_dist, half_interaction_distance_);
   }
 
-  // get global maximum
-  double global_half_interaction_distance = 0.0;
-  // build sum over all procs
-  MPI_Allreduce(&local_half_interaction_distance, &global_half_interaction_distance, 1, MPI_DOUBLE,
-      MPI_MAX, discret().get_comm());
-  half_interaction_distance_ = global_half_interaction_distance;
-
   // some screen output
   if (g_state().get_my_rank() == 0)
     Core::IO::cout(Core::IO::verbose) << " beam to beam crosslinking half interaction distance "
-                                      << global_half_interaction_distance << Core::IO::endl;
+                                      << half_interaction_distance_ << Core::IO::endl;
 
   half_interaction_distance = (half_interaction_distance_ > half_interaction_distance)
                                   ? half_interaction_distance_
@@ -1674,41 +1393,34 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
 {
   check_init_setup();
 
+  // free crosslinkers are collected and diffused in one sweep
+  std::vector<int> freeindices;
+  freeindices.reserve(crosslinkers_.size());
+
   // loop over all row crosslinker (beam binding status not touched here)
-  const int numrowcl = bin_discret_ptr()->num_my_row_nodes();
-  for (int rowcli = 0; rowcli < numrowcl; ++rowcli)
+  for (int i = 0; i < crosslinkers_.size(); ++i)
   {
-    // get current linker
-    CrossLinking::CrosslinkerNode* crosslinker_i =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->l_row_node(rowcli));
-
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-    if (crosslinker_i->num_element() != 1)
-      FOUR_C_THROW("More than one element for this crosslinker");
-#endif
-
-    BeamInteraction::Data::CrosslinkerData* cldata_i =
-        crosslinker_data_[crosslinker_i->lid()].get();
+    const int linkertype = crosslinker_material(crosslinkers_.type(i)).linker_type();
 
     // different treatment according to number of bonds a crosslinker has
-    switch (cldata_i->get_number_of_bonds())
+    switch (crosslinkers_.number_of_bonds(i))
     {
       case 0:
       {
         // crosslinker has zero bonds, i.e. is free to diffuse according to
-        // brownian dynamics
-        diffuse_unbound_crosslinker(crosslinker_i, cldata_i);
+        // brownian dynamics (done for all free crosslinker at once below)
+        freeindices.push_back(i);
         break;
       }
       case 1:
       {
         // get clbspot that is currently bonded
-        int occbspotid = get_single_occupied_cl_bspot(cldata_i->get_b_spots());
+        int occbspotid = get_single_occupied_cl_bspot(crosslinkers_.bspots(i));
 
         // get current position of binding spot of filament partner
         // note: we can not use our beam data container, as bspot position is not current position
         // (as this is the result of a sum, you can not have a reference to that)
-        const int elegid = cldata_i->get_b_spots()[occbspotid].first;
+        const int elegid = crosslinkers_.bspot(i, occbspotid).first;
 
         Discret::Elements::Beam3Base* ele =
             dynamic_cast<Discret::Elements::Beam3Base*>(discret_ptr()->g_element(elegid));
@@ -1720,7 +1432,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
           FOUR_C_THROW(
               "Crosslinker has %i bonds but his binding partner with gid %i "
               "is \nnot ghosted/owned on proc %i (owner of crosslinker)",
-              cldata_i->get_number_of_bonds(), elegid, g_state().get_my_rank());
+              crosslinkers_.number_of_bonds(i), elegid, g_state().get_my_rank());
         // safety check
         if (ele == nullptr)
           FOUR_C_THROW(
@@ -1732,17 +1444,12 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
         std::vector<double> eledisp;
         BeamInteraction::Utils::get_current_unshifted_element_dis(discret(), ele,
             *beam_interaction_data_state_ptr()->get_dis_col_np(), periodic_bounding_box(), eledisp);
-        ele->get_pos_of_binding_spot(bbspotpos, eledisp,
-            crosslinker_i->get_material()->linker_type(),
-            cldata_i->get_b_spots()[occbspotid].second, periodic_bounding_box());
+        ele->get_pos_of_binding_spot(bbspotpos, eledisp, linkertype,
+            crosslinkers_.bspot(i, occbspotid).second, periodic_bounding_box());
 
         // note: a crosslinker can not leave the computational domain here, as no beam binding
         // spot can be outside the periodic box at this point
-        std::vector<double> newpos(3, 0.0);
-        for (int dim = 0; dim < 3; ++dim) newpos[dim] = bbspotpos(dim);
-
-        crosslinker_i->set_pos(newpos);
-        cldata_i->set_position(bbspotpos);
+        crosslinkers_.set_position(i, bbspotpos);
 
         break;
       }
@@ -1753,10 +1460,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
         // -----------------------------------------------------------------
         // partner one
         // -----------------------------------------------------------------
-        int elegid = cldata_i->get_b_spots()[0].first;
+        int elegid = crosslinkers_.bspot(i, 0).first;
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-        if (elegid < 0 or cldata_i->get_b_spots()[0].second < 0)
+        if (elegid < 0 or crosslinkers_.bspot(i, 0).second < 0)
           FOUR_C_THROW(
               " double bonded crosslinker has stored beam partner gid or loc bsponum of -1, "
               " something went wrong");
@@ -1766,7 +1473,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
           FOUR_C_THROW(
               "Crosslinker has %i bonds but his binding partner with gid %i "
               "is not \nghosted/owned on proc %i (owner of crosslinker)",
-              cldata_i->get_number_of_bonds(), elegid, g_state().get_my_rank());
+              crosslinkers_.number_of_bonds(i), elegid, g_state().get_my_rank());
 #endif
 
         Discret::Elements::Beam3Base* ele =
@@ -1784,18 +1491,17 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
         std::vector<double> eledisp;
         BeamInteraction::Utils::get_current_unshifted_element_dis(discret(), ele,
             *beam_interaction_data_state_ptr()->get_dis_col_np(), periodic_bounding_box(), eledisp);
-        ele->get_pos_of_binding_spot(bbspotposone, eledisp,
-            crosslinker_i->get_material()->linker_type(), cldata_i->get_b_spots()[0].second,
-            periodic_bounding_box());
+        ele->get_pos_of_binding_spot(bbspotposone, eledisp, linkertype,
+            crosslinkers_.bspot(i, 0).second, periodic_bounding_box());
 
         // -----------------------------------------------------------------
         // partner two
         // -----------------------------------------------------------------
-        elegid = cldata_i->get_b_spots()[1].first;
+        elegid = crosslinkers_.bspot(i, 1).first;
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
         // safety check
-        if (elegid < 0 or cldata_i->get_b_spots()[1].second < 0)
+        if (elegid < 0 or crosslinkers_.bspot(i, 1).second < 0)
           FOUR_C_THROW(
               " double bonded crosslinker has stored beam partner gid or loc bsponum of -1, "
               " something went wrong");
@@ -1804,7 +1510,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
           FOUR_C_THROW(
               "Crosslinker has %i bonds but his binding partner with gid %i "
               "is \nnot ghosted/owned on proc %i (owner of crosslinker)",
-              cldata_i->get_number_of_bonds(), elegid, g_state().get_my_rank());
+              crosslinkers_.number_of_bonds(i), elegid, g_state().get_my_rank());
 #endif
 
         ele = dynamic_cast<Discret::Elements::Beam3Base*>(discret_ptr()->g_element(elegid));
@@ -1820,87 +1526,85 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_crosslinker()
         Core::LinAlg::Matrix<3, 1> bbspotpostwo;
         BeamInteraction::Utils::get_current_unshifted_element_dis(discret(), ele,
             *beam_interaction_data_state_ptr()->get_dis_col_np(), periodic_bounding_box(), eledisp);
-        ele->get_pos_of_binding_spot(bbspotpostwo, eledisp,
-            crosslinker_i->get_material()->linker_type(), cldata_i->get_b_spots()[1].second,
-            periodic_bounding_box());
+        ele->get_pos_of_binding_spot(bbspotpostwo, eledisp, linkertype,
+            crosslinkers_.bspot(i, 1).second, periodic_bounding_box());
 
         Core::LinAlg::Matrix<3, 1> clpos(true);
         set_position_of_double_bonded_crosslinker_pb_cconsistent(clpos, bbspotposone, bbspotpostwo);
 
-        std::vector<double> newpos(3, 0.0);
-        for (int dim = 0; dim < 3; ++dim) newpos[dim] = clpos(dim);
-
-        crosslinker_i->set_pos(newpos);
-        cldata_i->set_position(clpos);
+        crosslinkers_.set_position(i, clpos);
 
         break;
       }
       default:
       {
         FOUR_C_THROW(
-            "Unrealistic number %i of bonds for a crosslinker.", cldata_i->get_number_of_bonds());
+            "Unrealistic number %i of bonds for a crosslinker.", crosslinkers_.number_of_bonds(i));
         exit(EXIT_FAILURE);
       }
     }
   }
+
+  diffuse_unbound_crosslinker(freeindices);
 }
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::diffuse_unbound_crosslinker(
-    Core::Nodes::Node* crosslinker_i, BeamInteraction::Data::CrosslinkerData* cldata_i)
+    std::vector<int> const& freeindices)
 {
   check_init();
 
-  CrossLinking::CrosslinkerNode* crosslinker =
-      dynamic_cast<CrossLinking::CrosslinkerNode*>(crosslinker_i);
+  const int numfreecl = static_cast<int>(freeindices.size());
+  if (numfreecl == 0) return;
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-  if (crosslinker == nullptr) FOUR_C_THROW("Dynamic cast to CrosslinkerNode failed");
-#endif
-
-  // get standard deviation and mean value for crosslinker that are free to
-  // diffuse
-  double standarddev = std::sqrt(2.0 * crosslinking_params_ptr_->kt() /
-                                 (3.0 * M_PI * crosslinking_params_ptr_->viscosity() *
-                                     crosslinker->get_material()->linking_length()) *
-                                 crosslinking_params_ptr_->delta_time());
-  double meanvalue = 0.0;
-  // Set mean value and standard deviation of normal distribution
+  // draw standard normal distributed random numbers for all free crosslinkers at once, they are
+  // scaled with the standard deviation of each crosslinker below
   // FixMe standard deviation = sqrt(variance) check this for potential error !!!
-  Global::Problem::instance()->random()->set_mean_variance(meanvalue, standarddev);
-
-  // diffuse crosslinker according to brownian dynamics
-  Core::LinAlg::Matrix<3, 1> newclpos(true);
   std::vector<double> randvec;
-  int count = 3;
+  Global::Problem::instance()->random()->set_mean_variance(0.0, 1.0);
+  Global::Problem::instance()->random()->normal(randvec, 3 * numfreecl);
+
   // maximal diffusion given by cutoff radius (sqrt(3) = 1.73..)
   double const maxmov = bin_strategy().bin_size_lower_bound() / 1.74;
-  Global::Problem::instance()->random()->normal(randvec, count);
-  for (int dim = 0; dim < 3; ++dim)
+
+  Core::LinAlg::Matrix<3, 1> newclpos(true);
+  for (int i = 0; i < numfreecl; ++i)
   {
-    if (abs(randvec[dim]) > maxmov)
+    const int index = freeindices[i];
+
+    // standard deviation of brownian motion of crosslinker that is free to diffuse
+    double const standarddev =
+        std::sqrt(2.0 * crosslinking_params_ptr_->kt() /
+                  (3.0 * M_PI * crosslinking_params_ptr_->viscosity() *
+                      crosslinker_material(crosslinkers_.type(index)).linking_length()) *
+                  crosslinking_params_ptr_->delta_time());
+
+    // diffuse crosslinker according to brownian dynamics
+    double* clpos = crosslinkers_.position(index);
+    for (int dim = 0; dim < 3; ++dim)
     {
-      double old = randvec[dim];
-      randvec[dim] = (abs(randvec[dim]) / randvec[dim]) * maxmov;
-      Core::IO::cout(Core::IO::verbose) << "Movement of free crosslinker " << crosslinker->id()
-                                        << " was restricted by cutoff radius"
-                                           " in "
-                                        << dim << " direction. " << old << " to " << randvec[dim]
-                                        << "\nThis should not happen to often "
-                                           "to stay physical. Increase cutoff or reduce movement"
-                                        << Core::IO::endl;
+      double randmov = standarddev * randvec[3 * i + dim];
+      if (abs(randmov) > maxmov)
+      {
+        double old = randmov;
+        randmov = (abs(randmov) / randmov) * maxmov;
+        Core::IO::cout(Core::IO::verbose) << "Movement of free crosslinker "
+                                          << crosslinkers_.gid(index)
+                                          << " was restricted by cutoff radius"
+                                             " in "
+                                          << dim << " direction. " << old << " to " << randmov
+                                          << "\nThis should not happen to often "
+                                             "to stay physical. Increase cutoff or reduce movement"
+                                          << Core::IO::endl;
+      }
+      newclpos(dim) = clpos[dim] + randmov;
     }
-    newclpos(dim) = crosslinker->x()[dim] + randvec[dim];
-  }
 
-  // check compliance with periodic boundary conditions
-  periodic_bounding_box().shift_3d(newclpos);
-  std::vector<double> newpos(3, 0.0);
-  for (int dim = 0; dim < 3; ++dim) newpos[dim] = newclpos(dim);
-  crosslinker->set_pos(newpos);
-
-  cldata_i->set_position(newclpos);
+    // check compliance with periodic boundary conditions
+    periodic_bounding_box().shift_3d(newclpos);
+    for (int dim = 0; dim < 3; ++dim) clpos[dim] = newclpos(dim);
+  }
 }
 
 /*-----------------------------------------------------------------------------*
@@ -1947,7 +1651,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::set_position_of_newly_free_crosslinker(
-    CrossLinking::CrosslinkerNode* crosslinker, BeamInteraction::Data::CrosslinkerData* cldata)
+    int index)
 {
   check_init();
 
@@ -1955,54 +1659,47 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::set_position_of_newly_fre
   // of length half the linking length to "reset" crosslink molecule position: it may now
   // reenter or leave the bonding proximity
   // todo: does this make sense?
-  Core::LinAlg::Matrix<3, 1> clpos(cldata->get_position());
+  Core::LinAlg::Matrix<3, 1> clpos(crosslinkers_.position(index));
   Core::LinAlg::Matrix<3, 1> cldeltapos_i;
   std::vector<double> randunivec(3);
   int count = 3;
   Global::Problem::instance()->random()->uni(randunivec, count);
   for (unsigned int dim = 0; dim < 3; ++dim) cldeltapos_i(dim) = randunivec[dim];
 
-  cldeltapos_i.scale(crosslinker->get_material()->linking_length() / cldeltapos_i.norm2());
+  cldeltapos_i.scale(
+      crosslinker_material(crosslinkers_.type(index)).linking_length() / cldeltapos_i.norm2());
 
   clpos.update(1.0, cldeltapos_i, 1.0);
 
   periodic_bounding_box().shift_3d(clpos);
 
-  std::vector<double> newpos(3, 0.0);
-  for (int dim = 0; dim < 3; ++dim) newpos[dim] = clpos(dim);
-  crosslinker->set_pos(newpos);
-
-  cldata->set_position(clpos);
+  crosslinkers_.set_position(index, clpos);
 }
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
-    set_position_of_newly_single_bonded_crosslinker(CrossLinking::CrosslinkerNode* crosslinker,
-        BeamInteraction::Data::CrosslinkerData* cldata, int stayoccpotid)
+    set_position_of_newly_single_bonded_crosslinker(int index, int stayoccpotid)
 {
   check_init();
 
   // update position
   const int collidoccbeam =
-      discret_ptr()->element_col_map()->LID(cldata->get_b_spots()[stayoccpotid].first);
+      discret_ptr()->element_col_map()->LID(crosslinkers_.bspot(index, stayoccpotid).first);
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
   // safety check
   if (collidoccbeam < 0)
     FOUR_C_THROW("element with gid %i not ghosted on proc %i",
-        cldata->get_b_spots()[stayoccpotid].first, g_state().get_my_rank());
+        crosslinkers_.bspot(index, stayoccpotid).first, g_state().get_my_rank());
 #endif
 
   BeamInteraction::Data::BeamData const* beamdata_i = beam_data_[collidoccbeam].get();
-  Core::LinAlg::Matrix<3, 1> clpos(beamdata_i->get_b_spot_position(
-      crosslinker->get_material()->linker_type(), cldata->get_b_spots()[stayoccpotid].second));
-
-  std::vector<double> newpos(3, 0.0);
-  for (int dim = 0; dim < 3; ++dim) newpos[dim] = clpos(dim);
-  crosslinker->set_pos(newpos);
+  Core::LinAlg::Matrix<3, 1> clpos(
+      beamdata_i->get_b_spot_position(crosslinker_material(crosslinkers_.type(index)).linker_type(),
+          crosslinkers_.bspot(index, stayoccpotid).second));
 
-  cldata->set_position(clpos);
+  crosslinkers_.set_position(index, clpos);
 }
 
 /*----------------------------------------------------------------------------*
@@ -2011,65 +1708,168 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::store_maps_prior_redistri
 {
   check_init();
 
-  *cl_noderowmap_prior_redistr_ = *bin_discret().node_row_map();
-  *cl_nodecolmap_prior_redistr_ = *bin_discret().node_col_map();
   *beam_elerowmap_prior_redistr_ = *ele_type_map_extractor().beam_map();
   *beam_elecolmap_prior_redistr_ = *discret().element_col_map();
 }
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+BeamInteraction::CrosslinkerContainer const&
+BeamInteraction::SUBMODELEVALUATOR::Crosslinking::crosslinker_in_bin(int bingid) const
+{
+  if (bin_discret().g_element(bingid)->owner() == g_state().get_my_rank()) return crosslinkers_;
+
+  return ghost_crosslinkers_;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::build_ghosted_bins_per_rank()
+{
+  check_init();
+
+  int const myrank = g_state().get_my_rank();
+
+  // request all bins that I ghost from their owner
+  std::map<int, std::vector<int>> binstosend;
+  for (int lid = 0; lid < bin_discret().num_my_col_elements(); ++lid)
+  {
+    Core::Elements::Element const* bin = bin_discret().l_col_element(lid);
+    if (bin->owner() != myrank) binstosend[bin->owner()].push_back(bin->id());
+  }
+
+  // build exporter
+  Core::Communication::Exporter exporter(bin_discret().get_comm());
+  int const numproc = Core::Communication::num_mpi_ranks(bin_discret().get_comm());
+
+  // ---- send ---- ( we do not need to pack anything)
+  std::vector<MPI_Request> request(binstosend.size());
+  int tag = 0;
+  std::vector<int> targetprocs(numproc, 0);
+  for (auto const& p : binstosend)
+  {
+    targetprocs[p.first] = 1;
+    exporter.i_send(myrank, p.first, p.second.data(), static_cast<int>(p.second.size()), 1234,
+        request[tag]);
+    ++tag;
+  }
+
+  // ---- prepare receiving procs -----
+  std::vector<int> summedtargets(numproc, 0);
+  Core::Communication::sum_all(
+      targetprocs.data(), summedtargets.data(), numproc, bin_discret().get_comm());
+
+  // ---- receive ----- (the sender of a request ghosts the requested bins)
+  ghosted_bins_per_rank_.assign(numproc, std::vector<int>());
+  for (int rec = 0; rec < summedtargets[myrank]; ++rec)
+  {
+    std::vector<int> rdata;
+    int length = 0;
+    int tag = -1;
+    int from = -1;
+    exporter.receive_any(from, tag, rdata, length);
+    if (tag != 1234)
+      FOUR_C_THROW("Received on proc %i data with wrong tag from proc %i", myrank, from);
+
+    ghosted_bins_per_rank_[from] = rdata;
+  }
+
+  // wait for all communication to finish
+  wait(exporter, request, static_cast<int>(binstosend.size()));
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_and_export_crosslinker_data()
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::export_ghost_crosslinker()
 {
   check_init();
 
   TEUCHOS_FUNC_TIME_MONITOR(
-      "BeamInteraction::SUBMODELEVALUATOR::Crosslinking::"
-      "update_and_export_crosslinker_data");
+      "BeamInteraction::SUBMODELEVALUATOR::Crosslinking::export_ghost_crosslinker");
 
-  //  // if one proc has changed maps, all procs have to update exporter
-  //  int loc_changed_maps = static_cast< int >( (cl_exporter_ == nullptr) or not
-  //      ( cl_exporter_->SourceMap().SameAs( *cl_noderowmap_prior_redistr_ ) and
-  //        cl_nodecolmap_prior_redistr_->SameAs(*BinDiscret().NodeColMap() ) ) );
-  //
-  //  //global filled flag (is true / one if and only if loc_changed_maps == true on each processor
-  //  int g_changed_maps = 0;
-  //
-  //  /*the global flag is set to the maximal value of any local flag
-  //   * i.e. if on any processor loc_changed_maps == true, the flag g_changed_maps is set to
-  //   * one*/
-  //  Core::Communication::max_all( &loc_changed_maps, &g_changed_maps, 1 , BinDiscret().Comm());
-  //
-  //  if ( g_changed_maps )
-  cl_exporter_ = std::make_shared<Core::Communication::Exporter>(
-      *cl_noderowmap_prior_redistr_, *bin_discret().node_col_map(), bin_discret().get_comm());
+  // send copies of all crosslinker in bins ghosted by a proc to this proc
+  std::vector<std::vector<int>> indicesperrank(ghosted_bins_per_rank_.size());
+  for (unsigned int p = 0; p < ghosted_bins_per_rank_.size(); ++p)
+  {
+    for (int bingid : ghosted_bins_per_rank_[p])
+    {
+      auto const [first, last] = crosslinkers_.bin_range(bingid);
+      for (int i = first; i < last; ++i) indicesperrank[p].push_back(i);
+    }
+  }
 
-  // we first need to pack our stuff into and std::vector< char > for communication
-  std::map<int, std::vector<char>> allpacks;
-  unsigned int numrowcl = cl_noderowmap_prior_redistr_->NumMyElements();
-  for (unsigned int i = 0; i < numrowcl; ++i)
+  crosslinkers_.export_copies(bin_discret().get_comm(), indicesperrank, ghost_crosslinkers_);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::distribute_crosslinker_to_bins(
+    Epetra_BlockMap const& binrowmap)
+{
+  check_init();
+
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "BeamInteraction::SUBMODELEVALUATOR::Crosslinking::distribute_crosslinker_to_bins");
+
+  int const myrank = g_state().get_my_rank();
+
+  // assign all crosslinker to the bin they currently reside in
+  std::vector<int> targetrank(crosslinkers_.size(), -1);
+  std::set<int> unknownbins;
+  for (int i = 0; i < crosslinkers_.size(); ++i)
   {
-    int const clgid = cl_noderowmap_prior_redistr_->GID(i);
-    std::shared_ptr<BeamInteraction::Data::CrosslinkerData> cl_data_i =
-        crosslinker_data_[cl_nodecolmap_prior_redistr_->LID(clgid)];
+    Core::LinAlg::Matrix<3, 1> clpos(crosslinkers_.position(i));
+    int const bingid = bin_strategy().convert_pos_to_gid(clpos);
+    crosslinkers_.set_bin(i, bingid);
 
-    Core::Communication::PackBuffer data;
-    cl_data_i->pack(data);
-    allpacks[clgid].insert(allpacks[clgid].end(), data().begin(), data().end());
+    if (bingid < 0) continue;
+
+    if (bin_discret().have_global_element(bingid))
+      targetrank[i] = bin_discret().g_element(bingid)->owner();
+    else
+      unknownbins.insert(bingid);
   }
 
-  // export
-  cl_exporter_->do_export(allpacks);
+  // get owner of bins that are not known on this proc (collective call)
+  std::vector<int> unknownbinvec(unknownbins.begin(), unknownbins.end());
+  std::vector<int> pidlist(unknownbinvec.size());
+  int err = binrowmap.RemoteIDList(static_cast<int>(unknownbinvec.size()), unknownbinvec.data(),
+      pidlist.data(), nullptr);
+  if (err < 0) FOUR_C_THROW("Epetra_BlockMap::RemoteIDList returned err=%d", err);
 
-  // rebuild data container
-  crosslinker_data_.resize(bin_discret().num_my_col_nodes());
-  for (auto& iter : allpacks)
+  std::map<int, int> ownerofunknownbin;
+  for (unsigned int j = 0; j < unknownbinvec.size(); ++j)
+    ownerofunknownbin[unknownbinvec[j]] = pidlist[j];
+
+  // double bonds of crosslinker that change their owner are sent along
+  std::map<int, std::vector<std::shared_ptr<BeamInteraction::BeamLink>>> dbcltosend;
+  int numhomelesslinker = 0;
+  for (int i = 0; i < crosslinkers_.size(); ++i)
   {
-    Core::Communication::UnpackBuffer buffer(iter.second);
-    std::shared_ptr<BeamInteraction::Data::CrosslinkerData> cl_data(
-        BeamInteraction::Data::create_data_container<BeamInteraction::Data::CrosslinkerData>(
-            buffer));
-    crosslinker_data_[bin_discret().node_col_map()->LID(cl_data->get_id())] = cl_data;
+    int const bingid = crosslinkers_.bin(i);
+    if (bingid >= 0 and targetrank[i] < 0) targetrank[i] = ownerofunknownbin[bingid];
+
+    if (targetrank[i] < 0) ++numhomelesslinker;
+    if (targetrank[i] == myrank) continue;
+
+    auto const dbcliter = doublebondcl_.find(crosslinkers_.gid(i));
+    if (dbcliter == doublebondcl_.end()) continue;
+
+    if (targetrank[i] >= 0) dbcltosend[targetrank[i]].push_back(dbcliter->second);
+    doublebondcl_.erase(dbcliter);
   }
+
+  if (numhomelesslinker != 0)
+    std::cout << " There are " << numhomelesslinker
+              << " linker which have left the computational domain on rank " << myrank
+              << std::endl;
+
+  // crosslinker need to be on their new owner before their double bonds arrive
+  crosslinkers_.migrate(bin_discret().get_comm(), targetrank);
+  communicate_beam_link_after_redistribution(dbcltosend);
+
+  crosslinkers_.reset_reference_positions();
+  crosslinkers_.sort_by_bin();
 }
 
 /*----------------------------------------------------------------------------*
@@ -2256,45 +2056,31 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::find_potential_binding_ev
     intendedbeambonds[crosslinking_params_ptr_->linker_types()[i]].resize(
         discret_ptr()->num_my_row_elements());
 
-  // store bins that have already been examined
-  std::vector<int> examinedbins(bin_discret_ptr()->num_my_col_elements(), 0);
-  // loop over all column crosslinker in random order
-  // create random order of indices
-  std::vector<int> rordercolcl =
-      BeamInteraction::Utils::permutation(bin_discret_ptr()->num_my_col_nodes());
+  // all row and ghosted bins containing at least one crosslinker
+  std::vector<int> binswithcl;
+  binswithcl.reserve(crosslinkers_.bins().size() + ghost_crosslinkers_.bins().size());
+  std::set_union(crosslinkers_.bins().begin(), crosslinkers_.bins().end(),
+      ghost_crosslinkers_.bins().begin(), ghost_crosslinkers_.bins().end(),
+      std::back_inserter(binswithcl));
 
-  for (auto const& icl : rordercolcl)
+  // loop over all bins containing crosslinker in random order
+  std::vector<int> randorderbins =
+      BeamInteraction::Utils::permutation(static_cast<int>(binswithcl.size()));
+  for (auto const& ibin : randorderbins)
   {
-    Core::Nodes::Node* currcrosslinker = bin_discret_ptr()->l_col_node(icl);
-
 #ifdef FOUR_C_ENABLE_ASSERTIONS
-    if (currcrosslinker == nullptr) FOUR_C_THROW("Node not there");
-    if (currcrosslinker->num_element() != 1)
-      FOUR_C_THROW("More than one element for this crosslinker");
+    if (binswithcl[ibin] < 0) FOUR_C_THROW(" negative bin id number %i ", binswithcl[ibin]);
 #endif
 
-    // get bin that contains this crosslinker (can only be one)
-    Core::Elements::Element* currentbin = currcrosslinker->elements()[0];
-
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-    if (currentbin->id() < 0) FOUR_C_THROW(" negative bin id number %i ", currentbin->id());
-#endif
-
-    // if a bin has already been examined --> continue with next crosslinker
-    if (examinedbins[currentbin->lid()]) continue;
-    // else: bin is examined for the first time --> new entry in examinedbins_
-    else
-      examinedbins[currentbin->lid()] = 1;
-
     find_potential_binding_events_in_bin_and_neighborhood(
-        currentbin, mybonds, undecidedbonds, intendedbeambonds, true);
+        binswithcl[ibin], mybonds, undecidedbonds, intendedbeambonds, true);
   }
 }
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
-    find_potential_binding_events_in_bin_and_neighborhood(Core::Elements::Element* bin,
+    find_potential_binding_events_in_bin_and_neighborhood(int bingid,
         std::map<int, std::shared_ptr<BeamInteraction::Data::BindEventData>>& mybonds,
         std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::BindEventData>>>&
             undecidedbonds,
@@ -2308,7 +2094,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
   std::vector<int> neighboring_binIds;
   neighboring_binIds.reserve(27);
   // do not check on existence here -> shifted to GetBinContent
-  bin_strategy_ptr()->get_neighbor_and_own_bin_ids(bin->id(), neighboring_binIds);
+  bin_strategy_ptr()->get_neighbor_and_own_bin_ids(bingid, neighboring_binIds);
 
   // get set of neighboring beam elements (i.e. elements that somehow touch nb bins)
   // as explained above, we only need row elements (true flag in GetBinContent())
@@ -2326,24 +2112,25 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
   // in case there are no neighbors, go to next crosslinker (an therefore bin)
   if (neighboring_row_beams.empty()) return;
 
-  // get all crosslinker in current bin
-  Core::Nodes::Node** clincurrentbin = bin->nodes();
-  const int numcrosslinker = bin->num_node();
+  // get all crosslinker in current bin (owned by the owner of the bin)
+  BeamInteraction::CrosslinkerContainer const& linkers = crosslinker_in_bin(bingid);
+  auto const [first, last] = linkers.bin_range(bingid);
+  int const owner = bin_discret().g_element(bingid)->owner();
 
   // obtain random order in which crosslinker are addressed
-  std::vector<int> randorder = BeamInteraction::Utils::permutation(numcrosslinker);
+  std::vector<int> randorder = BeamInteraction::Utils::permutation(last - first);
 
-  // loop over all crosslinker in CurrentBin in random order
+  // loop over all crosslinker in current bin in random order
   for (auto const& randcliter : randorder)
   {
     // get random crosslinker in current bin
-    Core::Nodes::Node* crosslinker_i = clincurrentbin[randcliter];
+    int const index = first + randcliter;
 
     // todo: this can be done more efficiently
-    if (check_if_sphere_prohibits_binding(neighboring_col_spheres, crosslinker_i)) continue;
+    if (check_if_sphere_prohibits_binding(neighboring_col_spheres, linkers, index)) continue;
 
     // get all potential binding events on myrank
-    prepare_binding(crosslinker_i, neighboring_row_beams, mybonds, undecidedbonds,
+    prepare_binding(linkers, index, owner, neighboring_row_beams, mybonds, undecidedbonds,
         intendedbeambonds, checklinkingprop);
   }
 }
@@ -2352,16 +2139,15 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
  *----------------------------------------------------------------------------*/
 bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_if_sphere_prohibits_binding(
     std::set<Core::Elements::Element*> const& neighboring_col_spheres,
-    Core::Nodes::Node* node_i) const
+    BeamInteraction::CrosslinkerContainer const& linkers, int index) const
 {
   check_init();
 
-  CrossLinking::CrosslinkerNode* crosslinker_i =
-      dynamic_cast<CrossLinking::CrosslinkerNode*>(node_i);
+  Mat::CrosslinkerMat const& material = crosslinker_material(linkers.type(index));
 
-  if (std::abs(crosslinker_i->get_material()->no_bond_dist_sphere()) < 1.0e-8) return false;
+  if (std::abs(material.no_bond_dist_sphere()) < 1.0e-8) return false;
 
-  BeamInteraction::Data::CrosslinkerData* cldata_i = crosslinker_data_[crosslinker_i->lid()].get();
+  Core::LinAlg::Matrix<3, 1> const clpos(linkers.position(index));
 
   for (auto const& sphere_iter : neighboring_col_spheres)
   {
@@ -2378,10 +2164,10 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_if_sphere_prohibits
       sphere_pos(dim) = sphere_iter->nodes()[0]->x()[dim] + sphereeledisp[dim];
 
     Core::LinAlg::Matrix<3, 1> dist_vec(true);
-    dist_vec.update(1.0, sphere_pos, -1.0, cldata_i->get_position());
+    dist_vec.update(1.0, sphere_pos, -1.0, clpos);
     const double distance = dist_vec.norm2();
 
-    if (distance < crosslinker_i->get_material()->no_bond_dist_sphere()) return true;
+    if (distance < material.no_bond_dist_sphere()) return true;
   }
 
   return false;
@@ -2389,7 +2175,8 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_if_sphere_prohibits
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nodes::Node* node_i,
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(
+    BeamInteraction::CrosslinkerContainer const& linkers, int index, int owner,
     std::set<Core::Elements::Element*> const& neighboring_beams,
     std::map<int, std::shared_ptr<BeamInteraction::Data::BindEventData>>& mybonds,
     std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::BindEventData>>>&
@@ -2399,18 +2186,14 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
 {
   check_init();
 
-  CrossLinking::CrosslinkerNode* crosslinker_i =
-      dynamic_cast<CrossLinking::CrosslinkerNode*>(node_i);
-
-  // get precomputed data of crosslinker i
-  BeamInteraction::Data::CrosslinkerData* cldata_i = crosslinker_data_[crosslinker_i->lid()].get();
+  int const numbonds = linkers.number_of_bonds(index);
 
   // -------------------------------------------------------------------------
   // We now check all criteria that need to be passed for a binding event one
   // after the other
   // -------------------------------------------------------------------------
   // 1. criterion: in case crosslinker is double bonded, we can leave here
-  if (cldata_i->get_number_of_bonds() == 2) return;
+  if (numbonds == 2) return;
 
   // loop over all neighboring beam elements in random order (keep in mind
   // we are only looping over row elements)
@@ -2432,10 +2215,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
     // get pre computed data of current nbbeam
     BeamInteraction::Data::BeamData* beamdata_i = beam_data_[nbbeam->lid()].get();
 
-    if (cldata_i->get_number_of_bonds() == 1)
+    if (numbonds == 1)
     {
       int cl_bondedtogid =
-          cldata_i->get_b_spots()[get_single_occupied_cl_bspot(cldata_i->get_b_spots())].first;
+          linkers.bspot(index, get_single_occupied_cl_bspot(linkers.bspots(index))).first;
 
       // safety check
       if (discret().element_col_map()->LID(cl_bondedtogid) < 0)
@@ -2452,7 +2235,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
     // loop over all binding spots of current element in random order
     std::vector<int> randbspot =
         BeamInteraction::Utils::permutation(beamdata_i->get_number_of_binding_spots_of_type(
-            crosslinker_i->get_material()->linker_type()));
+            crosslinker_material(linkers.type(index)).linker_type()));
 
     for (auto const& rbspotiter : randbspot)
     {
@@ -2460,7 +2243,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
       const int locnbspot = rbspotiter;
 
       // we are now doing some additional checks if a binding event is feasible
-      if (not check_bind_event_criteria(crosslinker_i, nbbeam, cldata_i, beamdata_i, locnbspot,
+      if (not check_bind_event_criteria(linkers, index, nbbeam, beamdata_i, locnbspot,
               intendedbeambonds, checklinkingprop))
         continue;
 
@@ -2471,10 +2254,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
       std::shared_ptr<BeamInteraction::Data::BindEventData> bindeventdata =
           std::make_shared<BeamInteraction::Data::BindEventData>();
       // default permission is true, is changed if owner of cl has something against it
-      bindeventdata->init(crosslinker_i->id(), nbbeam->id(), locnbspot, g_state().get_my_rank(), 1);
+      bindeventdata->init(linkers.gid(index), nbbeam->id(), locnbspot, g_state().get_my_rank(), 1);
 
       // in case myrank is owner, we add it to the mybonds map
-      if (crosslinker_i->owner() == g_state().get_my_rank())
+      if (owner == g_state().get_my_rank())
       {
         mybonds[bindeventdata->get_cl_id()] = bindeventdata;
       }
@@ -2482,7 +2265,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
       {
         // myrank is not owner, we add it to the map of events that need to be
         // communicated to make a decision
-        undecidedbonds[crosslinker_i->owner()].push_back(bindeventdata);
+        undecidedbonds[owner].push_back(bindeventdata);
       }
 
       // as we allow only one binding event for each cl in one time step,
@@ -2495,9 +2278,8 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::prepare_binding(Core::Nod
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria(
-    CrossLinking::CrosslinkerNode const* const crosslinker_i,
+    BeamInteraction::CrosslinkerContainer const& linkers, int index,
     Core::Elements::Element const* const potbeampartner,
-    BeamInteraction::Data::CrosslinkerData* cldata_i,
     BeamInteraction::Data::BeamData const* beamdata_i, int locnbspot,
     std::map<int, std::vector<std::map<int, std::set<int>>>>& intendedbeambonds,
     bool checklinkingprop) const
@@ -2505,7 +2287,10 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
   check_init();
 
   int const potbeampartnerrowlid = discret().element_row_map()->LID(potbeampartner->id());
-  Inpar::BeamInteraction::CrosslinkerType linkertype = crosslinker_i->get_material()->linker_type();
+  Mat::CrosslinkerMat const& material = crosslinker_material(linkers.type(index));
+  Inpar::BeamInteraction::CrosslinkerType linkertype = material.linker_type();
+  int const numbonds = linkers.number_of_bonds(index);
+  Core::LinAlg::Matrix<3, 1> const clpos(linkers.position(index));
 
   // check compatibility of crosslinker type and filament type (some linker can only
   // bind to certain filament types)
@@ -2516,8 +2301,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
 
   // a crosslink is set if and only if it passes the probability check
   // for a binding event to happen
-  double plink = 1.0 - exp((-1.0) * crosslinking_params_ptr_->delta_time() *
-                           crosslinker_i->get_material()->k_on());
+  double plink = 1.0 - exp((-1.0) * crosslinking_params_ptr_->delta_time() * material.k_on());
 
   if (checklinkingprop and (Global::Problem::instance()->random()->uni() > plink)) return false;
 
@@ -2529,7 +2313,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
 
   // exclude multiple identical crosslinks
   if (not return_false_if_identical_bond_already_exists(
-          crosslinker_i, cldata_i, intendedbeambonds, beamdata_i, locnbspot, potbeampartnerrowlid))
+          linkers, index, intendedbeambonds, beamdata_i, locnbspot, potbeampartnerrowlid))
     return false;
 
   /* check RELEVANT distance criterion
@@ -2538,17 +2322,15 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
    * if singly bound:
    *   distance between already bound bspot of crosslinker and current beam binding spot
    * note: as we set the crosslinker position to coincide with beam bspot position if singly bound,
-   *       we can also use cldata_i.clpos in the second case*/
+   *       we can also use the crosslinker position in the second case*/
 
   // get current position and tangent vector of filament axis at free binding spot
   Core::LinAlg::Matrix<3, 1> const& currbbspos =
       beamdata_i->get_b_spot_position(linkertype, locnbspot);
 
   // minimum and maximum distance at which a double-bond crosslink can be established
-  double const linkdistmin = crosslinker_i->get_material()->linking_length() -
-                             crosslinker_i->get_material()->linking_length_tolerance();
-  double const linkdistmax = crosslinker_i->get_material()->linking_length() +
-                             crosslinker_i->get_material()->linking_length_tolerance();
+  double const linkdistmin = material.linking_length() - material.linking_length_tolerance();
+  double const linkdistmax = material.linking_length() + material.linking_length_tolerance();
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
   // safety check
@@ -2556,30 +2338,25 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
     FOUR_C_THROW(
         "The allowed binding distance of linker %i (in case it is single bonded) is"
         "\ngreater than the lower bound for bin size, this could lead to missing a binding event",
-        crosslinker_i->id());
+        linkers.gid(index));
 #endif
 
-  if ((cldata_i->get_number_of_bonds() == 0 and
-          BeamInteraction::Utils::is_distance_out_of_range(
-              cldata_i->get_position(), currbbspos, 0.5 * linkdistmin, 0.5 * linkdistmax)) or
-      (cldata_i->get_number_of_bonds() == 1 and
-          BeamInteraction::Utils::is_distance_out_of_range(
-              cldata_i->get_position(), currbbspos, linkdistmin, linkdistmax)))
+  if ((numbonds == 0 and BeamInteraction::Utils::is_distance_out_of_range(
+                             clpos, currbbspos, 0.5 * linkdistmin, 0.5 * linkdistmax)) or
+      (numbonds == 1 and BeamInteraction::Utils::is_distance_out_of_range(
+                             clpos, currbbspos, linkdistmin, linkdistmax)))
     return false;
 
   // orientation of centerline tangent vectors at binding spots
   // a crosslink (double-bonded crosslinker) will only be established if the
   // enclosed angle is in the specified range
-  double const linkanglemin = crosslinker_i->get_material()->linking_angle() -
-                              crosslinker_i->get_material()->linking_angle_tolerance();
-  double const linkanglemax = crosslinker_i->get_material()->linking_angle() +
-                              crosslinker_i->get_material()->linking_angle_tolerance();
+  double const linkanglemin = material.linking_angle() - material.linking_angle_tolerance();
+  double const linkanglemax = material.linking_angle() + material.linking_angle_tolerance();
 
   // if crosslinker is singly bound, we fetch the orientation vector
   Core::LinAlg::Matrix<3, 1> occ_bindingspot_beam_tangent(true);
-  if (cldata_i->get_number_of_bonds() == 1)
-    get_occupied_cl_b_spot_beam_tangent(
-        crosslinker_i, cldata_i, occ_bindingspot_beam_tangent, crosslinker_i->id());
+  if (numbonds == 1)
+    get_occupied_cl_b_spot_beam_tangent(linkers, index, occ_bindingspot_beam_tangent);
 
   // note: we use first base vector instead of tangent vector here
   Core::LinAlg::Matrix<3, 1> curr_bindingspot_beam_tangent(true);
@@ -2587,7 +2364,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
     curr_bindingspot_beam_tangent(idim) =
         beamdata_i->get_b_spot_triad(linkertype, locnbspot)(idim, 0);
 
-  if (cldata_i->get_number_of_bonds() == 1 and
+  if (numbonds == 1 and
       BeamInteraction::Utils::is_enclosed_angle_out_of_range(
           occ_bindingspot_beam_tangent, curr_bindingspot_beam_tangent, linkanglemin, linkanglemax))
     return false;
@@ -2596,8 +2373,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
   // by a crosslinker that came before in this random order
   if (static_cast<int>(intendedbeambonds.at(linkertype)[potbeampartnerrowlid][locnbspot].size() +
                        beamdata_i->get_b_spot_status_at(linkertype, locnbspot).size()) >=
-      crosslinking_params_ptr_->max_number_of_bonds_per_filament_bspot(
-          crosslinker_i->get_material()->linker_type()))
+      crosslinking_params_ptr_->max_number_of_bonds_per_filament_bspot(linkertype))
   {
     /* note: it is possible that the binding event that rejects the current one is rejected itself
      * later during communication with other procs and therefore the current one could be
@@ -2615,7 +2391,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
   }
   else
   {
-    intendedbeambonds.at(linkertype)[potbeampartnerrowlid][locnbspot].insert(crosslinker_i->id());
+    intendedbeambonds.at(linkertype)[potbeampartnerrowlid][locnbspot].insert(linkers.gid(index));
   }
 
   // bind event can happen
@@ -2627,22 +2403,22 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_bind_event_criteria
  *----------------------------------------------------------------------------*/
 bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
     return_false_if_identical_bond_already_exists(
-        CrossLinking::CrosslinkerNode const* const crosslinker_i,
-        BeamInteraction::Data::CrosslinkerData* cldata_i,
+        BeamInteraction::CrosslinkerContainer const& linkers, int index,
         std::map<int, std::vector<std::map<int, std::set<int>>>>& intendedbeambonds,
         BeamInteraction::Data::BeamData const* beamdata_i, int locnbspot,
         int potbeampartnerrowlid) const
 {
-  Inpar::BeamInteraction::CrosslinkerType linkertype = crosslinker_i->get_material()->linker_type();
+  Inpar::BeamInteraction::CrosslinkerType linkertype =
+      crosslinker_material(linkers.type(index)).linker_type();
 
-  if (not(cldata_i->get_number_of_bonds() == 1 and
+  if (not(linkers.number_of_bonds(index) == 1 and
           crosslinking_params_ptr_->max_number_of_bonds_per_filament_bspot(linkertype) > 1))
     return true;
 
   // get element and gid of beam element to which current linker is already bonded to
-  int occbspotid = get_single_occupied_cl_bspot(cldata_i->get_b_spots());
-  int const elegid = cldata_i->get_b_spots()[occbspotid].first;
-  int const locbspotnum = cldata_i->get_b_spots()[occbspotid].second;
+  int occbspotid = get_single_occupied_cl_bspot(linkers.bspots(index));
+  int const elegid = linkers.bspot(index, occbspotid).first;
+  int const locbspotnum = linkers.bspot(index, occbspotid).second;
 
   int const elecollid = discret().element_col_map()->LID(elegid);
 
@@ -2665,41 +2441,33 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
   // loop over crosslinker that are already bonded to potential new binding spot
   for (auto const iter : beamdata_i->get_b_spot_status_at(linkertype, locnbspot))
   {
-    Core::Nodes::Node* bonded_crosslinker_i = bin_discret().g_node(iter);
+    // bonded crosslinker is either owned by myrank or resides in a ghosted bin
+    BeamInteraction::CrosslinkerContainer const* bondedlinkers = &crosslinkers_;
+    int bondedindex = crosslinkers_.index_of(iter);
+    if (bondedindex < 0)
+    {
+      bondedlinkers = &ghost_crosslinkers_;
+      bondedindex = ghost_crosslinkers_.index_of(iter);
+    }
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety check
-    if (bonded_crosslinker_i == nullptr)
+    if (bondedindex < 0)
       FOUR_C_THROW(" Linker with gid %i not on rank %i", iter, g_state().get_my_rank());
-#endif
-
-    BeamInteraction::Data::CrosslinkerData const* bondedcl_data_i =
-        crosslinker_data_[bonded_crosslinker_i->lid()].get();
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-    // safety check
-    if (bonded_crosslinker_i == nullptr)
-      FOUR_C_THROW("Data for crosslinker %i not there on rank %i", bonded_crosslinker_i->id(),
-          g_state().get_my_rank());
-#endif
-
-    if (bondedcl_data_i->get_number_of_bonds() == 1)
+    if (bondedlinkers->number_of_bonds(bondedindex) == 1)
     {
       // this is needed in case a binding event was allowed in this time step in opposite direction
       int const elelid = discret().element_row_map()->LID(elegid);
-      if (elelid != -1 and
-          intendedbeambonds.at(linkertype)[elelid][locbspotnum].find(bonded_crosslinker_i->id()) !=
-              intendedbeambonds.at(linkertype)[elelid][locbspotnum].end())
+      if (elelid != -1 and intendedbeambonds.at(linkertype)[elelid][locbspotnum].find(iter) !=
+                               intendedbeambonds.at(linkertype)[elelid][locbspotnum].end())
         return false;
     }
-    else if (bondedcl_data_i->get_number_of_bonds() == 2)
+    else if (bondedlinkers->number_of_bonds(bondedindex) == 2)
     {
       // if intended bond between two filament binding spots already exists, reject current intended
       // bond
-      if ((bondedcl_data_i->get_b_spots()[0].first == elegid and
-              bondedcl_data_i->get_b_spots()[0].second == locbspotnum) or
-          (bondedcl_data_i->get_b_spots()[1].first == elegid and
-              bondedcl_data_i->get_b_spots()[1].second == locbspotnum))
+      if (bondedlinkers->bspot(bondedindex, 0) == std::make_pair(elegid, locbspotnum) or
+          bondedlinkers->bspot(bondedindex, 1) == std::make_pair(elegid, locbspotnum))
         return false;
     }
     else
@@ -2707,8 +2475,7 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
       FOUR_C_THROW(
           " unrealistic number of bonds (%i) for crosslinker (gid %i) at this point. Beam %i local "
           "%i ",
-          bondedcl_data_i->get_number_of_bonds(), bonded_crosslinker_i->owner(), elegid,
-          locbspotnum);
+          bondedlinkers->number_of_bonds(bondedindex), iter, elegid, locbspotnum);
     }
   }
 
@@ -2759,28 +2526,27 @@ bool BeamInteraction::SUBMODELEVALUATOR::Crosslinking::check_linker_and_filament
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::get_occupied_cl_b_spot_beam_tangent(
-    CrossLinking::CrosslinkerNode const* const crosslinker_i,
-    BeamInteraction::Data::CrosslinkerData* cldata_i,
-    Core::LinAlg::Matrix<3, 1>& occ_bindingspot_beam_tangent, int clgid) const
+    BeamInteraction::CrosslinkerContainer const& linkers, int index,
+    Core::LinAlg::Matrix<3, 1>& occ_bindingspot_beam_tangent) const
 {
   check_init_setup();
 
-  int occbspotid = get_single_occupied_cl_bspot(cldata_i->get_b_spots());
+  int occbspotid = get_single_occupied_cl_bspot(linkers.bspots(index));
 
-  const int locbspotnum = cldata_i->get_b_spots()[occbspotid].second;
-  const int elegid = cldata_i->get_b_spots()[occbspotid].first;
+  const int locbspotnum = linkers.bspot(index, occbspotid).second;
+  const int elegid = linkers.bspot(index, occbspotid).first;
   const int elecollid = discret().element_col_map()->LID(elegid);
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
   if (elecollid < 0)
-    FOUR_C_THROW(" Element with gid %i bonded to cl %i on rank %i not even ghosted", elegid, clgid,
-        g_state().get_my_rank());
+    FOUR_C_THROW(" Element with gid %i bonded to cl %i on rank %i not even ghosted", elegid,
+        linkers.gid(index), g_state().get_my_rank());
 #endif
 
   // note: we use first base vector instead of tangent vector here
   for (unsigned int idim = 0; idim < 3; ++idim)
     occ_bindingspot_beam_tangent(idim) = beam_data_[elecollid]->get_b_spot_triad(
-        crosslinker_i->get_material()->linker_type(), locbspotnum)(idim, 0);
+        crosslinker_material(linkers.type(index)).linker_type(), locbspotnum)(idim, 0);
 }
 
 /*-----------------------------------------------------------------------------*
@@ -2864,42 +2630,33 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
 #endif
 
     // get current linker and beam data
-    const int clcollid = bin_discret_ptr()->node_col_map()->LID(cliter.first);
+    const int index = crosslinkers_.index_of(cliter.first);
     const int colelelid = discret_ptr()->element_col_map()->LID(binevdata->get_ele_id());
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety checks
-    if (clcollid < 0) FOUR_C_THROW("Crosslinker not even ghosted, should be owned here.");
+    if (index < 0)
+      FOUR_C_THROW("Crosslinker %i not owned by rank %i.", cliter.first, g_state().get_my_rank());
+#ifdef FOUR_C_ENABLE_ASSERTIONS
     if (colelelid < 0) FOUR_C_THROW("Element with gid %i not ghosted.", binevdata->get_ele_id());
 #endif
-    CrossLinking::CrosslinkerNode* crosslinker_i =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->l_col_node(clcollid));
-
-    // get crosslinker data
-    BeamInteraction::Data::CrosslinkerData* cldata_i = crosslinker_data_[clcollid].get();
 
     Core::Elements::Element* beamele_i = discret_ptr()->l_col_element(colelelid);
     BeamInteraction::Data::BeamData* beamdata_i = beam_data_[colelelid].get();
 
+    const Inpar::BeamInteraction::CrosslinkerType linkertype =
+        crosslinker_material(crosslinkers_.type(index)).linker_type();
+
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety checks
     if (cliter.first != binevdata->get_cl_id())
       FOUR_C_THROW("Map key does not match crosslinker gid of current binding event.");
-
-    if (crosslinker_i->owner() != g_state().get_my_rank())
-      FOUR_C_THROW("Only row owner of crosslinker is changing its status");
-
-    if (colelelid < 0)
-      FOUR_C_THROW(
-          "Binding element partner of current row crosslinker is not ghosted, "
-          "this must be the case though.");
 #endif
 
     // -------------------------------------------------------------------------
     // different treatment according to number of bonds crosslinker had before
     // this binding event
     // -------------------------------------------------------------------------
-    switch (cldata_i->get_number_of_bonds())
+    switch (crosslinkers_.number_of_bonds(index))
     {
       case 0:
       {
@@ -2908,20 +2665,15 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
         // -----------------------------------------------------------------
         // store gid and bspot local number of this element, first binding spot
         // always bonded first
-        cldata_i->set_bspot(
-            0, std::make_pair(binevdata->get_ele_id(), binevdata->get_b_spot_loc_n()));
+        crosslinkers_.set_bspot(
+            index, 0, std::make_pair(binevdata->get_ele_id(), binevdata->get_b_spot_loc_n()));
 
         // update number of bonds
-        cldata_i->set_number_of_bonds(1);
+        crosslinkers_.set_number_of_bonds(index, 1);
 
         // update position
-        std::vector<double> newpos(3, 0.0);
-        for (int dim = 0; dim < 3; ++dim)
-          newpos[dim] = beamdata_i->get_b_spot_position(
-              crosslinker_i->get_material()->linker_type(), binevdata->get_b_spot_loc_n())(dim);
-        crosslinker_i->set_pos(newpos);
-        cldata_i->set_position(beamdata_i->get_b_spot_position(
-            crosslinker_i->get_material()->linker_type(), binevdata->get_b_spot_loc_n()));
+        crosslinkers_.set_position(
+            index, beamdata_i->get_b_spot_position(linkertype, binevdata->get_b_spot_loc_n()));
 
         // -----------------------------------------------------------------
         // update beam status
@@ -2929,12 +2681,12 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
         // store crosslinker gid in status of beam binding spot if myrank
         // is owner of beam
         if (beamele_i->owner() == g_state().get_my_rank())
-          beamdata_i->add_bond_to_binding_spot(crosslinker_i->get_material()->linker_type(),
-              binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
+          beamdata_i->add_bond_to_binding_spot(
+              linkertype, binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
         // safety check
-        if (not(cldata_i->get_b_spots()[1].first < 0))
+        if (not(crosslinkers_.bspot(index, 1).first < 0))
           FOUR_C_THROW("Numbond does not fit to clbspot vector.");
 #endif
 
@@ -2943,7 +2695,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
       case 1:
       {
         // get clbspot that is currently bonded
-        int occbspotid = get_single_occupied_cl_bspot(cldata_i->get_b_spots());
+        int occbspotid = get_single_occupied_cl_bspot(crosslinkers_.bspots(index));
         int freebspotid = 1;
         if (occbspotid == 1) freebspotid = 0;
 
@@ -2951,63 +2703,50 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
         // update crosslinker status
         // -----------------------------------------------------------------
         // store gid and bspot local number of this element
-        cldata_i->set_bspot(
-            freebspotid, std::make_pair(binevdata->get_ele_id(), binevdata->get_b_spot_loc_n()));
+        crosslinkers_.set_bspot(index, freebspotid,
+            std::make_pair(binevdata->get_ele_id(), binevdata->get_b_spot_loc_n()));
+        std::pair<int, int> const freebspot = crosslinkers_.bspot(index, freebspotid);
+        std::pair<int, int> const occbspot = crosslinkers_.bspot(index, occbspotid);
 
         // update number of bonds
-        cldata_i->set_number_of_bonds(2);
+        crosslinkers_.set_number_of_bonds(index, 2);
 
         // update position
-        Core::LinAlg::Matrix<3, 1> clpos(cldata_i->get_position());
-        set_position_of_double_bonded_crosslinker_pb_cconsistent(clpos,
-            beamdata_i->get_b_spot_position(crosslinker_i->get_material()->linker_type(),
-                cldata_i->get_b_spots()[freebspotid].second),
-            cldata_i->get_position());
-
-        std::vector<double> newpos(3, 0.0);
-        for (int dim = 0; dim < 3; ++dim) newpos[dim] = clpos(dim);
-        crosslinker_i->set_pos(newpos);
-
-        cldata_i->set_position(clpos);
+        Core::LinAlg::Matrix<3, 1> const oldclpos(crosslinkers_.position(index));
+        Core::LinAlg::Matrix<3, 1> clpos(oldclpos);
+        set_position_of_double_bonded_crosslinker_pb_cconsistent(
+            clpos, beamdata_i->get_b_spot_position(linkertype, freebspot.second), oldclpos);
+        crosslinkers_.set_position(index, clpos);
 
         // create double bond cl data
-        int occ_colelelid =
-            discret_ptr()->element_col_map()->LID(cldata_i->get_b_spots()[occbspotid].first);
+        int occ_colelelid = discret_ptr()->element_col_map()->LID(occbspot.first);
         NewDoubleBonds dbondcl;
         dbondcl.id = binevdata->get_cl_id();
-        if (cldata_i->get_b_spots()[freebspotid].first > cldata_i->get_b_spots()[occbspotid].first)
+        if (freebspot.first > occbspot.first)
         {
-          dbondcl.eleids.push_back(cldata_i->get_b_spots()[freebspotid]);
-          dbondcl.eleids.push_back(cldata_i->get_b_spots()[occbspotid]);
-          dbondcl.bspotposs.push_back(beam_data_[colelelid]->get_b_spot_position(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[freebspotid].second));
-          dbondcl.bspotposs.push_back(beam_data_[occ_colelelid]->get_b_spot_position(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[occbspotid].second));
+          dbondcl.eleids.push_back(freebspot);
+          dbondcl.eleids.push_back(occbspot);
+          dbondcl.bspotposs.push_back(
+              beam_data_[colelelid]->get_b_spot_position(linkertype, freebspot.second));
+          dbondcl.bspotposs.push_back(
+              beam_data_[occ_colelelid]->get_b_spot_position(linkertype, occbspot.second));
+          dbondcl.bspottriads.push_back(
+              beam_data_[colelelid]->get_b_spot_triad(linkertype, freebspot.second));
           dbondcl.bspottriads.push_back(
-              beam_data_[colelelid]->get_b_spot_triad(crosslinker_i->get_material()->linker_type(),
-                  cldata_i->get_b_spots()[freebspotid].second));
-          dbondcl.bspottriads.push_back(beam_data_[occ_colelelid]->get_b_spot_triad(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[occbspotid].second));
+              beam_data_[occ_colelelid]->get_b_spot_triad(linkertype, occbspot.second));
         }
         else
         {
-          dbondcl.eleids.push_back(cldata_i->get_b_spots()[occbspotid]);
-          dbondcl.eleids.push_back(cldata_i->get_b_spots()[freebspotid]);
-          dbondcl.bspotposs.push_back(beam_data_[occ_colelelid]->get_b_spot_position(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[occbspotid].second));
-          dbondcl.bspotposs.push_back(beam_data_[colelelid]->get_b_spot_position(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[freebspotid].second));
-          dbondcl.bspottriads.push_back(beam_data_[occ_colelelid]->get_b_spot_triad(
-              crosslinker_i->get_material()->linker_type(),
-              cldata_i->get_b_spots()[occbspotid].second));
+          dbondcl.eleids.push_back(occbspot);
+          dbondcl.eleids.push_back(freebspot);
+          dbondcl.bspotposs.push_back(
+              beam_data_[occ_colelelid]->get_b_spot_position(linkertype, occbspot.second));
+          dbondcl.bspotposs.push_back(
+              beam_data_[colelelid]->get_b_spot_position(linkertype, freebspot.second));
           dbondcl.bspottriads.push_back(
-              beam_data_[colelelid]->get_b_spot_triad(crosslinker_i->get_material()->linker_type(),
-                  cldata_i->get_b_spots()[freebspotid].second));
+              beam_data_[occ_colelelid]->get_b_spot_triad(linkertype, occbspot.second));
+          dbondcl.bspottriads.push_back(
+              beam_data_[colelelid]->get_b_spot_triad(linkertype, freebspot.second));
         }
 
         // insert pair in mypairs
@@ -3016,8 +2755,8 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
         // first check if myrank is owner of element of current binding event
         // (additionally to being owner of cl)
         if (beamele_i->owner() == g_state().get_my_rank())
-          beamdata_i->add_bond_to_binding_spot(crosslinker_i->get_material()->linker_type(),
-              binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
+          beamdata_i->add_bond_to_binding_spot(
+              linkertype, binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
 
         break;
       }
@@ -3026,7 +2765,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_crosslinker_bin
         FOUR_C_THROW(
             "You should not be here, crosslinker has unrealistic number "
             "%i of bonds.",
-            cldata_i->get_number_of_bonds());
+            crosslinkers_.number_of_bonds(index));
         exit(EXIT_FAILURE);
       }
     }
@@ -3051,48 +2790,44 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_element_binding
     // get binding event data
     BeamInteraction::Data::BindEventData* binevdata = cliter.second.get();
 
-    // get linker data and beam data
-    CrossLinking::CrosslinkerNode* linker =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->g_node(cliter.first));
+    // get linker data (copy of crosslinker in ghosted bin) and beam data
+    int const index = ghost_crosslinkers_.index_of(cliter.first);
     int const colelelid = discret_ptr()->element_col_map()->LID(binevdata->get_ele_id());
 
-#ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety checks
-    if (linker == nullptr)
-      FOUR_C_THROW("Crosslinker needs to be ghosted, but this isn't the case.");
+    if (index < 0)
+      FOUR_C_THROW("Crosslinker %i needs to be ghosted on rank %i, but this isn't the case.",
+          cliter.first, g_state().get_my_rank());
+#ifdef FOUR_C_ENABLE_ASSERTIONS
     if (colelelid < 0)
       FOUR_C_THROW("element with gid %i not ghosted on proc %i", binevdata->get_ele_id(),
           g_state().get_my_rank());
 #endif
 
-    // linker
-    int const clcollid = linker->lid();
-    BeamInteraction::Data::CrosslinkerData* cldata_i = crosslinker_data_[clcollid].get();
-
     BeamInteraction::Data::BeamData* beamdata_i = beam_data_[colelelid].get();
+    const Inpar::BeamInteraction::CrosslinkerType linkertype =
+        crosslinker_material(ghost_crosslinkers_.type(index)).linker_type();
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety checks
     if (discret_ptr()->l_col_element(colelelid)->owner() != g_state().get_my_rank())
       FOUR_C_THROW("Only row owner of element is allowed to change its status");
-    if (linker->owner() == g_state().get_my_rank())
-      FOUR_C_THROW("myrank should not be owner of this crosslinker");
 #endif
 
     // different treatment according to number of bonds crosslinker had before
     // this binding event
-    switch (cldata_i->get_number_of_bonds())
+    switch (ghost_crosslinkers_.number_of_bonds(index))
     {
       case 0:
       {
-        beamdata_i->add_bond_to_binding_spot(linker->get_material()->linker_type(),
-            binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
+        beamdata_i->add_bond_to_binding_spot(
+            linkertype, binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
         break;
       }
       case 1:
       {
-        beamdata_i->add_bond_to_binding_spot(linker->get_material()->linker_type(),
-            binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
+        beamdata_i->add_bond_to_binding_spot(
+            linkertype, binevdata->get_b_spot_loc_n(), binevdata->get_cl_id());
         break;
       }
       default:
@@ -3100,7 +2835,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_element_binding
         FOUR_C_THROW(
             "You should not be here, crosslinker has unrealistic number "
             "%i of bonds.",
-            cldata_i->get_number_of_bonds());
+            ghost_crosslinkers_.number_of_bonds(index));
         exit(EXIT_FAILURE);
       }
     }
@@ -3118,40 +2853,31 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
   for (auto const& iter : mynewdbondcl)
   {
     NewDoubleBonds const& newdoublebond_i = iter.second;
-    CrossLinking::CrosslinkerNode* cl_node =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->g_node(iter.first));
+    int const index = crosslinkers_.index_of(iter.first);
+    Mat::CrosslinkerMat const& material = crosslinker_material(crosslinkers_.type(index));
 
     // create and initialize objects of beam-to-beam connections
     // Todo move this inside the create routines (or one create routine in BeamLink class)
     std::shared_ptr<BeamInteraction::BeamLink> linkelepairptr;
-    if (cl_node->get_material()->joint_type() == Inpar::BeamInteraction::beam3r_line2_rigid)
+    if (material.joint_type() == Inpar::BeamInteraction::beam3r_line2_rigid)
       linkelepairptr = BeamInteraction::BeamLinkRigidJointed::create();
-    else if (cl_node->get_material()->joint_type() == Inpar::BeamInteraction::beam3r_line2_pin or
-             cl_node->get_material()->joint_type() == Inpar::BeamInteraction::truss)
-      linkelepairptr =
-          BeamInteraction::BeamLinkPinJointed::create(cl_node->get_material()->joint_type());
+    else if (material.joint_type() == Inpar::BeamInteraction::beam3r_line2_pin or
+             material.joint_type() == Inpar::BeamInteraction::truss)
+      linkelepairptr = BeamInteraction::BeamLinkPinJointed::create(material.joint_type());
 
     // finally initialize and setup object
     linkelepairptr->init(iter.first, newdoublebond_i.eleids, newdoublebond_i.bspotposs,
-        newdoublebond_i.bspottriads, cl_node->get_material()->linker_type(),
-        g_state().get_time_np());
-    linkelepairptr->setup(cl_node->get_material()->beam_elast_hyper_mat_num());
+        newdoublebond_i.bspottriads, material.linker_type(), g_state().get_time_np());
+    linkelepairptr->setup(material.beam_elast_hyper_mat_num());
 
     // add to my double bonds
     doublebondcl_[linkelepairptr->id()] = linkelepairptr;
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety check
-    Core::Nodes::Node* crosslinker_i = bin_discret_ptr()->g_node(linkelepairptr->id());
-
-    // safety check
-    BeamInteraction::Data::CrosslinkerData const* cldata_i =
-        crosslinker_data_[crosslinker_i->lid()].get();
-
-    if (cldata_i->get_number_of_bonds() != 2)
-      FOUR_C_THROW("Setup: Cl with gid %i Owner %i on myrank %i and numbonds %i",
-          linkelepairptr->id(), crosslinker_i->owner(), g_state_ptr()->get_my_rank(),
-          cldata_i->get_number_of_bonds());
+    if (crosslinkers_.number_of_bonds(index) != 2)
+      FOUR_C_THROW("Setup: Cl with gid %i on myrank %i and numbonds %i", linkelepairptr->id(),
+          g_state_ptr()->get_my_rank(), crosslinkers_.number_of_bonds(index));
 #endif
   }
 }
@@ -3174,7 +2900,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
         undecidedbonds;
 
     // store bins that have already been examined
-    std::vector<int> examinedbins(bin_discret_ptr()->num_my_col_elements(), 0);
+    std::set<int> examinedbins;
     // this variable is used to check if a beam binding spot is linked twice on
     // myrank during a time step
     // ( first key is linkertype, second key is locbspotid, set holds gids of bonded crosslinker)
@@ -3196,16 +2922,11 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
         // check on existence of bin on this proc
         if (not bin_discret_ptr()->have_global_element(nb_iter)) continue;
 
-        Core::Elements::Element* currentbin = bin_discret_ptr()->g_element(nb_iter);
-
-        // if a bin has already been examined --> continue with next crosslinker
-        if (examinedbins[currentbin->lid()]) continue;
-        // else: bin is examined for the first time --> new entry in examinedbins_
-        else
-          examinedbins[currentbin->lid()] = 1;
+        // if a bin has already been examined --> continue with next bin
+        if (not examinedbins.insert(nb_iter).second) continue;
 
         find_potential_binding_events_in_bin_and_neighborhood(
-            currentbin, mybonds, undecidedbonds, intendedbeambonds, false);
+            nb_iter, mybonds, undecidedbonds, intendedbeambonds, false);
       }
     }
 
@@ -3246,25 +2967,20 @@ int BeamInteraction::SUBMODELEVALUATOR::Crosslinking::un_bind_crosslinker()
    * crosslinker information. As it possible that a row crosslinker is linked
    * to col element, we potentially need to communicate if such an element
    * needs to be updated*/
-  const int numrowcl = bin_discret_ptr()->num_my_row_nodes();
-  std::vector<int> rorderrowcl = BeamInteraction::Utils::permutation(numrowcl);
-  for (auto const& rowcli : rorderrowcl)
+  std::vector<int> rorderrowcl = BeamInteraction::Utils::permutation(crosslinkers_.size());
+  for (auto const& index : rorderrowcl)
   {
-    CrossLinking::CrosslinkerNode* linker =
-        dynamic_cast<CrossLinking::CrosslinkerNode*>(bin_discret_ptr()->l_row_node(rowcli));
+    Mat::CrosslinkerMat const& material = crosslinker_material(crosslinkers_.type(index));
 
     // only consider unbinding in case off rate is unequal zero
-    if (linker->get_material()->k_off() < 1e-08) continue;
-
-    const int clcollid = linker->lid();
-    BeamInteraction::Data::CrosslinkerData* cldata_i = crosslinker_data_[clcollid].get();
+    if (material.k_off() < 1e-08) continue;
 
     // probability with which a crosslink breaks up in the current time step
-    double p_unlink = 1.0 - exp((-1.0) * crosslinking_params_ptr_->delta_time() *
-                                linker->get_material()->k_off());
+    double p_unlink =
+        1.0 - exp((-1.0) * crosslinking_params_ptr_->delta_time() * material.k_off());
 
     // different treatment according to number of bonds of a crosslinker
-    switch (cldata_i->get_number_of_bonds())
+    switch (crosslinkers_.number_of_bonds(index))
     {
       case 0:
       {
@@ -3277,7 +2993,7 @@ int BeamInteraction::SUBMODELEVALUATOR::Crosslinking::un_bind_crosslinker()
         if (Global::Problem::instance()->random()->uni() > p_unlink) break;
 
         // dissolve bond and update states
-        dissolve_bond(linker, get_single_occupied_cl_bspot(cldata_i->get_b_spots()), 1,
+        dissolve_bond(index, get_single_occupied_cl_bspot(crosslinkers_.bspots(index)), 1,
             sendunbindevents, myrankunbindevents);
 
         break;
@@ -3286,21 +3002,22 @@ int BeamInteraction::SUBMODELEVALUATOR::Crosslinking::un_bind_crosslinker()
       {
         // calc unbind probability in case of force dependent off rate
         std::vector<double> p_unlink_db(2, 0.0);
-        if (abs(linker->get_material()->delta_bell_eq()) > 1.0e-8)
+        if (abs(material.delta_bell_eq()) > 1.0e-8)
           calc_bells_force_dependent_unbind_probability(
-              linker, *doublebondcl_[linker->id()], p_unlink_db);
+              index, *doublebondcl_[crosslinkers_.gid(index)], p_unlink_db);
         else
           p_unlink_db[0] = p_unlink_db[1] = p_unlink;
 
         // loop through crosslinker bonds in random order
-        std::vector<int> ro = BeamInteraction::Utils::permutation(cldata_i->get_number_of_bonds());
+        std::vector<int> ro =
+            BeamInteraction::Utils::permutation(crosslinkers_.number_of_bonds(index));
         for (auto const& clbspotiter : ro)
         {
           // if probability criterion isn't met, go to next spot
           if (Global::Problem::instance()->random()->uni() > p_unlink_db[clbspotiter]) continue;
 
           // dissolve bond and update states
-          dissolve_bond(linker, clbspotiter, 2, sendunbindevents, myrankunbindevents);
+          dissolve_bond(index, clbspotiter, 2, sendunbindevents, myrankunbindevents);
           ++num_db_dissolved;
 
           // we only want to dissolve one bond per timestep, therefore we go to
@@ -3312,8 +3029,8 @@ int BeamInteraction::SUBMODELEVALUATOR::Crosslinking::un_bind_crosslinker()
       }
       default:
       {
-        FOUR_C_THROW(
-            "Unrealistic number %i of bonds for a crosslinker.", cldata_i->get_number_of_bonds());
+        FOUR_C_THROW("Unrealistic number %i of bonds for a crosslinker.",
+            crosslinkers_.number_of_bonds(index));
         exit(EXIT_FAILURE);
       }
     }
@@ -3331,8 +3048,8 @@ int BeamInteraction::SUBMODELEVALUATOR::Crosslinking::un_bind_crosslinker()
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
-    calc_bells_force_dependent_unbind_probability(CrossLinking::CrosslinkerNode* linker,
-        BeamInteraction::BeamLink& elepairptr, std::vector<double>& punlinkforcedependent) const
+    calc_bells_force_dependent_unbind_probability(int index, BeamInteraction::BeamLink& elepairptr,
+        std::vector<double>& punlinkforcedependent) const
 {
   check_init_setup();
 
@@ -3340,9 +3057,10 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::
    * from B. Gui and W. Guilford: Mechanics of actomyosin bonds in different nucleotide states are
    * tuned to muscle contraction Fig 2: slip pathway, ADP, delta = 0.0004; Note: delta < 0 -> catch
    * bond, delta > 0 -> bond-weakening see Kai Mueller Dis p. 67/68 */
-  double const delta = linker->get_material()->delta_bell_eq();
+  Mat::CrosslinkerMat const& material = crosslinker_material(crosslinkers_.type(index));
+  double const delta = material.delta_bell_eq();
   double const kt = crosslinking_params_ptr_->kt();
-  double const koff = linker->get_material()->k_off();
+  double const koff = material.k_off();
   double const dt = crosslinking_params_ptr_->delta_time();
 
   // safety check
@@ -3423,49 +3141,6 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_beam_binding_statu
   }
 }
 
-/*----------------------------------------------------------------------------*
- *----------------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_double_bonds_after_redistribution()
-{
-  check_init();
-
-  std::map<int, std::vector<std::shared_ptr<BeamInteraction::BeamLink>>> dbcltosend;
-  std::set<int> dbtoerase;
-
-  // loop over all double bonds on myrank
-  std::map<int, std::shared_ptr<BeamInteraction::BeamLink>>::iterator iter;
-  for (iter = doublebondcl_.begin(); iter != doublebondcl_.end(); ++iter)
-  {
-    const int clgid = iter->first;
-
-    // safety check
-    if (bin_discret_ptr()->node_col_map()->LID(clgid) < 0)
-      FOUR_C_THROW(
-          "Crosslinker %i moved further than the bin length in one time step on rank %i, "
-          "this is not allowed (maybe increase cutoff radius). ",
-          clgid, g_state().get_my_rank());
-
-    Core::Nodes::Node* doublebondedcl_i = bin_discret_ptr()->g_node(clgid);
-
-    // check ownership
-    int owner = doublebondedcl_i->owner();
-    if (owner != g_state().get_my_rank())
-    {
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-      if (not doublebondcl_.count(clgid))
-        FOUR_C_THROW("willing to delete double bond %i which is not existing", clgid);
-#endif
-      dbcltosend[owner].push_back(iter->second);
-      dbtoerase.insert(clgid);
-    }
-  }
-
-  for (auto const& i : dbtoerase) doublebondcl_.erase(i);
-
-  // add new double bonds
-  communicate_beam_link_after_redistribution(dbcltosend);
-}
-
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_double_bonds_remote_id_list()
@@ -3482,15 +3157,21 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::update_my_double_bonds_re
     const int clgid = iter->first;
 
     // not owned
-    if (bin_discret_ptr()->node_row_map()->LID(clgid) < 0) notonmyrank.insert(clgid);
+    if (crosslinkers_.index_of(clgid) < 0) notonmyrank.insert(clgid);
   }
 
   int const size = static_cast<int>(notonmyrank.size());
   std::vector<int> unique_clgidlist(notonmyrank.begin(), notonmyrank.end());
   std::vector<int> unique_pidlist(size);
 
+  // map of crosslinker owned by each proc
+  std::vector<int> mycrosslinkergids(crosslinkers_.size());
+  for (int i = 0; i < crosslinkers_.size(); ++i) mycrosslinkergids[i] = crosslinkers_.gid(i);
+  Epetra_Map const crosslinkerrowmap(-1, static_cast<int>(mycrosslinkergids.size()),
+      mycrosslinkergids.data(), 0, Core::Communication::as_epetra_comm(discret().get_comm()));
+
   // find new host procs for double bonded crosslinker by communication
-  int err = bin_discret_ptr()->node_row_map()->RemoteIDList(
+  int err = crosslinkerrowmap.RemoteIDList(
       size, unique_clgidlist.data(), unique_pidlist.data(), nullptr);
   if (err < 0) FOUR_C_THROW("Epetra_BlockMap::RemoteIDList returned err=%d", err);
 
@@ -3534,29 +3215,13 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::unbind_crosslinker_in_bin
 
   for (auto const& nb_iter : binsonmyrank)
   {
-    // get all crosslinker in current bin
-    Core::Elements::Element* currentbin = bin_discret_ptr()->g_element(nb_iter);
-    Core::Nodes::Node** clincurrentbin = currentbin->nodes();
-    const int numcrosslinker = currentbin->num_node();
+    // get all crosslinker in current bin (only row bins of myrank end up here)
+    auto const [first, last] = crosslinkers_.bin_range(nb_iter);
 
     // loop over all crosslinker in current bin
-    for (int i = 0; i < numcrosslinker; ++i)
+    for (int i = first; i < last; ++i)
     {
-      // get crosslinker in current bin
-      Core::Nodes::Node* crosslinker_i = clincurrentbin[i];
-      BeamInteraction::Data::CrosslinkerData* cldata_i =
-          crosslinker_data_[crosslinker_i->lid()].get();
-
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-      // safety checks
-      if (crosslinker_i->owner() != g_state().get_my_rank())
-        FOUR_C_THROW(
-            " Only row owner of crosslinker changes its state, rank %i is not owner "
-            "of linker with gid %i, but rank %i",
-            g_state().get_my_rank(), crosslinker_i->id(), crosslinker_i->owner());
-#endif
-
-      switch (cldata_i->get_number_of_bonds())
+      switch (crosslinkers_.number_of_bonds(i))
       {
         case 0:
         {
@@ -3565,16 +3230,16 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::unbind_crosslinker_in_bin
         case 1:
         {
           // dissolve bond and update states
-          dissolve_bond(crosslinker_i, get_single_occupied_cl_bspot(cldata_i->get_b_spots()),
-              cldata_i->get_number_of_bonds(), sendunbindevents, myrankunbindevents);
+          dissolve_bond(i, get_single_occupied_cl_bspot(crosslinkers_.bspots(i)),
+              crosslinkers_.number_of_bonds(i), sendunbindevents, myrankunbindevents);
           break;
         }
         case 2:
         {
           // dissolve random bond and update states
-          dissolve_bond(crosslinker_i,
-              BeamInteraction::Utils::permutation(cldata_i->get_number_of_bonds())[0],
-              cldata_i->get_number_of_bonds(), sendunbindevents, myrankunbindevents);
+          dissolve_bond(i,
+              BeamInteraction::Utils::permutation(crosslinkers_.number_of_bonds(i))[0],
+              crosslinkers_.number_of_bonds(i), sendunbindevents, myrankunbindevents);
 
           // in case we want to allow transition from double bonded to free, take same linker
           // again
@@ -3584,7 +3249,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::unbind_crosslinker_in_bin
         default:
         {
           FOUR_C_THROW(" Unrealistic number %i of bonds for a crosslinker.",
-              cldata_i->get_number_of_bonds());
+              crosslinkers_.number_of_bonds(i));
           exit(EXIT_FAILURE);
         }
       }
@@ -3696,7 +3361,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::communicate_bin_ids(
 
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
-void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::dissolve_bond(Core::Nodes::Node* linker,
+void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::dissolve_bond(int index,
     int freedbspotid, int numbondsold,
     std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::UnBindEventData>>>&
         sendunbindevents,
@@ -3709,18 +3374,14 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::dissolve_bond(Core::Nodes
   if (numbondsold < 1) FOUR_C_THROW("dissolution of free crosslinker does not make any sense");
 #endif
 
-  CrossLinking::CrosslinkerNode* crosslinker = dynamic_cast<CrossLinking::CrosslinkerNode*>(linker);
-
-  // get linker data
-  const int clcollid = crosslinker->lid();
-  BeamInteraction::Data::CrosslinkerData* cldata = crosslinker_data_[clcollid].get();
+  const int clgid = crosslinkers_.gid(index);
 
   // store unbinding event data
   std::shared_ptr<BeamInteraction::Data::UnBindEventData> unbindevent =
       std::make_shared<BeamInteraction::Data::UnBindEventData>();
-  unbindevent->set_cl_id(linker->id());
-  unbindevent->set_ele_toupdate(cldata->get_b_spots()[freedbspotid]);
-  unbindevent->set_linker_type(crosslinker->get_material()->linker_type());
+  unbindevent->set_cl_id(clgid);
+  unbindevent->set_ele_toupdate(crosslinkers_.bspot(index, freedbspotid));
+  unbindevent->set_linker_type(crosslinker_material(crosslinkers_.type(index)).linker_type());
 
   // owner of beam
   const int beamowner = discret_ptr()->g_element(unbindevent->get_ele_toupdate().first)->owner();
@@ -3735,31 +3396,31 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::dissolve_bond(Core::Nodes
   // update crosslinker status
   // -----------------------------------------------------------------
   // update binding status of linker
-  cldata->set_bspot(freedbspotid, std::make_pair(-1, -1));
+  crosslinkers_.set_bspot(index, freedbspotid, std::make_pair(-1, -1));
 
   // update number of bonds
-  cldata->set_number_of_bonds(numbondsold - 1);
+  crosslinkers_.set_number_of_bonds(index, numbondsold - 1);
 
   if (numbondsold == 1)
   {
-    set_position_of_newly_free_crosslinker(crosslinker, cldata);
+    set_position_of_newly_free_crosslinker(index);
   }
   else if (numbondsold == 2)
   {
     int stayoccpotid = 0;
     if (freedbspotid == 0) stayoccpotid = 1;
 
-    set_position_of_newly_single_bonded_crosslinker(crosslinker, cldata, stayoccpotid);
+    set_position_of_newly_single_bonded_crosslinker(index, stayoccpotid);
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // safety check
-    if (not doublebondcl_.count(linker->id()))
-      FOUR_C_THROW("crosslinker %i with %i bonds is not in double bonded map of rank %i",
-          linker->id(), cldata->get_number_of_bonds() + 1, g_state_ptr()->get_my_rank());
+    if (not doublebondcl_.count(clgid))
+      FOUR_C_THROW("crosslinker %i with %i bonds is not in double bonded map of rank %i", clgid,
+          crosslinkers_.number_of_bonds(index) + 1, g_state_ptr()->get_my_rank());
 #endif
 
     // erase crosslinker from double bonded crosslinker list
-    doublebondcl_.erase(linker->id());
+    doublebondcl_.erase(clgid);
   }
   else
   {
@@ -3996,7 +3657,7 @@ void BeamInteraction::SUBMODELEVALUATOR::Crosslinking::communicate_beam_link_aft
 
 #ifdef FOUR_C_ENABLE_ASSERTIONS
       // some safety checks
-      if (bin_discret_ptr()->g_node(beamtobeamlink->id())->owner() != g_state_ptr()->get_my_rank())
+      if (crosslinkers_.index_of(beamtobeamlink->id()) < 0)
         FOUR_C_THROW(
             " A double bond was sent to rank %i, although it is not the owner of "
             "the cl with gid %i ",
@@ -10,12 +10,14 @@
 
 #include "4C_config.hpp"
 
+#include "4C_beaminteraction_crosslinker_container.hpp"
 #include "4C_beaminteraction_submodel_evaluator_generic.hpp"
 #include "4C_binstrategy_utils.hpp"
 #include "4C_comm_exporter.hpp"
 #include "4C_inpar_beaminteraction.hpp"
 #include "4C_linalg_fixedsizematrix.hpp"
 
+#include <Epetra_Map.h>
 #include <Epetra_MpiComm.h>
 
 FOUR_C_NAMESPACE_OPEN
@@ -29,27 +31,18 @@ namespace Core::Communication
 
 namespace Core::IO
 {
-  class DiscretizationVisualizationWriterNodes;
+  class VisualizationManager;
 }
 
 namespace Mat
 {
   class CrosslinkerMat;
 }
-namespace Core::Nodes
-{
-  class Node;
-}
-
 namespace Core::Elements
 {
   class Element;
 }
 
-namespace CrossLinking
-{
-  class CrosslinkerNode;
-}
 namespace BeamInteraction
 {
   namespace Data
@@ -155,6 +148,19 @@ namespace BeamInteraction
 
       //! @}
 
+      /*!
+       * \brief assign all crosslinkers to their current bin and send them to the bin owner
+       *
+       * Double bonds of crosslinkers that change their owner are sent along. The current
+       * crosslinker positions become the reference positions for the next redistribution check.
+       *
+       * \param[in] binrowmap  row map of bins (only needed to find owners of bins that are
+       *                       unknown on this processor)
+       *
+       * \note collective call
+       */
+      void distribute_crosslinker_to_bins(Epetra_BlockMap const& binrowmap);
+
       //!@name routines that are not derived and handle crosslinking
       //! @{
 
@@ -205,8 +211,8 @@ namespace BeamInteraction
       //!@name routines that are not derived and handle crosslinking
       //! @{
 
-      /// add crosslinker to bin discretization initially
-      void add_crosslinker_to_bin_discretization();
+      /// add free crosslinker to container initially
+      void add_initial_crosslinker();
 
       /// set filament types on elements
       void set_filament_types();
@@ -241,9 +247,9 @@ namespace BeamInteraction
       /// diffuse crosslinker depending on number of bonds they have
       void diffuse_crosslinker();
 
-      /// diffuse unbound crosslinker according to brownian dynamics
-      void diffuse_unbound_crosslinker(
-          Core::Nodes::Node* crosslinker, BeamInteraction::Data::CrosslinkerData* cldata_i);
+      /// diffuse all unbound crosslinker at the given container indices according to
+      /// brownian dynamics
+      void diffuse_unbound_crosslinker(std::vector<int> const& freeindices);
 
       /// get binding spot of crosslinker that is currently occupied
       int get_single_occupied_cl_bspot(std::vector<std::pair<int, int>> const& clbspots) const;
@@ -252,25 +258,29 @@ namespace BeamInteraction
           Core::LinAlg::Matrix<3, 1>& clpos, Core::LinAlg::Matrix<3, 1> const& bspot1pos,
           Core::LinAlg::Matrix<3, 1> const& bspot2pos) const;
 
-      /// new position after transition from single to not bonded
-      void set_position_of_newly_free_crosslinker(CrossLinking::CrosslinkerNode* crosslinker,
-          BeamInteraction::Data::CrosslinkerData* cldata);
+      /// new position of row crosslinker after transition from single to not bonded
+      void set_position_of_newly_free_crosslinker(int index);
 
-      /// new position after transition from double to single bonded
-      void set_position_of_newly_single_bonded_crosslinker(
-          CrossLinking::CrosslinkerNode* crosslinker,
-          BeamInteraction::Data::CrosslinkerData* cldata, int stayoccpotid);
-
-      /// fill epetar vectors to write vtp output
-      void fill_state_data_vectors_for_output(Core::LinAlg::Vector<double>& displacement,
-          Core::LinAlg::Vector<double>& orientation, Core::LinAlg::Vector<double>& numberofbonds,
-          Core::LinAlg::Vector<double>& owner, Core::LinAlg::Vector<double>& force) const;
+      /// new position of row crosslinker after transition from double to single bonded
+      void set_position_of_newly_single_bonded_crosslinker(int index, int stayoccpotid);
 
       /// update maps
       void store_maps_prior_redistribution();
 
-      /// get crosslink data before interaction evaluation
-      void update_and_export_crosslinker_data();
+      /// material of crosslinker type
+      Mat::CrosslinkerMat const& crosslinker_material(int type) const
+      {
+        return *crosslinker_materials_[type];
+      }
+
+      /// container holding the crosslinker of bin with gid bingid (row or ghost crosslinker)
+      BeamInteraction::CrosslinkerContainer const& crosslinker_in_bin(int bingid) const;
+
+      /// determine which of my row bins are ghosted by which processor
+      void build_ghosted_bins_per_rank();
+
+      /// send copies of crosslinker in my row bins to all processors ghosting these bins
+      void export_ghost_crosslinker();
 
       /// get beam data before interaction evaluation
       void update_and_export_beam_data(bool update_states = true);
@@ -306,7 +316,7 @@ namespace BeamInteraction
               undecidedbonds);
 
       /// find potential binding events in one bin
-      void find_potential_binding_events_in_bin_and_neighborhood(Core::Elements::Element* bin,
+      void find_potential_binding_events_in_bin_and_neighborhood(int bingid,
           std::map<int, std::shared_ptr<BeamInteraction::Data::BindEventData>>& mybonds,
           std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::BindEventData>>>&
               undecidedbonds,
@@ -316,12 +326,12 @@ namespace BeamInteraction
       /// check if sphere should prohibit binding if double bond would be to close
       bool check_if_sphere_prohibits_binding(
           std::set<Core::Elements::Element*> const& neighboring_col_spheres,
-          Core::Nodes::Node* node_i) const;
+          BeamInteraction::CrosslinkerContainer const& linkers, int index) const;
 
       /// search for binding events on each proc separately (i.e. pretending myrank is alone)
       /// communication to ensure correct binding over all procs is done afterwards
-      void prepare_binding(Core::Nodes::Node* node_i,
-          std::set<Core::Elements::Element*> const& neighboring_beams,
+      void prepare_binding(BeamInteraction::CrosslinkerContainer const& linkers, int index,
+          int owner, std::set<Core::Elements::Element*> const& neighboring_beams,
           std::map<int, std::shared_ptr<BeamInteraction::Data::BindEventData>>& mybonds,
           std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::BindEventData>>>&
               undecidedbonds,
@@ -329,17 +339,15 @@ namespace BeamInteraction
           bool checklinkingprop);
 
       /// check criteria if binding event is feasible
-      bool check_bind_event_criteria(CrossLinking::CrosslinkerNode const* const crosslinker_i,
-          Core::Elements::Element const* const potbeampartner,
-          BeamInteraction::Data::CrosslinkerData* cldata_i,
+      bool check_bind_event_criteria(BeamInteraction::CrosslinkerContainer const& linkers,
+          int index, Core::Elements::Element const* const potbeampartner,
           BeamInteraction::Data::BeamData const* beamdata_i, int locnbspot,
           std::map<int, std::vector<std::map<int, std::set<int>>>>& intendedbeambonds,
           bool checklinkingprop) const;
 
       // check if identical bond already exists
       bool return_false_if_identical_bond_already_exists(
-          CrossLinking::CrosslinkerNode const* const crosslinker_i,
-          BeamInteraction::Data::CrosslinkerData* cldata_i,
+          BeamInteraction::CrosslinkerContainer const& linkers, int index,
           std::map<int, std::vector<std::map<int, std::set<int>>>>& intendedbeambonds,
           BeamInteraction::Data::BeamData const* beamdata_i, int locnbspot,
           int potbeampartnerrowlid) const;
@@ -352,10 +360,8 @@ namespace BeamInteraction
       /// if crosslinker is singly bound, we fetch the orientation vector of the
       /// filament axis at the already occupied binding spot for the orientation
       /// criterion (enclosed angle) to be checked later on
-      void get_occupied_cl_b_spot_beam_tangent(
-          CrossLinking::CrosslinkerNode const* const crosslinker_i,
-          BeamInteraction::Data::CrosslinkerData* cldata_i,
-          Core::LinAlg::Matrix<3, 1>& occ_bindingspot_beam_tangent, int clgid) const;
+      void get_occupied_cl_b_spot_beam_tangent(BeamInteraction::CrosslinkerContainer const& linkers,
+          int index, Core::LinAlg::Matrix<3, 1>& occ_bindingspot_beam_tangent) const;
 
       /// decide by asking other procs who is allowed to set specific crosslinker,
       /// this is necessary to avoid setting crosslinker more than once per time step
@@ -425,7 +431,7 @@ namespace BeamInteraction
 
       /// calculate force dependent unbind probability for double bonded crosslinker
       /// according to Bell's equation (Howard, eq 5.10, p.89)
-      void calc_bells_force_dependent_unbind_probability(CrossLinking::CrosslinkerNode* linker,
+      void calc_bells_force_dependent_unbind_probability(int index,
           BeamInteraction::BeamLink& elepairptr, std::vector<double>& punlinkforcedependent) const;
 
       /// communicate crosslinker unbinding event data
@@ -439,19 +445,12 @@ namespace BeamInteraction
       void update_beam_binding_status_after_unbinding(
           std::vector<std::shared_ptr<BeamInteraction::Data::UnBindEventData>> const& unbindevent);
 
-      /// -------------------------------------------------------------------------
-      /// in case we have double bonded crosslinker on myrank we have to check if
-      /// myrank is still owner of all its crosslinker (if not, set up double bond on
-      /// other proc that is now responsible)
-      /// -------------------------------------------------------------------------
-      void update_my_double_bonds_after_redistribution();
-
       /// in case char vector containing double bonds is read by proc != proc
       /// that has written
       void update_my_double_bonds_remote_id_list();
 
-      /// dissolve certain bonds
-      void dissolve_bond(Core::Nodes::Node* linker, int freedbspotid, int numbondsold,
+      /// dissolve certain bonds of row crosslinker at index
+      void dissolve_bond(int index, int freedbspotid, int numbondsold,
           std::map<int, std::vector<std::shared_ptr<BeamInteraction::Data::UnBindEventData>>>&
               sendunbindevents,
           std::vector<std::shared_ptr<BeamInteraction::Data::UnBindEventData>>& myrankunbindevents);
@@ -499,12 +498,17 @@ namespace BeamInteraction
       //! data container holding all beam contact related parameters
       std::shared_ptr<BeamInteraction::CrosslinkingParams> crosslinking_params_ptr_;
 
-      //! temporary storage for all relevant crosslinker data
-      //! (vector key is col lid of crosslinker)
-      std::vector<std::shared_ptr<BeamInteraction::Data::CrosslinkerData>> crosslinker_data_;
+      //! crosslinker residing in row bins of myrank (myrank is owner of these)
+      BeamInteraction::CrosslinkerContainer crosslinkers_;
+
+      //! copies of crosslinker residing in ghosted bins of myrank
+      BeamInteraction::CrosslinkerContainer ghost_crosslinkers_;
 
-      //! crosslinker exporter for crosslinker data container
-      std::shared_ptr<Core::Communication::Exporter> cl_exporter_;
+      //! row bins of myrank that are ghosted by each processor (vector index is rank)
+      std::vector<std::vector<int>> ghosted_bins_per_rank_;
+
+      //! materials of all crosslinker types (vector index is crosslinker type)
+      std::vector<std::shared_ptr<Mat::CrosslinkerMat>> crosslinker_materials_;
 
       //! beam exporter for beam data container
       std::shared_ptr<Core::Communication::Exporter> beam_exporter_;
@@ -516,25 +520,12 @@ namespace BeamInteraction
       //! double bonded crosslinker that exert forces on network (map key is crosslinker gid)
       std::map<int, std::shared_ptr<BeamInteraction::BeamLink>> doublebondcl_;
 
-      //! linker, i.e. crosslinker molecule discretization runtime vtp writer
-      std::shared_ptr<Core::IO::DiscretizationVisualizationWriterNodes>
-          visualization_output_writer_ptr_;
-
-      //! current linker displacement
-      std::shared_ptr<Core::LinAlg::Vector<double>> linker_disnp_;
-
-      //! summarized displacement of nodes since last redistribution
-      std::shared_ptr<Core::LinAlg::Vector<double>> dis_at_last_redistr_;
+      //! linker, i.e. crosslinker molecule runtime vtp writer
+      std::shared_ptr<Core::IO::VisualizationManager> visualization_manager_ptr_;
 
       //! half interaction distance considering largest linker + tolerance
       double half_interaction_distance_;
 
-      //! store node row map before current redistribution
-      std::shared_ptr<Epetra_Map> cl_noderowmap_prior_redistr_;
-
-      //! store node row map before current redistribution
-      std::shared_ptr<Epetra_Map> cl_nodecolmap_prior_redistr_;
-
       //! store node row map before current redistribution
       std::shared_ptr<Epetra_Map> beam_elerowmap_prior_redistr_;
 
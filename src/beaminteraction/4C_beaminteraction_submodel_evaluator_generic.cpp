@@ -8,7 +8,6 @@
 #include "4C_beaminteraction_submodel_evaluator_generic.hpp"
 
 #include "4C_beaminteraction_calc_utils.hpp"
-#include "4C_beaminteraction_crosslinker_handler.hpp"
 #include "4C_beaminteraction_str_model_evaluator_datastate.hpp"
 #include "4C_fem_geometry_periodic_boundingbox.hpp"
 #include "4C_utils_exceptions.hpp"
@@ -27,7 +26,6 @@ BeamInteraction::SUBMODELEVALUATOR::Generic::Generic()
       gstate_ptr_(nullptr),
       gio_ptr_(nullptr),
       beaminteractiondatastate_(nullptr),
-      beam_crosslinker_handler_(nullptr),
       binstrategy_(nullptr),
       periodic_boundingbox_(nullptr),
       eletypeextractor_(nullptr)
@@ -43,7 +41,6 @@ void BeamInteraction::SUBMODELEVALUATOR::Generic::init(
     std::shared_ptr<Solid::TimeInt::BaseDataGlobalState> const& gstate,
     std::shared_ptr<Solid::TimeInt::BaseDataIO> const& gio_ptr,
     std::shared_ptr<Solid::ModelEvaluator::BeamInteractionDataState> const& ia_gstate_ptr,
-    std::shared_ptr<BeamInteraction::BeamCrosslinkerHandler> const& beamcrosslinkerhandler,
     std::shared_ptr<Core::Binstrategy::BinningStrategy> binstrategy,
     std::shared_ptr<Core::Geo::MeshFree::BoundingBox> const& periodic_boundingbox,
     std::shared_ptr<BeamInteraction::Utils::MapExtractor> const& eletypeextractor)
@@ -55,7 +52,6 @@ void BeamInteraction::SUBMODELEVALUATOR::Generic::init(
   gstate_ptr_ = gstate;
   gio_ptr_ = gio_ptr;
   beaminteractiondatastate_ = ia_gstate_ptr;
-  beam_crosslinker_handler_ = beamcrosslinkerhandler;
   binstrategy_ = binstrategy;
   periodic_boundingbox_ = periodic_boundingbox;
   eletypeextractor_ = eletypeextractor;
@@ -214,24 +210,6 @@ BeamInteraction::SUBMODELEVALUATOR::Generic::beam_interaction_data_state() const
   return *beaminteractiondatastate_;
 }
 
-/*----------------------------------------------------------------------------*
- *----------------------------------------------------------------------------*/
-BeamInteraction::BeamCrosslinkerHandler&
-BeamInteraction::SUBMODELEVALUATOR::Generic::beam_crosslinker_handler()
-{
-  check_init();
-  return *beam_crosslinker_handler_;
-}
-
-/*----------------------------------------------------------------------------*
- *----------------------------------------------------------------------------*/
-std::shared_ptr<BeamInteraction::BeamCrosslinkerHandler>&
-BeamInteraction::SUBMODELEVALUATOR::Generic::beam_crosslinker_handler_ptr()
-{
-  check_init();
-  return beam_crosslinker_handler_;
-}
-
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 Core::Binstrategy::BinningStrategy const&
@@ -258,15 +236,6 @@ BeamInteraction::SUBMODELEVALUATOR::Generic::bin_strategy_ptr()
   return binstrategy_;
 }
 
-/*----------------------------------------------------------------------------*
- *----------------------------------------------------------------------------*/
-BeamInteraction::BeamCrosslinkerHandler const&
-BeamInteraction::SUBMODELEVALUATOR::Generic::beam_crosslinker_handler() const
-{
-  check_init();
-  return *beam_crosslinker_handler_;
-}
-
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 Core::Geo::MeshFree::BoundingBox&
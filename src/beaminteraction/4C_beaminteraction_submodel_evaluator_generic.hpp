@@ -57,8 +57,6 @@ namespace Solid
 }  // namespace Solid
 namespace BeamInteraction
 {
-  class BeamCrosslinkerHandler;
-
   namespace Utils
   {
     class MapExtractor;
@@ -89,7 +87,6 @@ namespace BeamInteraction
           std::shared_ptr<Solid::TimeInt::BaseDataGlobalState> const& gstate,
           std::shared_ptr<Solid::TimeInt::BaseDataIO> const& gio_ptr,
           std::shared_ptr<Solid::ModelEvaluator::BeamInteractionDataState> const& ia_gstate_ptr,
-          std::shared_ptr<BeamInteraction::BeamCrosslinkerHandler> const& beamcrosslinkerhandler,
           std::shared_ptr<Core::Binstrategy::BinningStrategy> binstrategy,
           std::shared_ptr<Core::Geo::MeshFree::BoundingBox> const& periodic_boundingbox,
           std::shared_ptr<BeamInteraction::Utils::MapExtractor> const& eletypeextractor);
@@ -222,10 +219,6 @@ namespace BeamInteraction
       beam_interaction_data_state_ptr();
       Solid::ModelEvaluator::BeamInteractionDataState const& beam_interaction_data_state() const;
 
-      BeamInteraction::BeamCrosslinkerHandler& beam_crosslinker_handler();
-      std::shared_ptr<BeamInteraction::BeamCrosslinkerHandler>& beam_crosslinker_handler_ptr();
-      BeamInteraction::BeamCrosslinkerHandler const& beam_crosslinker_handler() const;
-
       Core::Binstrategy::BinningStrategy& bin_strategy();
       std::shared_ptr<Core::Binstrategy::BinningStrategy>& bin_strategy_ptr();
       Core::Binstrategy::BinningStrategy const& bin_strategy() const;
@@ -262,9 +255,6 @@ namespace BeamInteraction
       //! pointer to the global state data container
       std::shared_ptr<Solid::ModelEvaluator::BeamInteractionDataState> beaminteractiondatastate_;
 
-      //! beam crosslinker handler
-      std::shared_ptr<BeamInteraction::BeamCrosslinkerHandler> beam_crosslinker_handler_;
-
       //! binning strategy
       std::shared_ptr<Core::Binstrategy::BinningStrategy> binstrategy_;
 
@@ -10,7 +10,6 @@
 #include "4C_beam3_base.hpp"
 #include "4C_beaminteraction_beam_to_beam_contact_utils.hpp"
 #include "4C_beaminteraction_calc_utils.hpp"
-#include "4C_beaminteraction_crosslinker_handler.hpp"
 #include "4C_beaminteraction_potential_pair.hpp"
 #include "4C_beaminteraction_potential_params.hpp"
 #include "4C_beaminteraction_potential_runtime_visualization_output_params.hpp"
@@ -9,7 +9,6 @@
 
 #include "4C_beam3_base.hpp"
 #include "4C_beaminteraction_calc_utils.hpp"
-#include "4C_beaminteraction_crosslinker_handler.hpp"
 #include "4C_beaminteraction_crosslinker_node.hpp"
 #include "4C_beaminteraction_link_beam3_reissner_line2_pinjointed.hpp"
 #include "4C_beaminteraction_link_pinjointed.hpp"
@@ -19,7 +19,9 @@
 #include "4C_fem_condition.hpp"
 #include "4C_global_data.hpp"
 #include "4C_io.hpp"
+#include "4C_linalg_blocksparsematrix.hpp"
 #include "4C_linalg_mapextractor.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_utils_densematrix_communication.hpp"
 #include "4C_linalg_utils_sparse_algebra_assemble.hpp"
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
@@ -29,9 +31,12 @@
 #include "4C_linear_solver_method_linalg.hpp"
 #include "4C_utils_parameter_list.hpp"
 
+#include <Epetra_Import.h>
 #include <stdio.h>
 #include <Teuchos_ParameterList.hpp>
+#include <Teuchos_SerialDenseSolver.hpp>
 #include <Teuchos_StandardParameterEntryValidators.hpp>
+#include <Teuchos_TimeMonitor.hpp>
 
 #include <iostream>
 
@@ -982,9 +987,10 @@ int Utils::Cardiovascular0DManager::solve(Core::LinAlg::SparseMatrix& mat_struct
 
   if (have_mor_)
   {
-    // reduce linear system
+    // reduce linear system, with hyper-reduction the element contributions are already reduced
     std::shared_ptr<Core::LinAlg::SparseMatrix> mat_structstiff_R =
-        mor_->reduce_diagonal(mat_structstiff);
+        mor_->have_hyper_reduction() ? mor_->reduce_diagonal_hyper_reduced(mat_structstiff)
+                                     : mor_->reduce_diagonal(mat_structstiff);
     std::shared_ptr<Core::LinAlg::SparseMatrix> mat_dcardvasc0d_dd_R =
         mor_->reduce_off_diagonal(*mat_dcardvasc0d_dd);
     std::shared_ptr<Core::LinAlg::SparseMatrix> mat_dstruct_dcv0ddof_R =
@@ -1093,6 +1099,12 @@ int Utils::Cardiovascular0DManager::solve(Core::LinAlg::SparseMatrix& mat_struct
       actdisc_->compute_null_space_if_necessary(solver_->params().sublist("Inverse2"), true);
       break;
     }
+    case Inpar::Cardiovascular0D::cardvasc0dsolve_schur:
+    {
+      // the solver is only applied to the structural block
+      if (not have_mor_) actdisc_->compute_null_space_if_necessary(solver_->params(), true);
+      break;
+    }
     default:
       FOUR_C_THROW("Unknown 0D cardiovascular-structural solution technique!");
   }
@@ -1117,7 +1129,11 @@ int Utils::Cardiovascular0DManager::solve(Core::LinAlg::SparseMatrix& mat_struct
   // solve with BlockMatrix
   solver_params.refactor = true;
   solver_params.reset = counter_ == 0;
-  linsolveerror_ = solver_->solve(blockmat, mergedsol, mergedrhs, solver_params);
+  if (algochoice_ == Inpar::Cardiovascular0D::cardvasc0dsolve_schur)
+    linsolveerror_ = FourC::Cardiovascular0D::solve_schur_complement(
+        *solver_, *blockmat, *mergedsol, *mergedrhs, solver_params);
+  else
+    linsolveerror_ = solver_->solve(blockmat, mergedsol, mergedrhs, solver_params);
   solver_->reset_tolerance();
 
   // initialize mergedsol_full to keep it in scope after the following if-condition
@@ -1159,4 +1175,107 @@ int Utils::Cardiovascular0DManager::solve(Core::LinAlg::SparseMatrix& mat_struct
   return linsolveerror_;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Cardiovascular0D::solve_schur_complement(Core::LinAlg::Solver& solver,
+    Core::LinAlg::BlockSparseMatrixBase& blockmat, Core::LinAlg::Vector<double>& mergedsol,
+    const Core::LinAlg::Vector<double>& mergedrhs, const Core::LinAlg::SolverParams& solver_params)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Cardiovascular0D::solve_schur_complement");
+
+  if (blockmat.rows() != 2 or blockmat.cols() != 2)
+    FOUR_C_THROW("The Schur complement solution requires a structural and a 0D block.");
+  const Core::LinAlg::MultiMapExtractor& mapext = blockmat.range_extractor();
+
+  Core::LinAlg::SparseMatrix& mat_k = blockmat.matrix(0, 0);
+  const Core::LinAlg::SparseMatrix& mat_b = blockmat.matrix(0, 1);
+  const Core::LinAlg::SparseMatrix& mat_c = blockmat.matrix(1, 0);
+  const Core::LinAlg::SparseMatrix& mat_a = blockmat.matrix(1, 1);
+
+  const Epetra_Map& structmap = *mapext.Map(0);
+  const Epetra_Map& cv0dmap = *mapext.Map(1);
+
+  // the 0D dofs are few, so all their values are kept redundantly on every processor
+  std::shared_ptr<Epetra_Map> cv0dmap_redundant = Core::LinAlg::allreduce_e_map(cv0dmap);
+  Epetra_Import cv0d_importer(*cv0dmap_redundant, cv0dmap);
+  const int num_cv0d = cv0dmap_redundant->NumMyElements();
+
+  // unit vectors of the 0D dofs
+  Core::LinAlg::MultiVector<double> unit(cv0dmap, num_cv0d, true);
+  for (int j = 0; j < num_cv0d; ++j)
+  {
+    const int gid = cv0dmap_redundant->GID(j);
+    if (cv0dmap.MyGID(gid)) unit.ReplaceGlobalValue(gid, j, 1.0);
+  }
+
+  // coupling columns B e_j, only the 0D dofs acting on the structure need a structural solve
+  Core::LinAlg::MultiVector<double> coupling_columns(structmap, num_cv0d, true);
+  mat_b.multiply(false, unit, coupling_columns);
+  std::vector<double> coupling_norms(num_cv0d);
+  coupling_columns.Norm2(coupling_norms.data());
+
+  std::vector<int> coupled_cv0d;
+  for (int j = 0; j < num_cv0d; ++j)
+    if (coupling_norms[j] > 0.0) coupled_cv0d.push_back(j);
+  const int num_coupled = static_cast<int>(coupled_cv0d.size());
+
+  // solve K [X y] = [B f_s] with multiple right hand sides, the last column is the structural rhs
+  auto rhs = std::make_shared<Core::LinAlg::MultiVector<double>>(structmap, num_coupled + 1, true);
+  auto sol = std::make_shared<Core::LinAlg::MultiVector<double>>(structmap, num_coupled + 1, true);
+  for (int i = 0; i < num_coupled; ++i)
+    (*rhs)(i).Update(1.0, coupling_columns(coupled_cv0d[i]), 0.0);
+  mapext.extract_vector(mergedrhs, 0, (*rhs)(num_coupled));
+
+  int error = solver.solve_with_multi_vector(
+      Core::Utils::shared_ptr_from_ref(mat_k), sol, rhs, solver_params);
+
+  // Schur complement S = A - C X and reduced rhs f_0 - C y, gathered on every processor
+  Core::LinAlg::MultiVector<double> a_unit(cv0dmap, num_cv0d, true);
+  mat_a.multiply(false, unit, a_unit);
+  Core::LinAlg::MultiVector<double> c_sol(cv0dmap, num_coupled + 1, true);
+  mat_c.multiply(false, *sol, c_sol);
+
+  Core::LinAlg::MultiVector<double> a_unit_redundant(*cv0dmap_redundant, num_cv0d, true);
+  a_unit_redundant.Import(a_unit, cv0d_importer, Insert);
+  Core::LinAlg::MultiVector<double> c_sol_redundant(*cv0dmap_redundant, num_coupled + 1, true);
+  c_sol_redundant.Import(c_sol, cv0d_importer, Insert);
+  Core::LinAlg::Vector<double> rhs_cv0d(cv0dmap, true);
+  mapext.extract_vector(mergedrhs, 1, rhs_cv0d);
+  Core::LinAlg::Vector<double> rhs_cv0d_redundant(*cv0dmap_redundant, true);
+  rhs_cv0d_redundant.Import(rhs_cv0d, cv0d_importer, Insert);
+
+  auto schur = Teuchos::make_rcp<Core::LinAlg::SerialDenseMatrix>(num_cv0d, num_cv0d, true);
+  auto rhs_schur = Teuchos::make_rcp<Core::LinAlg::SerialDenseMatrix>(num_cv0d, 1, true);
+  auto sol_schur = Teuchos::make_rcp<Core::LinAlg::SerialDenseMatrix>(num_cv0d, 1, true);
+  for (int i = 0; i < num_cv0d; ++i)
+  {
+    for (int j = 0; j < num_cv0d; ++j) (*schur)(i, j) = a_unit_redundant(j)[i];
+    for (int k = 0; k < num_coupled; ++k) (*schur)(i, coupled_cv0d[k]) -= c_sol_redundant(k)[i];
+    (*rhs_schur)(i, 0) = rhs_cv0d_redundant[i] - c_sol_redundant(num_coupled)[i];
+  }
+
+  Teuchos::SerialDenseSolver<int, double> schur_solver;
+  schur_solver.setMatrix(schur);
+  schur_solver.setVectors(sol_schur, rhs_schur);
+  schur_solver.factorWithEquilibration(true);
+  if (schur_solver.solve() != 0) FOUR_C_THROW("Solution of the 0D Schur complement system failed.");
+
+  // back substitution d = y - X p
+  Core::LinAlg::Vector<double> dispinc((*sol)(num_coupled));
+  for (int k = 0; k < num_coupled; ++k)
+    dispinc.Update(-(*sol_schur)(coupled_cv0d[k], 0), (*sol)(k), 1.0);
+
+  Core::LinAlg::Vector<double> cv0ddofinc(cv0dmap, true);
+  for (int i = 0; i < num_cv0d; ++i)
+  {
+    const int gid = cv0dmap_redundant->GID(i);
+    if (cv0dmap.MyGID(gid)) cv0ddofinc.ReplaceGlobalValue(gid, 0, (*sol_schur)(i, 0));
+  }
+
+  mapext.insert_vector(dispinc, 0, mergedsol);
+  mapext.insert_vector(cv0ddofinc, 1, mergedsol);
+
+  return error;
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -36,17 +36,38 @@ namespace Core::FE
 
 namespace Core::LinAlg
 {
+  class BlockSparseMatrixBase;
   class SparseMatrix;
   class SparseOperator;
   class MapExtractor;
   class MultiMapExtractor;
   class Solver;
+  struct SolverParams;
 }  // namespace Core::LinAlg
 
 namespace Cardiovascular0D
 {
   class ProperOrthogonalDecomposition;
-}
+
+  /*! \brief Solve the coupled block system by a Schur complement of the 0D block
+
+   The structural block K is solved once for the nonzero coupling columns of B and the
+   structural right hand side (one solve with multiple right hand sides). The small dense
+   Schur complement S = A - C K^{-1} B is redundant on all processors and solved directly for
+   the 0D dofs, afterwards the structural increment follows by back substitution.
+
+   \verbatim
+     [ K  B ] [ d ]   [ f_s ]
+     [ C  A ] [ p ] = [ f_0 ]
+   \endverbatim
+
+   The block system has to consist of the structural and the 0D block, in this order.
+  */
+  int solve_schur_complement(Core::LinAlg::Solver& solver,
+      Core::LinAlg::BlockSparseMatrixBase& blockmat, Core::LinAlg::Vector<double>& mergedsol,
+      const Core::LinAlg::Vector<double>& mergedrhs,
+      const Core::LinAlg::SolverParams& solver_params);
+}  // namespace Cardiovascular0D
 
 namespace Utils
 {
@@ -8,20 +8,51 @@
 #include "4C_cardiovascular0d_mor_pod.hpp"
 
 #include "4C_comm_mpi_utils.hpp"
+#include "4C_comm_parobjectfactory.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_element.hpp"
 #include "4C_io.hpp"
 #include "4C_io_control.hpp"
 #include "4C_linalg_utils_sparse_algebra_math.hpp"
 #include "4C_utils_string.hpp"
 
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * \brief Make a file name given relative to the input file absolute
+   */
+  std::string absolute_file_path(
+      const std::string& file_name, const std::string& absolute_path_to_input_file)
+  {
+    std::string absolute_path = file_name;
+    if (file_name[0] != '/')
+    {
+      std::string::size_type pos = absolute_path_to_input_file.rfind('/');
+      if (pos != std::string::npos)
+      {
+        std::string path = absolute_path_to_input_file.substr(0, pos + 1);
+        absolute_path.insert(absolute_path.begin(), path.begin(), path.end());
+      }
+    }
+    return absolute_path;
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 Cardiovascular0D::ProperOrthogonalDecomposition::ProperOrthogonalDecomposition(
     std::shared_ptr<const Epetra_Map> full_model_dof_row_map,
-    const std::string& pod_matrix_file_name, const std::string& absolute_path_to_input_file)
+    const std::string& pod_matrix_file_name, const std::string& ecsw_weights_file_name,
+    const std::string& absolute_path_to_input_file)
     : full_model_dof_row_map_(full_model_dof_row_map)
 {
   // check if model order reduction is given in input file
@@ -38,23 +69,8 @@ Cardiovascular0D::ProperOrthogonalDecomposition::ProperOrthogonalDecomposition(
   std::shared_ptr<Core::LinAlg::MultiVector<double>> reduced_basis = nullptr;
 
   // read projection matrix from binary file
-  {
-    std::string absolute_path_to_pod_file = pod_matrix_file_name;
-
-    // Make sure that we have the absolute path to the file
-    if (pod_matrix_file_name[0] != '/')
-    {
-      std::string::size_type pos = absolute_path_to_input_file.rfind('/');
-      if (pos != std::string::npos)
-      {
-        std::string path = absolute_path_to_input_file.substr(0, pos + 1);
-        absolute_path_to_pod_file.insert(
-            absolute_path_to_pod_file.begin(), path.begin(), path.end());
-      }
-    }
-
-    read_pod_basis_vectors_from_file(absolute_path_to_pod_file, reduced_basis);
-  }
+  read_pod_basis_vectors_from_file(
+      absolute_file_path(pod_matrix_file_name, absolute_path_to_input_file), reduced_basis);
 
   // build an importer
   Epetra_Import dofrowimporter(*full_model_dof_row_map_, (reduced_basis->Map()));
@@ -83,9 +99,240 @@ Cardiovascular0D::ProperOrthogonalDecomposition::ProperOrthogonalDecomposition(
   structrimpo_ = std::make_shared<Epetra_Import>(*structmapr_, *redstructmapr_);
   structrinvimpo_ = std::make_shared<Epetra_Import>(*redstructmapr_, *structmapr_);
 
+  // check if hyper-reduction is given in input file
+  {
+    std::vector<std::string> components_of_absolute_path =
+        Core::Utils::split_string_list(ecsw_weights_file_name, "/");
+    if (components_of_absolute_path.back() != std::string("none")) havehyperreduction_ = true;
+  }
+
+  // read reduced mesh and weights from text file
+  if (havehyperreduction_)
+    read_ecsw_weights_from_file(
+        absolute_file_path(ecsw_weights_file_name, absolute_path_to_input_file));
+
   return;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::add_projected_element_matrix(
+    const Core::LinAlg::SerialDenseMatrix& elematrix,
+    const Core::LinAlg::SerialDenseMatrix& basis_row,
+    const Core::LinAlg::SerialDenseMatrix& basis_col, const double weight,
+    Core::LinAlg::SerialDenseMatrix& reducedmatrix)
+{
+  FOUR_C_ASSERT(elematrix.num_rows() == basis_row.num_rows() and
+                    elematrix.num_cols() == basis_col.num_rows(),
+      "Element matrix does not match the element dofs of the reduced basis.");
+
+  // K_e * V_c
+  Core::LinAlg::SerialDenseMatrix tmp(elematrix.num_rows(), basis_col.num_cols(), true);
+  tmp.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, elematrix, basis_col, 0.0);
+
+  // M_red += weight * V_r^T * (K_e * V_c)
+  reducedmatrix.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, weight, basis_row, tmp, 1.0);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::ProperOrthogonalDecomposition::evaluate_hyper_reduced(
+    Core::FE::Discretization& discret, Teuchos::ParameterList& params,
+    Core::FE::AssembleStrategy& strategy)
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "Cardiovascular0D::ProperOrthogonalDecomposition::evaluate_hyper_reduced");
+
+  if (!discret.filled()) FOUR_C_THROW("fill_complete() was not called");
+  if (!discret.have_dofs()) FOUR_C_THROW("assign_degrees_of_freedom() was not called");
+
+  const int row = strategy.first_dof_set();
+  const int col = strategy.second_dof_set();
+  if (row != 0 or col != 0) FOUR_C_THROW("Hyper-reduction is only available for dof set 0.");
+
+  // reduced basis at the dofs of the column elements
+  if (projmatrixcol_ == nullptr or not projmatrixcol_->Map().SameAs(*discret.dof_col_map()))
+  {
+    projmatrixcol_ = std::make_shared<Core::LinAlg::MultiVector<double>>(
+        *discret.dof_col_map(), projmatrix_->NumVectors(), true);
+    Epetra_Import colimporter(*discret.dof_col_map(), *full_model_dof_row_map_);
+    const int err = projmatrixcol_->Import(*projmatrix_, colimporter, Insert, nullptr);
+    if (err != 0) FOUR_C_THROW("POD projection matrix could not be mapped onto the dof col map");
+  }
+
+  const int reddim = projmatrix_->NumVectors();
+  Core::LinAlg::SerialDenseMatrix localmatrix1(reddim, reddim, true);
+  Core::LinAlg::SerialDenseMatrix localmatrix2(reddim, reddim, true);
+
+  Core::Communication::ParObjectFactory::instance().pre_evaluate(discret, params,
+      strategy.systemmatrix1(), strategy.systemmatrix2(), strategy.systemvector1(),
+      strategy.systemvector2(), strategy.systemvector3());
+
+  const int myrank = Core::Communication::my_mpi_rank(discret.get_comm());
+  Core::Elements::LocationArray la(discret.num_dof_sets());
+
+  // loop over the sampled column elements only, the vector assembly takes care of the ownership of
+  // the rows just like in the loop over all elements
+  for (const auto& [gid, weight] : ecsw_weights_)
+  {
+    if (not discret.have_global_element(gid)) continue;
+    Core::Elements::Element* actele = discret.g_element(gid);
+
+    actele->location_vector(discret, la, false);
+    strategy.clear_element_storage(la[row].size(), la[col].size());
+
+    const int err = actele->evaluate(params, discret, la, strategy.elematrix1(),
+        strategy.elematrix2(), strategy.elevector1(), strategy.elevector2(), strategy.elevector3());
+    if (err) FOUR_C_THROW("Proc %d: Element %d returned err=%d", myrank, gid, err);
+
+    // weighting of the element vectors
+    strategy.elevector1().scale(weight);
+    strategy.elevector2().scale(weight);
+    strategy.elevector3().scale(weight);
+
+    strategy.assemble_vector1(la[row].lm_, la[row].lmowner_);
+    strategy.assemble_vector2(la[row].lm_, la[row].lmowner_);
+    strategy.assemble_vector3(la[row].lm_, la[row].lmowner_);
+
+    // every element matrix is projected once, i.e. by the owner of the element
+    if (actele->owner() != myrank) continue;
+
+    const Core::LinAlg::SerialDenseMatrix basis = extract_basis_rows(*projmatrixcol_, la[row].lm_);
+    if (strategy.assemblemat1())
+      add_projected_element_matrix(strategy.elematrix1(), basis, basis, weight, localmatrix1);
+    if (strategy.assemblemat2())
+      add_projected_element_matrix(strategy.elematrix2(), basis, basis, weight, localmatrix2);
+  }
+
+  hyperreducedmatrix1_.shape(reddim, reddim);
+  hyperreducedmatrix2_.shape(reddim, reddim);
+  Core::Communication::sum_all(localmatrix1.values(), hyperreducedmatrix1_.values(),
+      reddim * reddim, discret.get_comm());
+  Core::Communication::sum_all(localmatrix2.values(), hyperreducedmatrix2_.values(),
+      reddim * reddim, discret.get_comm());
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::ProperOrthogonalDecomposition::combine_hyper_reduced_stiffness(
+    const double fac_matrix1, const double fac_matrix2,
+    const std::vector<std::pair<double, const Core::LinAlg::SparseMatrix*>>& constant_matrices)
+{
+  const int reddim = projmatrix_->NumVectors();
+  if (hyperreducedmatrix1_.num_rows() != reddim)
+    FOUR_C_THROW("evaluate_hyper_reduced() was not called");
+
+  hyperreducedstiffness_.shape(reddim, reddim);
+  Core::LinAlg::update(fac_matrix1, hyperreducedmatrix1_, 0.0, hyperreducedstiffness_);
+  Core::LinAlg::update(fac_matrix2, hyperreducedmatrix2_, 1.0, hyperreducedstiffness_);
+
+  for (const auto& [fac, matrix] : constant_matrices)
+  {
+    auto [it, inserted] = constantreducedmatrices_.try_emplace(matrix);
+    if (inserted) it->second = project_sparse_matrix(*matrix);
+    Core::LinAlg::update(fac, it->second, 1.0, hyperreducedstiffness_);
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::SparseMatrix>
+Cardiovascular0D::ProperOrthogonalDecomposition::reduce_diagonal_hyper_reduced(
+    const Core::LinAlg::SparseMatrix& M)
+{
+  const int reddim = projmatrix_->NumVectors();
+  if (hyperreducedstiffness_.num_rows() != reddim)
+    FOUR_C_THROW("combine_hyper_reduced_stiffness() was not called");
+
+  Core::LinAlg::SerialDenseMatrix M_red = project_sparse_matrix(M);
+  Core::LinAlg::update(1.0, hyperreducedstiffness_, 1.0, M_red);
+
+  // every proc holds all values, so it assembles its own rows of the reduced map
+  std::shared_ptr<Core::LinAlg::SparseMatrix> M_red_sparse =
+      std::make_shared<Core::LinAlg::SparseMatrix>(*structmapr_, reddim, false, true);
+  for (int lid = 0; lid < structmapr_->NumMyElements(); ++lid)
+  {
+    const int rowgid = structmapr_->GID(lid);
+    for (int colgid = 0; colgid < reddim; ++colgid)
+      M_red_sparse->assemble(M_red(rowgid, colgid), rowgid, colgid);
+  }
+  M_red_sparse->complete();
+
+  return M_red_sparse;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::LinAlg::SerialDenseMatrix
+Cardiovascular0D::ProperOrthogonalDecomposition::project_sparse_matrix(
+    const Core::LinAlg::SparseMatrix& M)
+{
+  const int reddim = projmatrix_->NumVectors();
+
+  // reduced basis at the rows and columns of M
+  Core::LinAlg::MultiVector<double> basis_row(M.row_map(), reddim, true);
+  {
+    Epetra_Import importer(M.row_map(), *full_model_dof_row_map_);
+    const int err = basis_row.Import(*projmatrix_, importer, Insert, nullptr);
+    if (err != 0) FOUR_C_THROW("POD projection matrix could not be mapped onto the row map");
+  }
+  Core::LinAlg::MultiVector<double> basis_col(M.col_map(), reddim, true);
+  {
+    Epetra_Import importer(M.col_map(), *full_model_dof_row_map_);
+    const int err = basis_col.Import(*projmatrix_, importer, Insert, nullptr);
+    if (err != 0) FOUR_C_THROW("POD projection matrix could not be mapped onto the col map");
+  }
+
+  // V^T * M * V = sum_ij V_i^T * M_ij * V_j over the nonzero entries M_ij
+  const double* rowbasis = basis_row.Values();
+  const double* colbasis = basis_col.Values();
+  const int rowlength = basis_row.MyLength();
+  const int collength = basis_col.MyLength();
+
+  Core::LinAlg::SerialDenseMatrix localmatrix(reddim, reddim, true);
+  for (int rowlid = 0; rowlid < M.row_map().NumMyElements(); ++rowlid)
+  {
+    int numentries = 0;
+    double* values = nullptr;
+    int* indices = nullptr;
+    M.epetra_matrix()->ExtractMyRowView(rowlid, numentries, values, indices);
+
+    for (int entry = 0; entry < numentries; ++entry)
+    {
+      if (values[entry] == 0.0) continue;
+      for (int i = 0; i < reddim; ++i)
+      {
+        const double rowfac = values[entry] * rowbasis[i * rowlength + rowlid];
+        if (rowfac == 0.0) continue;
+        for (int j = 0; j < reddim; ++j)
+          localmatrix(i, j) += rowfac * colbasis[j * collength + indices[entry]];
+      }
+    }
+  }
+
+  Core::LinAlg::SerialDenseMatrix M_red(reddim, reddim, true);
+  Core::Communication::sum_all(localmatrix.values(), M_red.values(), reddim * reddim,
+      Core::Communication::unpack_epetra_comm(full_model_dof_row_map_->Comm()));
+
+  return M_red;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::LinAlg::SerialDenseMatrix
+Cardiovascular0D::ProperOrthogonalDecomposition::extract_basis_rows(
+    const Core::LinAlg::MultiVector<double>& basis, const std::vector<int>& dofs)
+{
+  Core::LinAlg::SerialDenseMatrix basis_rows(dofs.size(), basis.NumVectors(), false);
+  for (std::size_t i = 0; i < dofs.size(); ++i)
+  {
+    const int lid = basis.Map().LID(dofs[i]);
+    if (lid < 0) FOUR_C_THROW("Dof %d is not part of the map of the reduced basis.", dofs[i]);
+    for (int k = 0; k < basis.NumVectors(); ++k) basis_rows(i, k) = basis(k)[lid];
+  }
+  return basis_rows;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 std::shared_ptr<Core::LinAlg::SparseMatrix>
@@ -367,6 +614,50 @@ void Cardiovascular0D::ProperOrthogonalDecomposition::read_pod_basis_vectors_fro
   return;
 }
 
+/*----------------------------------------------------------------------*
+ | read ECSW weights of the reduced mesh from file                      |
+ |                                                                      |
+ | The reduced mesh is computed offline, e.g. by a non-negative least   |
+ | squares fit of the projected element forces of training snapshots.   |
+ | Format (one sampled element per line):                               |
+ |                                                                      |
+ |   <element gid> <weight>                                             |
+ |                                                                      |
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::ProperOrthogonalDecomposition::read_ecsw_weights_from_file(
+    const std::string& absolute_path_to_ecsw_file)
+{
+  std::ifstream file(absolute_path_to_ecsw_file.c_str());
+  if (!file.good())
+    FOUR_C_THROW("File containing the ECSW weights could not be opened. Check Input-File.");
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    line = Core::Utils::trim(line);
+    if (line.empty() or line[0] == '#') continue;
+
+    std::istringstream stream(line);
+    int gid = -1;
+    double weight = 0.0;
+    if (!(stream >> gid >> weight))
+      FOUR_C_THROW("Invalid line in ECSW weights file: %s", line.c_str());
+    if (gid < 0) FOUR_C_THROW("Invalid element id %d in ECSW weights file.", gid);
+    if (weight <= 0.0) FOUR_C_THROW("ECSW weight of element %d is not positive.", gid);
+
+    if (not ecsw_weights_.emplace(gid, weight).second)
+      FOUR_C_THROW("Element %d appears twice in ECSW weights file.", gid);
+  }
+
+  if (ecsw_weights_.empty()) FOUR_C_THROW("ECSW weights file does not contain any element.");
+
+  // Inform user
+  MPI_Comm comm(Core::Communication::unpack_epetra_comm(full_model_dof_row_map_->Comm()));
+  if (Core::Communication::my_mpi_rank(comm) == 0)
+    std::cout << "Hyper-reduction with " << ecsw_weights_.size() << " sampled elements\n"
+              << std::endl;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 bool Cardiovascular0D::ProperOrthogonalDecomposition::is_pod_basis_orthogonal(
@@ -10,15 +10,20 @@
 
 #include "4C_config.hpp"
 
+#include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_vector.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::FE
 {
+  class AssembleStrategy;
   class Discretization;
 }  // namespace Core::FE
 
@@ -28,6 +33,16 @@ namespace Core::LinAlg
 }  // namespace Core::LinAlg
 namespace Cardiovascular0D
 {
+  /*! \brief Add the weighted projection of an element matrix onto the reduced basis
+   *
+   * reducedmatrix += weight * V_r^T * elematrix * V_c, where the rows of V_r and V_c hold the
+   * reduced basis at the row and column dofs of the element.
+   */
+  void add_projected_element_matrix(const Core::LinAlg::SerialDenseMatrix& elematrix,
+      const Core::LinAlg::SerialDenseMatrix& basis_row,
+      const Core::LinAlg::SerialDenseMatrix& basis_col, double weight,
+      Core::LinAlg::SerialDenseMatrix& reducedmatrix);
+
   class ProperOrthogonalDecomposition
   {
    public:
@@ -35,7 +50,8 @@ namespace Cardiovascular0D
         \brief Constructor
      */
     ProperOrthogonalDecomposition(std::shared_ptr<const Epetra_Map> full_model_dof_row_map_,
-        const std::string& pod_matrix_file_name, const std::string& absolute_path_to_input_file);
+        const std::string& pod_matrix_file_name, const std::string& ecsw_weights_file_name,
+        const std::string& absolute_path_to_input_file);
 
     //! M_red = V^T * M * V
     std::shared_ptr<Core::LinAlg::SparseMatrix> reduce_diagonal(Core::LinAlg::SparseMatrix& M);
@@ -57,6 +73,40 @@ namespace Cardiovascular0D
 
     int get_red_dim() { return projmatrix_->NumVectors(); };
 
+    //! Hyper-reduction by energy-conserving sampling and weighting (ECSW) is used
+    bool have_hyper_reduction() const { return havehyperreduction_; };
+
+    /*! \brief Evaluate the sampled elements and project their matrices onto the reduced basis
+     *
+     * Replaces the loop over all elements in Core::FE::Discretization::evaluate(). Only the
+     * elements of the reduced mesh are evaluated. Their element vectors are scaled by the ECSW
+     * weights and assembled into the vectors of the strategy. Their element matrices are not
+     * assembled, instead the weighted projections V_e^T * K_e * V_e are summed up element by
+     * element and combined by combine_hyper_reduced_stiffness().
+     */
+    void evaluate_hyper_reduced(Core::FE::Discretization& discret, Teuchos::ParameterList& params,
+        Core::FE::AssembleStrategy& strategy);
+
+    /*! \brief Combine the projected matrices to the reduced effective stiffness
+     *
+     * K_red = fac_matrix1 * K1_red + fac_matrix2 * K2_red + sum_i fac_i * V^T * C_i * V
+     *
+     * K1_red and K2_red are the projected element matrices of the last call to
+     * evaluate_hyper_reduced(). The matrices C_i, e.g. mass and Rayleigh damping, must not change
+     * during the simulation since their projections are only computed at the first call.
+     */
+    void combine_hyper_reduced_stiffness(double fac_matrix1, double fac_matrix2,
+        const std::vector<std::pair<double, const Core::LinAlg::SparseMatrix*>>&
+            constant_matrices);
+
+    /*! \brief M_red = V^T * M * V + K_red
+     *
+     * M holds the contributions that are not part of the hyper-reduced effective stiffness K_red,
+     * e.g. of boundary conditions, and is projected row by row on its nonzero entries.
+     */
+    std::shared_ptr<Core::LinAlg::SparseMatrix> reduce_diagonal_hyper_reduced(
+        const Core::LinAlg::SparseMatrix& M);
+
    private:
     /*! \brief Read POD basis vectors from file
      *
@@ -69,6 +119,14 @@ namespace Cardiovascular0D
     void read_pod_basis_vectors_from_file(const std::string& absolute_path_to_pod_file,
         std::shared_ptr<Core::LinAlg::MultiVector<double>>& projmatrix);
 
+    /*! \brief Read ECSW element weights from file
+     *
+     * Read the reduced mesh from the specified text file. Every line contains the global id of a
+     * sampled element (as used by the discretization, i.e. starting at 0) and its positive weight.
+     * Lines starting with '#' are ignored.
+     */
+    void read_ecsw_weights_from_file(const std::string& absolute_path_to_ecsw_file);
+
     //! Multiply two Epetra MultiVectors
     void multiply_epetra_multi_vectors(Core::LinAlg::MultiVector<double>&, char,
         Core::LinAlg::MultiVector<double>&, char, Epetra_Map&, Epetra_Import&,
@@ -79,6 +137,13 @@ namespace Cardiovascular0D
         Epetra_Map& rangemap, std::shared_ptr<Epetra_Map> domainmap,
         Core::LinAlg::SparseMatrix& sparsemat);
 
+    //! Redundant V^T * M * V of a sparse matrix, computed on its nonzero entries only
+    Core::LinAlg::SerialDenseMatrix project_sparse_matrix(const Core::LinAlg::SparseMatrix& M);
+
+    //! Reduced basis at the given dofs, which must be part of the map of basis
+    static Core::LinAlg::SerialDenseMatrix extract_basis_rows(
+        const Core::LinAlg::MultiVector<double>& basis, const std::vector<int>& dofs);
+
     //! Check orthogonality of POD basis vectors with M^T * M - I == 0
     bool is_pod_basis_orthogonal(const Core::LinAlg::MultiVector<double>& M);
 
@@ -88,6 +153,26 @@ namespace Cardiovascular0D
     //! Flag to indicate usage of model order reduction
     bool havemor_ = false;
 
+    //! Flag to indicate usage of hyper-reduction
+    bool havehyperreduction_ = false;
+
+    //! ECSW weights of the sampled elements (global element id -> weight)
+    std::map<int, double> ecsw_weights_;
+
+    //! Projected element matrices of the sampled elements (redundant on all procs)
+    Core::LinAlg::SerialDenseMatrix hyperreducedmatrix1_;
+    Core::LinAlg::SerialDenseMatrix hyperreducedmatrix2_;
+
+    //! Projections of the constant matrices of the reduced effective stiffness
+    std::map<const Core::LinAlg::SparseMatrix*, Core::LinAlg::SerialDenseMatrix>
+        constantreducedmatrices_;
+
+    //! Hyper-reduced effective stiffness (redundant on all procs)
+    Core::LinAlg::SerialDenseMatrix hyperreducedstiffness_;
+
+    //! Projection matrix for POD on the dof column map of the discretization
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> projmatrixcol_;
+
     //! Projection matrix for POD
     std::shared_ptr<Core::LinAlg::MultiVector<double>> projmatrix_;
 
@@ -0,0 +1,222 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_cardiovascular0d_mor_pod_generator.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_utils_densematrix_communication.hpp"
+#include "4C_linalg_utils_densematrix_svd.hpp"
+
+#include <Epetra_Import.h>
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Cardiovascular0D::PodBasisGenerator::PodBasisGenerator(
+    std::shared_ptr<const Epetra_Map> full_model_dof_row_map, int max_rank, int block_size,
+    double tolerance)
+    : full_model_dof_row_map_(full_model_dof_row_map),
+      max_rank_(max_rank),
+      block_size_(block_size),
+      tolerance_(tolerance)
+{
+  if (max_rank_ < 1) FOUR_C_THROW("Maximum rank of the POD basis has to be positive.");
+  if (block_size_ < 1) FOUR_C_THROW("Number of snapshots per POD basis update has to be positive.");
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::PodBasisGenerator::add_snapshot(const Core::LinAlg::Vector<double>& snapshot)
+{
+  if (not snapshot.Map().SameAs(*full_model_dof_row_map_))
+    FOUR_C_THROW("Snapshot does not match the dof map of the POD basis.");
+
+  pending_snapshots_.emplace_back(snapshot);
+  if (static_cast<int>(pending_snapshots_.size()) >= block_size_) update_basis();
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::PodBasisGenerator::update_basis()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Cardiovascular0D::PodBasisGenerator::update_basis");
+
+  const int b = static_cast<int>(pending_snapshots_.size());
+  if (b == 0) return;
+  const int k = rank();
+
+  const Epetra_Comm& comm = full_model_dof_row_map_->Comm();
+
+  // block of new snapshots, overwritten by their orthonormalized complement
+  Core::LinAlg::MultiVector<double> snapshots(*full_model_dof_row_map_, b, true);
+  for (int j = 0; j < b; ++j) snapshots(j).Update(1.0, pending_snapshots_[j], 0.0);
+  pending_snapshots_.clear();
+
+  std::vector<double> snapshot_norms(b);
+  snapshots.Norm2(snapshot_norms.data());
+
+  // projection P = U^T A onto the current basis and orthogonal complement A - U P, done twice to
+  // keep the basis orthogonal to machine precision
+  Core::LinAlg::SerialDenseMatrix projection(k, b, true);
+  if (k > 0)
+  {
+    Epetra_Map redundant_map(k, k, 0, comm);
+    Core::LinAlg::MultiVector<double> proj(redundant_map, b, true);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      int err = proj.Multiply('T', 'N', 1.0, *basis_, snapshots, 0.0);
+      if (err) FOUR_C_THROW("Multiplication U^T * A failed.");
+      err = snapshots.Multiply('N', 'N', -1.0, *basis_, proj, 1.0);
+      if (err) FOUR_C_THROW("Multiplication U * P failed.");
+
+      for (int j = 0; j < b; ++j)
+        for (int i = 0; i < k; ++i) projection(i, j) += proj.Values()[j * k + i];
+    }
+  }
+
+  // QR decomposition of the orthogonal complement by modified Gram-Schmidt, components that are
+  // already represented by the basis or by previous snapshots are discarded
+  Core::LinAlg::SerialDenseMatrix r(b, b, true);
+  for (int j = 0; j < b; ++j)
+  {
+    Core::LinAlg::Vector<double>& aj = snapshots(j);
+    for (int i = 0; i < j; ++i)
+    {
+      double rij = 0.0;
+      aj.Dot(snapshots(i), &rij);
+      aj.Update(-rij, snapshots(i), 1.0);
+      r(i, j) = rij;
+    }
+
+    double rjj = 0.0;
+    aj.Norm2(&rjj);
+    if (rjj <= tolerance_ * snapshot_norms[j])
+    {
+      aj.PutScalar(0.0);
+      continue;
+    }
+    aj.Scale(1.0 / rjj);
+    r(j, j) = rjj;
+  }
+
+  // singular value decomposition of the small (redundant) matrix [S P; 0 R]
+  const int n = k + b;
+  Core::LinAlg::SerialDenseMatrix kmat(n, n, true);
+  for (int i = 0; i < k; ++i) kmat(i, i) = singular_values_[i];
+  for (int j = 0; j < b; ++j)
+  {
+    for (int i = 0; i < k; ++i) kmat(i, k + j) = projection(i, j);
+    for (int i = 0; i <= j; ++i) kmat(k + i, k + j) = r(i, j);
+  }
+
+  Core::LinAlg::SerialDenseMatrix uk(n, n, true);
+  Core::LinAlg::SerialDenseMatrix sk(n, n, true);
+  Core::LinAlg::SerialDenseMatrix vkt(n, n, true);
+  Core::LinAlg::svd(kmat, uk, sk, vkt);
+
+  // truncation
+  int new_rank = 0;
+  while (new_rank < std::min(n, max_rank_) and sk(new_rank, new_rank) > 0.0 and
+         sk(new_rank, new_rank) > tolerance_ * sk(0, 0))
+    ++new_rank;
+
+  if (new_rank == 0)
+  {
+    basis_ = nullptr;
+    singular_values_.clear();
+    return;
+  }
+
+  // rotation of the extended basis [U Q] by the leading left singular vectors of [S P; 0 R]
+  auto basis = std::make_shared<Core::LinAlg::MultiVector<double>>(
+      *full_model_dof_row_map_, new_rank, true);
+  if (k > 0)
+  {
+    Epetra_Map redundant_map(k, k, 0, comm);
+    Core::LinAlg::MultiVector<double> rotation(redundant_map, new_rank, true);
+    for (int j = 0; j < new_rank; ++j)
+      for (int i = 0; i < k; ++i) rotation.ReplaceMyValue(i, j, uk(i, j));
+
+    int err = basis->Multiply('N', 'N', 1.0, *basis_, rotation, 0.0);
+    if (err) FOUR_C_THROW("Multiplication U * U_K failed.");
+  }
+  {
+    Epetra_Map redundant_map(b, b, 0, comm);
+    Core::LinAlg::MultiVector<double> rotation(redundant_map, new_rank, true);
+    for (int j = 0; j < new_rank; ++j)
+      for (int i = 0; i < b; ++i) rotation.ReplaceMyValue(i, j, uk(k + i, j));
+
+    int err = basis->Multiply('N', 'N', 1.0, snapshots, rotation, 1.0);
+    if (err) FOUR_C_THROW("Multiplication Q * U_K failed.");
+  }
+
+  basis_ = basis;
+  singular_values_.resize(new_rank);
+  for (int i = 0; i < new_rank; ++i) singular_values_[i] = sk(i, i);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Cardiovascular0D::PodBasisGenerator::write_basis(const std::string& file_name)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Cardiovascular0D::PodBasisGenerator::write_basis");
+
+  update_basis();
+
+  const int num_rows = full_model_dof_row_map_->NumGlobalElements();
+  const int num_cols = rank();
+
+  // the row index in the file is the global dof id
+  if (full_model_dof_row_map_->MinAllGID() != 0 or
+      full_model_dof_row_map_->MaxAllGID() != num_rows - 1)
+    FOUR_C_THROW("POD basis can only be written for contiguous dof ids starting at 0.");
+
+  MPI_Comm comm(Core::Communication::unpack_epetra_comm(full_model_dof_row_map_->Comm()));
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+
+  // gather the basis on processor 0
+  std::shared_ptr<Epetra_Map> proc0map = Core::LinAlg::allreduce_e_map(*full_model_dof_row_map_, 0);
+  std::shared_ptr<Core::LinAlg::MultiVector<double>> gathered = nullptr;
+  if (num_cols > 0)
+  {
+    gathered = std::make_shared<Core::LinAlg::MultiVector<double>>(*proc0map, num_cols, true);
+    Epetra_Import importer(*proc0map, *full_model_dof_row_map_);
+    int err = gathered->Import(*basis_, importer, Insert, nullptr);
+    if (err) FOUR_C_THROW("Import of POD basis to processor 0 failed.");
+  }
+
+  if (myrank == 0)
+  {
+    std::ofstream file(file_name.c_str(), std::ofstream::out | std::ofstream::binary);
+    if (!file.good()) FOUR_C_THROW("File %s could not be opened for writing.", file_name.c_str());
+
+    file.write(reinterpret_cast<const char*>(&num_rows), sizeof(int));
+    file.write(reinterpret_cast<const char*>(&num_cols), sizeof(int));
+
+    std::vector<float> row(num_cols);
+    for (int gid = 0; gid < num_rows; ++gid)
+    {
+      const int lid = proc0map->LID(gid);
+      for (int j = 0; j < num_cols; ++j)
+        row[j] = static_cast<float>(gathered->Values()[j * gathered->MyLength() + lid]);
+      file.write(reinterpret_cast<const char*>(row.data()), num_cols * sizeof(float));
+    }
+
+    std::cout << "Wrote POD basis with " << num_cols << " vectors to " << file_name << std::endl;
+  }
+
+  Core::Communication::barrier(comm);
+}
+
+FOUR_C_NAMESPACE_CLOSE
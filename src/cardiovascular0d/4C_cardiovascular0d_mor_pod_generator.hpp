@@ -0,0 +1,110 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_CARDIOVASCULAR0D_MOR_POD_GENERATOR_HPP
+#define FOUR_C_CARDIOVASCULAR0D_MOR_POD_GENERATOR_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_multi_vector.hpp"
+#include "4C_linalg_vector.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Cardiovascular0D
+{
+  /*!
+   * \brief In-situ generation of a POD basis from snapshots by a streaming SVD
+   *
+   * Instead of writing all snapshots to disk and computing their singular value decomposition
+   * afterwards, the left singular vectors of the snapshot matrix are updated incrementally
+   * whenever a block of snapshots has been collected. With the current basis U and singular values
+   * S, a block of snapshots A is split into its projection P = U^T A and its orthogonal
+   * complement A - U P = Q R. The singular value decomposition of the small matrix
+   *
+   *   [ S  P ]
+   *   [ 0  R ] = U_K S_K V_K^T
+   *
+   * yields the updated singular values S_K and the updated basis [U Q] U_K, which is truncated
+   * to the prescribed maximum rank. The snapshots themselves are never stored beyond one block.
+   * All operations on tall matrices are distributed, only the small matrices are redundant on all
+   * processors.
+   *
+   * The basis is written in the binary format read by ProperOrthogonalDecomposition.
+   *
+   * References: M. Brand: Fast low-rank modifications of the thin singular value decomposition.
+   * Linear Algebra and its Applications 415(1): 20-30, 2006.
+   */
+  class PodBasisGenerator
+  {
+   public:
+    /*!
+     * \brief Constructor
+     *
+     * \param full_model_dof_row_map (in): dof row map of the snapshots
+     * \param max_rank (in): maximum number of basis vectors
+     * \param block_size (in): number of snapshots per basis update
+     * \param tolerance (in): singular values below tolerance times the largest singular value
+     *                        and snapshot components below tolerance times the snapshot norm
+     *                        are discarded
+     */
+    PodBasisGenerator(std::shared_ptr<const Epetra_Map> full_model_dof_row_map, int max_rank,
+        int block_size, double tolerance);
+
+    //! Add a snapshot, the basis is updated as soon as a block of snapshots is complete
+    void add_snapshot(const Core::LinAlg::Vector<double>& snapshot);
+
+    //! Update the basis with all snapshots collected so far
+    void update_basis();
+
+    /*! \brief Write the current basis to a binary file
+     *
+     * The basis is updated with the pending snapshots first. The file contains the number of rows
+     * and columns (int) followed by the values (row-wise, single precision).
+     */
+    void write_basis(const std::string& file_name);
+
+    //! current number of basis vectors
+    int rank() const { return static_cast<int>(singular_values_.size()); }
+
+    //! current singular values in descending order
+    const std::vector<double>& singular_values() const { return singular_values_; }
+
+    //! current basis vectors (nullptr as long as the rank is zero)
+    std::shared_ptr<const Core::LinAlg::MultiVector<double>> basis() const { return basis_; }
+
+   private:
+    /// DOF row map of the full model, i.e. map of snapshots and basis vectors
+    std::shared_ptr<const Epetra_Map> full_model_dof_row_map_;
+
+    //! maximum number of basis vectors
+    const int max_rank_;
+
+    //! number of snapshots per basis update
+    const int block_size_;
+
+    //! relative truncation tolerance
+    const double tolerance_;
+
+    //! snapshots not yet included in the basis
+    std::vector<Core::LinAlg::Vector<double>> pending_snapshots_;
+
+    //! left singular vectors of the snapshot matrix
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> basis_;
+
+    //! singular values of the snapshot matrix
+    std::vector<double> singular_values_;
+  };
+}  // namespace Cardiovascular0D
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -7,15 +7,30 @@
 
 #include "4C_cardiovascular0d_nox_nln_linearsystem.hpp"
 
+#include "4C_cardiovascular0d_manager.hpp"
+#include "4C_global_data.hpp"
+#include "4C_inpar_cardiovascular0d.hpp"
+#include "4C_linalg_blocksparsematrix.hpp"
 #include "4C_linalg_sparseoperator.hpp"
 #include "4C_linear_solver_method_linalg.hpp"
 #include "4C_solver_nonlin_nox_interface_jacobian.hpp"
 #include "4C_solver_nonlin_nox_interface_required.hpp"
+#include "4C_solver_nonlin_nox_linearsystem_prepostoperator.hpp"
 
 #include <Teuchos_ParameterList.hpp>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  bool use_schur_complement()
+  {
+    return Teuchos::getIntegralValue<Inpar::Cardiovascular0D::Cardvasc0DSolveAlgo>(
+               Global::Problem::instance()->cardiovascular0_d_structural_params(),
+               "SOLALGORITHM") == Inpar::Cardiovascular0D::cardvasc0dsolve_schur;
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 NOX::Nln::Cardiovascular0D::LinearSystem::LinearSystem(Teuchos::ParameterList& printParams,
@@ -28,7 +43,8 @@ NOX::Nln::Cardiovascular0D::LinearSystem::LinearSystem(Teuchos::ParameterList& p
     const Teuchos::RCP<Core::LinAlg::SparseOperator>& M, const ::NOX::Epetra::Vector& cloneVector,
     const Teuchos::RCP<::NOX::Epetra::Scaling> scalingObject)
     : NOX::Nln::LinearSystem(printParams, linearSolverParams, solvers, iReq, iJac, J, iPrec, M,
-          cloneVector, scalingObject)
+          cloneVector, scalingObject),
+      schur_complement_(use_schur_complement())
 {
   // empty constructor
 }
@@ -44,7 +60,8 @@ NOX::Nln::Cardiovascular0D::LinearSystem::LinearSystem(Teuchos::ParameterList& p
     const Teuchos::RCP<::NOX::Epetra::Interface::Preconditioner>& iPrec,
     const Teuchos::RCP<Core::LinAlg::SparseOperator>& M, const ::NOX::Epetra::Vector& cloneVector)
     : NOX::Nln::LinearSystem(
-          printParams, linearSolverParams, solvers, iReq, iJac, J, iPrec, M, cloneVector)
+          printParams, linearSolverParams, solvers, iReq, iJac, J, iPrec, M, cloneVector),
+      schur_complement_(use_schur_complement())
 {
   // empty constructor
 }
@@ -59,7 +76,8 @@ NOX::Nln::Cardiovascular0D::LinearSystem::LinearSystem(Teuchos::ParameterList& p
     const Teuchos::RCP<Core::LinAlg::SparseOperator>& J, const ::NOX::Epetra::Vector& cloneVector,
     const Teuchos::RCP<::NOX::Epetra::Scaling> scalingObject)
     : NOX::Nln::LinearSystem(
-          printParams, linearSolverParams, solvers, iReq, iJac, J, cloneVector, scalingObject)
+          printParams, linearSolverParams, solvers, iReq, iJac, J, cloneVector, scalingObject),
+      schur_complement_(use_schur_complement())
 {
   // empty constructor
 }
@@ -72,11 +90,78 @@ NOX::Nln::Cardiovascular0D::LinearSystem::LinearSystem(Teuchos::ParameterList& p
     const Teuchos::RCP<::NOX::Epetra::Interface::Required>& iReq,
     const Teuchos::RCP<::NOX::Epetra::Interface::Jacobian>& iJac,
     const Teuchos::RCP<Core::LinAlg::SparseOperator>& J, const ::NOX::Epetra::Vector& cloneVector)
-    : NOX::Nln::LinearSystem(printParams, linearSolverParams, solvers, iReq, iJac, J, cloneVector)
+    : NOX::Nln::LinearSystem(printParams, linearSolverParams, solvers, iReq, iJac, J, cloneVector),
+      schur_complement_(use_schur_complement())
 {
   // empty constructor
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool NOX::Nln::Cardiovascular0D::LinearSystem::applyJacobianInverse(
+    Teuchos::ParameterList& linearSolverParams, const ::NOX::Epetra::Vector& input,
+    ::NOX::Epetra::Vector& result)
+{
+  if (not schur_complement_)
+    return NOX::Nln::LinearSystem::applyJacobianInverse(linearSolverParams, input, result);
+
+  if (!!scaling_)
+    throw_error("applyJacobianInverse", "Scaling is not supported by the Schur complement solve");
+
+  auto* blockmat = dynamic_cast<Core::LinAlg::BlockSparseMatrixBase*>(&jacobian());
+  if (blockmat == nullptr)
+    throw_error("applyJacobianInverse", "The Schur complement solve requires a block Jacobian");
+
+  ::NOX::Epetra::Vector& nonConstInput = const_cast<::NOX::Epetra::Vector&>(input);
+
+  prePostOperatorPtr_->run_pre_apply_jacobian_inverse(nonConstInput, jacobian(), *this);
+
+  double startTime = timer_.wallTime();
+
+  // calculate the residual norm
+  resNorm2_ = nonConstInput.norm(::NOX::Abstract::Vector::TwoNorm);
+
+  // Zero out the delta X of the linear problem if requested by user.
+  if (zeroInitialGuess_) result.init(0.0);
+
+  // get current linear solver from the std_map
+  Teuchos::RCP<Core::LinAlg::Solver> currSolver;
+  NOX::Nln::SolutionType solType = get_active_lin_solver(solvers_, currSolver);
+
+  // set solver options if necessary
+  auto solver_params = set_solver_options(linearSolverParams, currSolver, solType);
+
+  int iter = linearSolverParams.get<int>("Number of Nonlinear Iterations", -10);
+  if (iter == -10)
+    throw_error("applyJacobianInverse", "\"Number of Nonlinear Iterations\" was not specified");
+
+  solver_params.refactor = true;
+  solver_params.reset = iter == 0;
+
+  int linsol_status;
+  {
+    Core::LinAlg::VectorView result_view(result.getEpetraVector());
+    Core::LinAlg::VectorView input_view(nonConstInput.getEpetraVector());
+    linsol_status = FourC::Cardiovascular0D::solve_schur_complement(
+        *currSolver, *blockmat, result_view, input_view, solver_params);
+  }
+
+  if (linsol_status)
+  {
+    if (utils_.isPrintType(::NOX::Utils::Warning))
+      utils_.out() << "NOX::Nln::Cardiovascular0D::LinearSystem::applyJacobianInverse -- "
+                      "linear solve failed (err = "
+                   << linsol_status << ")\n";
+  }
+
+  double endTime = timer_.wallTime();
+  timeApplyJacbianInverse_ += (endTime - startTime);
+
+  prePostOperatorPtr_->run_post_apply_jacobian_inverse(result, nonConstInput, jacobian(), *this);
+
+  return (linsol_status == 0);
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 Core::LinAlg::SolverParams NOX::Nln::Cardiovascular0D::LinearSystem::set_solver_options(
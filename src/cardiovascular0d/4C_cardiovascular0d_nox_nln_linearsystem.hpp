@@ -65,6 +65,15 @@ namespace NOX
             const Teuchos::RCP<Core::LinAlg::SparseOperator>& J,
             const ::NOX::Epetra::Vector& cloneVector);
 
+        /*! \brief Apply the inverse of the Jacobian
+         *
+         * With the Schur complement solution algorithm the 0D dofs are eliminated exactly and the
+         * linear solver is applied to the structural block only, see
+         * Cardiovascular0D::solve_schur_complement(). Otherwise the whole system is solved.
+         */
+        bool applyJacobianInverse(Teuchos::ParameterList& linearSolverParams,
+            const ::NOX::Epetra::Vector& input, ::NOX::Epetra::Vector& result) override;
+
         //! sets the options of the underlying solver
         Core::LinAlg::SolverParams set_solver_options(Teuchos::ParameterList& p,
             Teuchos::RCP<Core::LinAlg::Solver>& solverPtr,
@@ -79,6 +88,9 @@ namespace NOX
         //! throws an error message
         void throw_error(const std::string& functionName, const std::string& errorMsg) const;
 
+        //! solve by a Schur complement of the 0D block
+        const bool schur_complement_;
+
       };  // class LinearSystem
     }  // namespace Cardiovascular0D
   }  // namespace Nln
@@ -0,0 +1,114 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_cardiovascular0d_mor_pod_generator.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_utils_densematrix_svd.hpp"
+
+#include <Epetra_Map.h>
+
+#include <cmath>
+#include <memory>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  class PodBasisGeneratorTest : public testing::Test
+  {
+   protected:
+    PodBasisGeneratorTest()
+        : comm_(MPI_COMM_WORLD),
+          map_(std::make_shared<Epetra_Map>(
+              num_rows_, 0, Core::Communication::as_epetra_comm(comm_))),
+          snapshot_matrix_(num_rows_, num_snapshots_, true)
+    {
+      // full rank snapshot matrix with well separated singular values
+      for (int j = 0; j < num_snapshots_; ++j)
+        for (int i = 0; i < num_rows_; ++i)
+          snapshot_matrix_(i, j) = std::sin(0.3 * (i + 1) * (j + 1)) + (i == j ? 2.0 * j : 0.0);
+    }
+
+    Core::LinAlg::Vector<double> snapshot(int j) const
+    {
+      Core::LinAlg::Vector<double> vec(*map_, true);
+      for (int lid = 0; lid < vec.MyLength(); ++lid)
+        vec[lid] = snapshot_matrix_(map_->GID(lid), j);
+      return vec;
+    }
+
+    //! feed all snapshots to the generator and include a partial last block
+    void generate(Cardiovascular0D::PodBasisGenerator& generator) const
+    {
+      for (int j = 0; j < num_snapshots_; ++j) generator.add_snapshot(snapshot(j));
+      generator.update_basis();
+    }
+
+    //! compare singular values and basis (up to the sign of each vector) with a dense SVD
+    void expect_matches_dense_svd(const Cardiovascular0D::PodBasisGenerator& generator) const
+    {
+      Core::LinAlg::SerialDenseMatrix u(num_rows_, num_rows_, true);
+      Core::LinAlg::SerialDenseMatrix s(num_rows_, num_snapshots_, true);
+      Core::LinAlg::SerialDenseMatrix vt(num_snapshots_, num_snapshots_, true);
+      Core::LinAlg::svd(snapshot_matrix_, u, s, vt);
+
+      ASSERT_EQ(generator.rank(), num_snapshots_);
+      for (int k = 0; k < num_snapshots_; ++k)
+        EXPECT_NEAR(generator.singular_values()[k], s(k, k), 1e-10);
+
+      const Core::LinAlg::MultiVector<double>& basis = *generator.basis();
+      for (int k = 0; k < num_snapshots_; ++k)
+      {
+        double local_dot = 0.0;
+        for (int lid = 0; lid < basis.MyLength(); ++lid)
+          local_dot += basis(k)[lid] * u(map_->GID(lid), k);
+
+        double dot = 0.0;
+        Core::Communication::sum_all(&local_dot, &dot, 1, comm_);
+        EXPECT_NEAR(std::abs(dot), 1.0, 1e-10);
+      }
+    }
+
+    static constexpr int num_rows_ = 20;
+    static constexpr int num_snapshots_ = 7;
+
+    MPI_Comm comm_;
+    std::shared_ptr<Epetra_Map> map_;
+    Core::LinAlg::SerialDenseMatrix snapshot_matrix_;
+  };
+
+  TEST_F(PodBasisGeneratorTest, BlockwiseUpdateMatchesDenseSvd)
+  {
+    Cardiovascular0D::PodBasisGenerator generator(map_, num_snapshots_, 3, 1e-12);
+    generate(generator);
+
+    expect_matches_dense_svd(generator);
+  }
+
+  TEST_F(PodBasisGeneratorTest, SingleSnapshotUpdatesMatchDenseSvd)
+  {
+    Cardiovascular0D::PodBasisGenerator generator(map_, num_snapshots_, 1, 1e-12);
+    generate(generator);
+
+    expect_matches_dense_svd(generator);
+  }
+
+  TEST_F(PodBasisGeneratorTest, RankIsLimited)
+  {
+    Cardiovascular0D::PodBasisGenerator generator(map_, 3, 2, 1e-12);
+    generate(generator);
+
+    EXPECT_EQ(generator.rank(), 3);
+    EXPECT_EQ(generator.basis()->NumVectors(), 3);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
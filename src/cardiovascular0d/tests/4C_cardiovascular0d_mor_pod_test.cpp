@@ -0,0 +1,103 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_cardiovascular0d_mor_pod.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  // chain of bar elements with one dof per node and element e connecting dofs e and e+1
+  constexpr int num_elements = 4;
+  constexpr int num_dofs = num_elements + 1;
+  constexpr int reduced_dim = 2;
+
+  Core::LinAlg::SerialDenseMatrix element_matrix(int ele)
+  {
+    const double k = 1.0 + 0.5 * ele;
+    Core::LinAlg::SerialDenseMatrix elematrix(2, 2, true);
+    elematrix(0, 0) = k;
+    elematrix(0, 1) = -k + 0.1 * ele;
+    elematrix(1, 0) = -k;
+    elematrix(1, 1) = 2.0 * k;
+    return elematrix;
+  }
+
+  Core::LinAlg::SerialDenseMatrix reduced_basis()
+  {
+    Core::LinAlg::SerialDenseMatrix basis(num_dofs, reduced_dim, true);
+    for (int i = 0; i < num_dofs; ++i)
+      for (int k = 0; k < reduced_dim; ++k) basis(i, k) = std::cos(0.7 * (i + 1) * (k + 1));
+    return basis;
+  }
+
+  TEST(ProperOrthogonalDecompositionTest, ProjectedSampledElementsMatchProjectedAssembly)
+  {
+    // reduced mesh with a subset of the elements and non-unit weights
+    const std::map<int, double> weights = {{0, 2.5}, {2, 0.5}, {3, 1.75}};
+    const Core::LinAlg::SerialDenseMatrix basis = reduced_basis();
+
+    // element by element projection
+    Core::LinAlg::SerialDenseMatrix reduced(reduced_dim, reduced_dim, true);
+    for (const auto& [ele, weight] : weights)
+    {
+      Core::LinAlg::SerialDenseMatrix elebasis(2, reduced_dim, true);
+      for (int i = 0; i < 2; ++i)
+        for (int k = 0; k < reduced_dim; ++k) elebasis(i, k) = basis(ele + i, k);
+
+      Cardiovascular0D::add_projected_element_matrix(
+          element_matrix(ele), elebasis, elebasis, weight, reduced);
+    }
+
+    // projection of the weighted full assembly of the sampled elements
+    Core::LinAlg::SerialDenseMatrix assembled(num_dofs, num_dofs, true);
+    for (const auto& [ele, weight] : weights)
+    {
+      const Core::LinAlg::SerialDenseMatrix elematrix = element_matrix(ele);
+      for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j) assembled(ele + i, ele + j) += weight * elematrix(i, j);
+    }
+
+    for (int k = 0; k < reduced_dim; ++k)
+    {
+      for (int l = 0; l < reduced_dim; ++l)
+      {
+        double expected = 0.0;
+        for (int i = 0; i < num_dofs; ++i)
+          for (int j = 0; j < num_dofs; ++j)
+            expected += basis(i, k) * assembled(i, j) * basis(j, l);
+
+        EXPECT_NEAR(reduced(k, l), expected, 1e-12);
+      }
+    }
+  }
+
+  TEST(ProperOrthogonalDecompositionTest, ProjectedElementMatrixIsAdded)
+  {
+    Core::LinAlg::SerialDenseMatrix elebasis(2, 1, true);
+    elebasis(0, 0) = 1.0;
+    elebasis(1, 0) = -2.0;
+
+    Core::LinAlg::SerialDenseMatrix reduced(1, 1, true);
+    reduced(0, 0) = 3.0;
+
+    // 3 + 0.5 * (k00 - 2 k01 - 2 k10 + 4 k11) with element matrix of element 1
+    Cardiovascular0D::add_projected_element_matrix(element_matrix(1), elebasis, elebasis, 0.5,
+        reduced);
+    EXPECT_NEAR(reduced(0, 0), 3.0 + 0.5 * (1.5 + 2.0 * 1.4 + 2.0 * 1.5 + 4.0 * 3.0), 1e-14);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -9,6 +9,7 @@
 
 #include "4C_comm_mpi_utils.hpp"
 #include "4C_utils_exceptions.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <vector>
 
@@ -41,6 +42,7 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
     const int dsize, const int tag, MPI_Request& request) const
 {
   if (my_pid() != frompid) return;
+  Core::Utils::Profiling::add_counter("bytes exported", dsize * sizeof(char));
   MPI_Isend((void*)data, dsize, MPI_CHAR, topid, tag, get_comm(), &request);
 }
 
@@ -48,6 +50,7 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
     const int dsize, const int tag, MPI_Request& request) const
 {
   if (my_pid() != frompid) return;
+  Core::Utils::Profiling::add_counter("bytes exported", dsize * sizeof(int));
   MPI_Isend((void*)data, dsize, MPI_INT, topid, tag, get_comm(), &request);
 }
 
@@ -55,6 +58,7 @@ void Core::Communication::Exporter::i_send(const int frompid, const int topid, c
     const int dsize, const int tag, MPI_Request& request) const
 {
   if (my_pid() != frompid) return;
+  Core::Utils::Profiling::add_counter("bytes exported", dsize * sizeof(double));
   MPI_Isend((void*)data, dsize, MPI_DOUBLE, topid, tag, get_comm(), &request);
 }
 
@@ -7,6 +7,7 @@
 
 #include "4C_fem_discretization.hpp"
 
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_comm_pack_helpers.hpp"
 #include "4C_comm_utils_factory.hpp"
 #include "4C_fem_condition.hpp"
@@ -429,6 +430,7 @@ void Core::FE::Discretization::replace_dof_set(const unsigned nds,
   // if we already have our dofs here and we add a properly filled (proxy)
   // DofSet, we do not need (and do not want) to refill.
   havedof_ = havedof_ and newdofset->filled() and nds != 0;
+  location_array_cache_ = nullptr;
   if (replaceinstatdofsets) newdofset->replace_in_static_dofsets(dofsets_[nds]);
   dofsets_[nds] = newdofset;
 }
@@ -441,6 +443,7 @@ int Core::FE::Discretization::add_dof_set(std::shared_ptr<Core::DOFSets::DofSetI
   // if we already have our dofs here and we add a properly filled (proxy)
   // DofSet, we do not need (and do not want) to refill.
   havedof_ = havedof_ and newdofset->filled();
+  location_array_cache_ = nullptr;
   dofsets_.push_back(newdofset);
   return static_cast<int>(dofsets_.size() - 1);
 }
@@ -463,6 +466,7 @@ void Core::FE::Discretization::replace_dof_set(
 {
   FOUR_C_ASSERT(dofsets_.size() == 1, "Discretization %s expects just one dof set!", name_.c_str());
   havedof_ = false;
+  location_array_cache_ = nullptr;
   if (replaceinstatdofsets) newdofset->replace_in_static_dofsets(dofsets_[0]);
   dofsets_[0] = newdofset;
 }
@@ -515,15 +519,64 @@ Core::FE::Discretization::get_pbc_slave_to_master_node_connectivity()
  *----------------------------------------------------------------------*/
 void Core::FE::Discretization::set_state(const unsigned nds, const std::string& name,
     std::shared_ptr<const Core::LinAlg::Vector<double>> state)
+{
+  set_state(register_state(nds, name), state);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::FE::StateHandle Core::FE::Discretization::register_state(
+    const unsigned nds, const std::string& name)
+{
+  if (state_slots_.size() <= nds)
+  {
+    state_slots_.resize(nds + 1);
+    state_names_.resize(nds + 1);
+  }
+  if (state_.size() <= nds) state_.resize(nds + 1);
+
+  // registered names are looked up first to avoid constructing a new map entry
+  const int slot = state_slot(nds, name);
+  if (slot >= 0) return {nds, slot};
+
+  state_slots_[nds].try_emplace(name, static_cast<int>(state_names_[nds].size()));
+  state_names_[nds].push_back(name);
+  if (state_[nds].size() < state_names_[nds].size()) state_[nds].resize(state_names_[nds].size());
+
+  return {nds, static_cast<int>(state_names_[nds].size()) - 1};
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::store_state(const unsigned nds, const std::string& name,
+    std::shared_ptr<const Core::LinAlg::Vector<double>> state)
+{
+  const StateHandle handle = register_state(nds, name);
+  state_[nds][handle.slot_].vector = state;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::set_state(StateHandle handle,
+    std::shared_ptr<const Core::LinAlg::Vector<double>> state, const bool changed)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Discretization::set_state");
 
+  FOUR_C_ASSERT_ALWAYS(handle.is_valid() and handle.nds_ < state_names_.size() and
+                           handle.slot_ < static_cast<int>(state_names_[handle.nds_].size()),
+      "Invalid state handle in discretization %s!", name_.c_str());
   FOUR_C_ASSERT_ALWAYS(
       have_dofs(), "fill_complete() was not called for discretization %s!", name_.c_str());
+
+  const unsigned nds = handle.nds_;
+  [[maybe_unused]] const std::string& name = state_names_[nds][handle.slot_];
   const Epetra_Map* colmap = dof_col_map(nds);
   const Epetra_BlockMap& vecmap = state->Map();
 
   if (state_.size() <= nds) state_.resize(nds + 1);
+  if (state_[nds].size() <= static_cast<unsigned>(handle.slot_))
+    state_[nds].resize(state_names_[nds].size());
+  State& current = state_[nds][handle.slot_];
 
   // if it's already in column map just set a reference
   // This is a rough test, but it might be ok at this place. It is an
@@ -537,19 +590,19 @@ void Core::FE::Discretization::set_state(const unsigned nds, const std::string&
     // make a copy as in parallel such that no additional RCP points to the state vector
     std::shared_ptr<Core::LinAlg::Vector<double>> tmp = Core::LinAlg::create_vector(*colmap, false);
     tmp->Update(1.0, *state, 0.0);
-    state_[nds][name] = tmp;
+    current.vector = tmp;
   }
   else  // if it's not in column map export and allocate
   {
     FOUR_C_ASSERT(dof_row_map(nds)->SameAs(state->Map()),
         "row map of discretization %s and state vector %s are different. This is a fatal bug!",
         name_.c_str(), name.c_str());
-    std::shared_ptr<Core::LinAlg::Vector<double>> tmp = Core::LinAlg::create_vector(*colmap, false);
 
     // this is necessary to find out the number of nodesets in the beginning
     if (stateimporter_.size() <= nds)
     {
       stateimporter_.resize(nds + 1);
+      state_row_to_col_.resize(nds + 1);
       for (unsigned i = 0; i <= nds; ++i) stateimporter_[i] = nullptr;
     }
     // (re)build importer if necessary
@@ -558,15 +611,41 @@ void Core::FE::Discretization::set_state(const unsigned nds, const std::string&
         not stateimporter_[nds]->TargetMap().SameAs(*colmap))
     {
       stateimporter_[nds] = std::make_shared<Epetra_Import>(*colmap, state->Map());
+
+      std::vector<int>& rowtocol = state_row_to_col_[nds];
+      rowtocol.resize(vecmap.NumMyElements());
+      for (int lid = 0; lid < vecmap.NumMyElements(); ++lid)
+        rowtocol[lid] = colmap->LID(vecmap.GID(lid));
+    }
+
+    // The caller guarantees that the row vector did not change since it was set last, so the
+    // previously imported vector is reused. This decision is the same on all processors, which is
+    // required since the import communicates.
+    if (not changed and current.source.lock() == state and current.imported != nullptr and
+        current.imported->Map().DataPtr() == colmap->DataPtr())
+    {
+#ifdef FOUR_C_ENABLE_ASSERTIONS
+      const std::vector<int>& rowtocol = state_row_to_col_[nds];
+      for (int lid = 0; lid < state->MyLength(); ++lid)
+      {
+        FOUR_C_ASSERT((*state)[lid] == (*current.imported)[rowtocol[lid]],
+            "State %s of discretization %s was set as unchanged, but its values changed!",
+            name.c_str(), name_.c_str());
+      }
+#endif
+      current.vector = current.imported;
+      return;
     }
 
+    std::shared_ptr<Core::LinAlg::Vector<double>> tmp = Core::LinAlg::create_vector(*colmap, false);
+
     // transfer data
-    int err = tmp->Import(*state, (*stateimporter_[nds]), Insert);
+    int err = tmp->Import(*state, *stateimporter_[nds], Insert);
     FOUR_C_ASSERT_ALWAYS(!err,
         "Export using importer failed for Core::LinAlg::Vector<double>: return value = %d", err);
 
     // save state
-    state_[nds][name] = tmp;
+    current = {tmp, tmp, state};
   }
 }
 
@@ -20,7 +20,10 @@
 #include <Epetra_Map.h>
 #include <Epetra_MpiComm.h>
 
+#include <algorithm>
 #include <functional>
+#include <map>
+#include <memory>
 #include <ranges>
 #include <set>
 #include <vector>
@@ -92,6 +95,36 @@ namespace Core::FE
     bool do_extended_ghosting = false;      // if true, extended ghosting is applied
   };
 
+  /*!
+  \brief Handle of a state vector of a discretization
+
+  A handle is obtained once via Discretization::register_state() and gives access to the state
+  vector by an index instead of a lookup by name. It stays valid for the lifetime of the
+  discretization, also across clear_state().
+  */
+  class StateHandle
+  {
+   public:
+    StateHandle() = default;
+
+    //! number of the dofset of the state
+    [[nodiscard]] unsigned dof_set() const { return nds_; }
+
+    //! whether the handle was obtained from a discretization
+    [[nodiscard]] bool is_valid() const { return slot_ >= 0; }
+
+   private:
+    friend class Discretization;
+
+    StateHandle(unsigned nds, int slot) : nds_(nds), slot_(slot) {}
+
+    //! number of the dofset
+    unsigned nds_ = 0;
+
+    //! index of the state within the dofset
+    int slot_ = -1;
+  };
+
   /*!
   \brief A class to manage a discretization in parallel
 
@@ -1541,6 +1574,56 @@ namespace Core::FE
     virtual void set_state(unsigned nds, const std::string& name,
         std::shared_ptr<const Core::LinAlg::Vector<double>> state);
 
+    /*!
+    \brief Register a state vector and return its handle
+
+    Registering the same name twice returns the same handle. States set by name are registered
+    implicitly.
+
+    \param nds (in): number of dofset
+    \param name (in): Name of data
+    */
+    StateHandle register_state(unsigned nds, const std::string& name);
+
+    /*!
+    \brief Set a reference to a data vector via its handle
+
+    Same as set_state(nds, name, state), but without a lookup by name. If the vector is given in
+    dof_row_map(), the caller may state that it did not change since it was last set with this
+    handle. The import into the column layout is then skipped and the last imported vector is used
+    again, also after clear_state().
+
+    \param handle (in): handle obtained from register_state()
+    \param state (in): vector of some data
+    \param changed (in): false if the same row vector was set before and its values did not change
+                         since then. Has to be the same on all processors.
+    */
+    void set_state(StateHandle handle, std::shared_ptr<const Core::LinAlg::Vector<double>> state,
+        bool changed = true);
+
+    /*!
+    \brief Get a reference to a data vector via its handle
+
+    \return Reference to solution state, the method throws if the state has not been set
+    */
+    [[nodiscard]] std::shared_ptr<const Core::LinAlg::Vector<double>> get_state(
+        StateHandle handle) const
+    {
+      FOUR_C_ASSERT_ALWAYS(
+          handle.is_valid(), "Invalid state handle in discretization %s!", name_.c_str());
+      FOUR_C_ASSERT_ALWAYS(has_state(handle), "Cannot find state %s in discretization %s",
+          state_names_[handle.nds_][handle.slot_].c_str(), name_.c_str());
+      return state_[handle.nds_][handle.slot_].vector;
+    }
+
+    //! Tell whether the state vector of a handle has been set
+    [[nodiscard]] bool has_state(StateHandle handle) const
+    {
+      return handle.nds_ < state_.size() and handle.slot_ >= 0 and
+             handle.slot_ < static_cast<int>(state_[handle.nds_].size()) and
+             state_[handle.nds_][handle.slot_].vector != nullptr;
+    }
+
     /*!
     \brief Get a reference to a data vector at the default dofset (0)
 
@@ -1577,10 +1660,10 @@ namespace Core::FE
           nds < dofsets_.size(), "undefined dof set found in discretization %s!", name_.c_str());
       if (state_.size() <= nds) return nullptr;
 
-      auto state_iterator = state_[nds].find(name);
-      FOUR_C_ASSERT_ALWAYS(state_iterator != state_[nds].end(),
+      const int slot = state_slot(nds, name);
+      FOUR_C_ASSERT_ALWAYS(slot >= 0 and state_[nds][slot].vector != nullptr,
           "Cannot find state %s in discretization %s", name.data(), name_.c_str());
-      return state_iterator->second;
+      return state_[nds][slot].vector;
     }
 
     /*!
@@ -1594,7 +1677,8 @@ namespace Core::FE
           nds < dofsets_.size(), "undefined dof set found in discretization %s!", name_.c_str());
       if (state_.size() <= nds) return false;
 
-      return state_[nds].count(name) == 1;
+      const int slot = state_slot(nds, name);
+      return slot >= 0 and state_[nds][slot].vector != nullptr;
     }
 
     /*!
@@ -1604,11 +1688,11 @@ namespace Core::FE
     */
     virtual void clear_state(bool clearalldofsets = false)
     {
-      // clear all states
-      if (clearalldofsets) state_.clear();
-      // clear states that belong to own dofset only
-      else if (!state_.empty())
-        state_[0].clear();
+      // the registered names and thus the handles as well as the last imported vectors are kept
+      const std::size_t numcleared =
+          clearalldofsets ? state_.size() : std::min<std::size_t>(1, state_.size());
+      for (std::size_t nds = 0; nds < numcleared; ++nds)
+        for (State& state : state_[nds]) state.vector = nullptr;
     }
 
     virtual void redistribute_state(unsigned nds, const std::string& name);
@@ -1695,6 +1779,22 @@ namespace Core::FE
     /// Call elements to evaluate
     virtual void evaluate(Teuchos::ParameterList& params, Core::FE::AssembleStrategy& strategy);
 
+    /*!
+    \brief Get the location array of a column element (without Dirichlet flags)
+
+    The location arrays of all column elements are computed once by
+    Element::location_vector() and stored in a compressed (CSR-like) cache per dof set. They are
+    reused until the elements or the dofs of the discretization change, i.e. until the next call
+    to fill_complete() or assign_degrees_of_freedom() or until a dof set is replaced or
+    reassigned.
+
+    \param lid (in): local column index of the element
+    \param la (out): location data for all dofsets of the discretization
+
+    \note Filled()==true and HaveDofs()==true are prerequisites
+    */
+    void location_vector(int lid, Core::Elements::LocationArray& la) const;
+
     /**
      * Loop over all elements of the discretization and perform the given @p element_action. In
      * contrast to the other overloads of evaluate(), this function allows to perform any local
@@ -2255,12 +2355,47 @@ namespace Core::FE
 
     //! @}
 
-    //! Map of references to solution states
-    std::vector<std::map<std::string, std::shared_ptr<const Core::LinAlg::Vector<double>>>> state_;
+    //! Store a state vector in column layout under the given name
+    void store_state(unsigned nds, const std::string& name,
+        std::shared_ptr<const Core::LinAlg::Vector<double>> state);
+
+    //! Index of a registered state (-1 if the name is not registered)
+    [[nodiscard]] int state_slot(unsigned nds, const std::string& name) const
+    {
+      if (state_slots_.size() <= nds) return -1;
+      auto it = state_slots_[nds].find(name);
+      return it == state_slots_[nds].end() ? -1 : it->second;
+    }
+
+    //! A solution state in column layout
+    struct State
+    {
+      //! the state vector (nullptr if not set)
+      std::shared_ptr<const Core::LinAlg::Vector<double>> vector;
+
+      //! last vector imported from a row vector, kept by clear_state() to skip unchanged imports
+      std::shared_ptr<const Core::LinAlg::Vector<double>> imported;
+
+      //! row vector the last imported vector was imported from
+      std::weak_ptr<const Core::LinAlg::Vector<double>> source;
+    };
+
+    //! Solution states per dofset, indexed by the slot of their handle
+    std::vector<std::vector<State>> state_;
+
+    //! Slots of the registered states per dofset
+    std::vector<std::map<std::string, int>> state_slots_;
+
+    //! Names of the registered states per dofset, indexed by slot
+    std::vector<std::vector<std::string>> state_names_;
 
     ///< Map of import objects for states
     std::vector<std::shared_ptr<Epetra_Import>> stateimporter_;
 
+    //! Column local ids of the row dofs per dofset, matching the state importers (used to check
+    //! states set as unchanged)
+    std::vector<std::vector<int>> state_row_to_col_;
+
     ///< Some conditions e.g. boundary conditions
     std::multimap<std::string, std::shared_ptr<Core::Conditions::Condition>> condition_;
 
@@ -2269,6 +2404,38 @@ namespace Core::FE
 
     //! number of space dimension
     const unsigned int n_dim_;
+
+   private:
+    //! Location arrays of all column elements in compressed form
+    struct LocationArrayCache
+    {
+      //! copies of the element column map and the dof column maps the cache was built for
+      std::vector<Epetra_Map> maps;
+
+      //! per dof set: offsets of the elements in lm and lmowner (number of column elements + 1)
+      std::vector<std::vector<int>> offsets;
+
+      //! per dof set: global dof ids of all elements
+      std::vector<std::vector<int>> lm;
+
+      //! per dof set: owners of the dofs of all elements
+      std::vector<std::vector<int>> lmowner;
+
+      //! per dof set: offsets of the elements in stride (number of column elements + 1)
+      std::vector<std::vector<int>> strideoffsets;
+
+      //! per dof set: nodal strides of all elements
+      std::vector<std::vector<int>> stride;
+    };
+
+    //! build the location array cache for the current elements and dofs
+    void build_location_array_cache() const;
+
+    //! whether the location array cache matches the current elements and dofs
+    [[nodiscard]] bool location_array_cache_is_valid() const;
+
+    //! location arrays of the column elements (built on first use)
+    mutable std::shared_ptr<LocationArrayCache> location_array_cache_;
   };  // class Discretization
 }  // namespace Core::FE
 
@@ -20,6 +20,7 @@
 #include "4C_utils_exceptions.hpp"
 #include "4C_utils_function_manager.hpp"
 #include "4C_utils_function_of_time.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
 
@@ -70,10 +71,13 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
         Core::LinAlg::SerialDenseVector&)>& element_action)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Discretization::Evaluate");
+  FOUR_C_PROFILE_REGION("Core::FE::Discretization::evaluate");
 
   if (!filled()) FOUR_C_THROW("fill_complete() was not called");
   if (!have_dofs()) FOUR_C_THROW("assign_degrees_of_freedom() was not called");
 
+  Core::Utils::Profiling::add_counter("elements evaluated", num_my_col_elements());
+
   int row = strategy.first_dof_set();
   int col = strategy.second_dof_set();
 
@@ -88,10 +92,13 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
   Core::Elements::LocationArray la(dofsets_.size());
 
   // loop over column elements
-  for (auto* actele : my_col_element_range())
+  const int numcolele = num_my_col_elements();
+  for (int lid = 0; lid < numcolele; ++lid)
   {
-    // get element location vector, dirichlet flags and ownerships
-    actele->location_vector(*this, la, false);
+    Core::Elements::Element* actele = l_col_element(lid);
+
+    // get element location vector and ownerships
+    location_vector(lid, la);
 
     // get dimension of element matrices and vectors
     // Reshape element matrices and vectors and init to zero
@@ -111,6 +118,98 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::location_vector(int lid, Core::Elements::LocationArray& la) const
+{
+  FOUR_C_ASSERT(filled(), "fill_complete() was not called on discretization %s", name_.c_str());
+  FOUR_C_ASSERT(have_dofs(), "assign_degrees_of_freedom() was not called on discretization %s",
+      name_.c_str());
+
+  if (not location_array_cache_is_valid()) build_location_array_cache();
+
+  const LocationArrayCache& cache = *location_array_cache_;
+  FOUR_C_ASSERT(la.size() <= static_cast<int>(cache.lm.size()),
+      "Location array with %d dof sets, but discretization %s has only %d.", la.size(),
+      name_.c_str(), static_cast<int>(cache.lm.size()));
+  for (int dofset = 0; dofset < la.size(); ++dofset)
+  {
+    Core::Elements::LocationData& data = la[dofset];
+    const std::vector<int>& offsets = cache.offsets[dofset];
+    const std::vector<int>& strideoffsets = cache.strideoffsets[dofset];
+
+    // assign() keeps the capacity of the vectors, i.e. no allocation once the location array has
+    // seen the largest element
+    data.lm_.assign(cache.lm[dofset].begin() + offsets[lid],
+        cache.lm[dofset].begin() + offsets[lid + 1]);
+    data.lmowner_.assign(cache.lmowner[dofset].begin() + offsets[lid],
+        cache.lmowner[dofset].begin() + offsets[lid + 1]);
+    data.stride_.assign(cache.stride[dofset].begin() + strideoffsets[lid],
+        cache.stride[dofset].begin() + strideoffsets[lid + 1]);
+    data.lmdirich_.clear();
+  }
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::FE::Discretization::location_array_cache_is_valid() const
+{
+  if (location_array_cache_ == nullptr) return false;
+
+  // the maps share their data with all copies, i.e. a rebuilt map never matches the cached copy
+  const std::vector<Epetra_Map>& maps = location_array_cache_->maps;
+  if (maps.size() != dofsets_.size() + 1) return false;
+  if (maps[0].DataPtr() != elecolmap_->DataPtr()) return false;
+  for (unsigned dofset = 0; dofset < dofsets_.size(); ++dofset)
+    if (maps[dofset + 1].DataPtr() != dofsets_[dofset]->dof_col_map()->DataPtr()) return false;
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::build_location_array_cache() const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Discretization::build_location_array_cache");
+
+  const int numdofsets = static_cast<int>(dofsets_.size());
+  const int numcolele = num_my_col_elements();
+
+  auto cache = std::make_shared<LocationArrayCache>();
+  cache->maps.reserve(numdofsets + 1);
+  cache->maps.emplace_back(*elecolmap_);
+  for (int dofset = 0; dofset < numdofsets; ++dofset)
+    cache->maps.emplace_back(*dofsets_[dofset]->dof_col_map());
+
+  cache->offsets.assign(numdofsets, std::vector<int>(1, 0));
+  cache->lm.resize(numdofsets);
+  cache->lmowner.resize(numdofsets);
+  cache->strideoffsets.assign(numdofsets, std::vector<int>(1, 0));
+  cache->stride.resize(numdofsets);
+
+  Core::Elements::LocationArray la(numdofsets);
+  for (int lid = 0; lid < numcolele; ++lid)
+  {
+    elecolptr_[lid]->location_vector(*this, la, false);
+    for (int dofset = 0; dofset < numdofsets; ++dofset)
+    {
+      const Core::Elements::LocationData& data = la[dofset];
+      cache->lm[dofset].insert(cache->lm[dofset].end(), data.lm_.begin(), data.lm_.end());
+      cache->lmowner[dofset].insert(
+          cache->lmowner[dofset].end(), data.lmowner_.begin(), data.lmowner_.end());
+      cache->offsets[dofset].push_back(static_cast<int>(cache->lm[dofset].size()));
+      cache->stride[dofset].insert(
+          cache->stride[dofset].end(), data.stride_.begin(), data.stride_.end());
+      cache->strideoffsets[dofset].push_back(static_cast<int>(cache->stride[dofset].size()));
+    }
+  }
+
+  location_array_cache_ = cache;
+}
+
+
 /*----------------------------------------------------------------------*
  |  evaluate (public)                                        u.kue 01/08|
  *----------------------------------------------------------------------*/
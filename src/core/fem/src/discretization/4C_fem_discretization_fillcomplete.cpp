@@ -22,6 +22,7 @@ FOUR_C_NAMESPACE_OPEN
 void Core::FE::Discretization::reset(bool killdofs, bool killcond)
 {
   filled_ = false;
+  location_array_cache_ = nullptr;
   if (killdofs)
   {
     havedof_ = false;
@@ -326,6 +327,7 @@ int Core::FE::Discretization::assign_degrees_of_freedom(int start)
   // done and this query demands the havedof flag to be set. An unexpected
   // implicit dependency here.
   havedof_ = true;
+  location_array_cache_ = nullptr;
 
   for (unsigned i = 0; i < dofsets_.size(); ++i)
     start = dofsets_[i]->assign_degrees_of_freedom(*this, i, start);
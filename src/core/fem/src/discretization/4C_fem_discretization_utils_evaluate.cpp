@@ -92,19 +92,16 @@ void Core::FE::Utils::evaluate(Core::FE::Discretization& discret, Teuchos::Param
 
   for (int i = 0; i < numcolele; ++i)
   {
-    Core::Elements::Element* actele = nullptr;
-    if (is_subset)
-    {
-      const int egid = ele_gids[i];
-      actele = discret.g_element(egid);
-    }
-    else
-      actele = discret.l_col_element(i);
+    const int lid = is_subset ? discret.element_col_map()->LID(ele_gids[i]) : i;
+    if (lid < 0)
+      FOUR_C_THROW("Element %d is not a column element on processor %d.", ele_gids[i],
+          Core::Communication::my_mpi_rank(discret.get_comm()));
+    Core::Elements::Element* actele = discret.l_col_element(lid);
 
     {
       TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Utils::Evaluate LocationVector");
-      // get element location vector, dirichlet flags and ownerships
-      actele->location_vector(discret, la, false);
+      // get element location vector and ownerships
+      discret.location_vector(lid, la);
     }
 
     {
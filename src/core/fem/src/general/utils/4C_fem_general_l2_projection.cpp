@@ -256,38 +256,13 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::solve_nodal_l2_proj
   // solution vector based on reduced node row map
   auto nodevec = std::make_shared<Core::LinAlg::MultiVector<double>>(noderowmap, numvec);
 
-  switch (solvertype)
-  {
-    case Core::LinearSolver::SolverType::belos:
-    {
-      // solve for numvec rhs at the same time using Belos solver
-      Core::LinAlg::SolverParams solver_params;
-      solver_params.refactor = true;
-      solver_params.reset = true;
-      solver.solve_with_multi_vector(massmatrix.epetra_operator(), nodevec,
-          Core::Utils::shared_ptr_from_ref(rhs), solver_params);
-      break;
-    }
-    default:
-    {
-      if (numvec != 1 and Core::Communication::my_mpi_rank(comm) == 0)
-      {
-        std::cout << "Think about using a Belos solver which can handle several rhs vectors at the "
-                     "same time\n";
-      }
-
-      // solve for numvec rhs iteratively
-      for (int i = 0; i < numvec; i++)
-      {
-        Core::LinAlg::SolverParams solver_params;
-        solver_params.refactor = true;
-        solver_params.reset = true;
-        solver.solve_with_multi_vector(massmatrix.epetra_operator(),
-            (*nodevec)(i).get_ptr_of_MultiVector(), rhs(i).get_ptr_of_MultiVector(), solver_params);
-      }
-      break;
-    }
-  }
+  // solve for numvec rhs at the same time: direct solvers factorize the mass matrix once, Belos
+  // solvers use a block Krylov method
+  Core::LinAlg::SolverParams solver_params;
+  solver_params.refactor = true;
+  solver_params.reset = true;
+  solver.solve_with_multi_vector(massmatrix.epetra_operator(), nodevec,
+      Core::Utils::shared_ptr_from_ref(rhs), solver_params);
 
   return nodevec;
 }
@@ -15,6 +15,9 @@
 #include <Epetra_MpiComm.h>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #ifdef FOUR_C_WITH_ARBORX
 #include <ArborX.hpp>
 #endif
@@ -98,6 +101,252 @@ namespace Core::GeometricSearch
     return {indices_final, offsets_final};
 #endif
   }
+
+#ifdef FOUR_C_WITH_ARBORX
+  namespace
+  {
+    using TreeBoxes = Kokkos::View<ArborX::Box*, Kokkos::HostSpace>;
+    using Tree = ArborX::BoundingVolumeHierarchy<Kokkos::HostSpace>;
+
+    /*! \brief Volume of an axis-aligned box
+     */
+    double box_volume(const ArborX::Box& box)
+    {
+      double volume = 1.0;
+      for (int dim = 0; dim < kdop_dim; dim++)
+        volume *= std::max(0.0, static_cast<double>(box.maxCorner()[dim] - box.minCorner()[dim]));
+      return volume;
+    }
+
+    /*! \brief Check if the box inner is fully contained in the box outer
+     */
+    bool box_contains(const ArborX::Box& outer, const ArborX::Box& inner)
+    {
+      for (int dim = 0; dim < kdop_dim; dim++)
+        if (inner.minCorner()[dim] < outer.minCorner()[dim] or
+            inner.maxCorner()[dim] > outer.maxCorner()[dim])
+          return false;
+      return true;
+    }
+
+    /*! \brief Enlarge a box in each direction by a fraction of its diagonal
+     */
+    ArborX::Box enlarge_box(const ArborX::Box& box, const double relative_margin)
+    {
+      double diagonal = 0.0;
+      for (int dim = 0; dim < kdop_dim; dim++)
+      {
+        const double extent = box.maxCorner()[dim] - box.minCorner()[dim];
+        diagonal += extent * extent;
+      }
+      const auto margin = static_cast<float>(relative_margin * std::sqrt(diagonal));
+
+      ArborX::Box enlarged_box = box;
+      for (int dim = 0; dim < kdop_dim; dim++)
+      {
+        enlarged_box.minCorner()[dim] -= margin;
+        enlarged_box.maxCorner()[dim] += margin;
+      }
+      return enlarged_box;
+    }
+
+    template <typename ExecutionSpace>
+    Tree build_tree(const TreeBoxes& tree_boxes)
+    {
+      return Tree(ExecutionSpace{}, tree_boxes);
+    }
+
+    template <typename ExecutionSpace>
+    void query_tree(const Tree& tree,
+        const std::vector<std::pair<int, BoundingVolume>>& primitives,
+        const std::vector<std::pair<int, BoundingVolume>>& predicates,
+        Kokkos::View<int*, Kokkos::HostSpace>& indices,
+        Kokkos::View<int*, Kokkos::HostSpace>& offsets)
+    {
+      // The tree only contains the enlarged axis-aligned boxes of the primitives, therefore the
+      // actual (refitted) k-DOPs are checked in the callback, see also collision_search().
+      const auto* primitive_data = primitives.data();
+      auto IntersectActualVolumeType =
+          KOKKOS_LAMBDA(const auto predicate, const int primitive_index, const auto& out)->void
+      {
+        if (predicate(primitive_data[primitive_index].second.bounding_volume_))
+          out(primitive_index);
+      };
+
+      tree.query(ExecutionSpace{}, predicates, IntersectActualVolumeType, indices, offsets);
+    }
+  }  // namespace
+
+  struct CollisionSearchTree::TreeData
+  {
+    //! Enlarged axis-aligned boxes of the primitives at the time the tree was built
+    TreeBoxes tree_boxes{"tree_boxes", 0};
+
+    //! The ArborX tree built from the tree boxes
+    Tree tree;
+
+    //! Query result buffers
+    Kokkos::View<int*, Kokkos::HostSpace> indices{"indices", 0};
+    Kokkos::View<int*, Kokkos::HostSpace> offsets{"offsets", 0};
+
+    //! Flag if the tree has been built
+    bool is_built = false;
+  };
+#else
+  struct CollisionSearchTree::TreeData
+  {
+  };
+#endif
+
+  CollisionSearchTree::CollisionSearchTree(MPI_Comm comm,
+      const CollisionSearchTreeParameters& parameters, const Core::IO::Verbositylevel verbosity)
+      : comm_(comm),
+        parameters_(parameters),
+        verbosity_(verbosity),
+        tree_data_(std::make_unique<TreeData>())
+  {
+#ifndef FOUR_C_WITH_ARBORX
+    FOUR_C_THROW(
+        "Core::GeometricSearch::CollisionSearchTree can only be used with ArborX."
+        "To use it, enable ArborX during the configure process.");
+#endif
+    FOUR_C_ASSERT(parameters_.refit_margin >= 0.0, "The refit margin has to be non-negative!");
+    FOUR_C_ASSERT(parameters_.max_volume_ratio >= 1.0, "The volume ratio has to be at least 1!");
+  }
+
+  CollisionSearchTree::~CollisionSearchTree() = default;
+
+  bool CollisionSearchTree::needs_rebuild(
+      const std::vector<std::pair<int, BoundingVolume>>& primitives) const
+  {
+#ifndef FOUR_C_WITH_ARBORX
+    return true;
+#else
+    if (not tree_data_->is_built or primitives.size() != primitives_.size()) return true;
+
+    double tree_volume = 0.0;
+    double rebuilt_tree_volume = 0.0;
+    for (std::size_t i = 0; i < primitives.size(); i++)
+    {
+      // Primitive indices in the tree have to stay the same.
+      if (primitives[i].first != primitives_[i].first) return true;
+
+      const ArborX::Box primitive_box{primitives[i].second.bounding_volume_};
+      const ArborX::Box& tree_box = tree_data_->tree_boxes(i);
+      if (not box_contains(tree_box, primitive_box)) return true;
+
+      tree_volume += box_volume(tree_box);
+      rebuilt_tree_volume += box_volume(enlarge_box(primitive_box, parameters_.refit_margin));
+    }
+
+    // Volume growth criterion: if the tree boxes became considerably larger than the boxes a
+    // rebuilt tree would have (i.e., the primitives shrunk), the tree produces too many false
+    // candidates and should be rebuilt. Comparing with the enlarged boxes instead of the bare
+    // primitive boxes keeps the criterion independent of the aspect ratio of the primitives.
+    return rebuilt_tree_volume > 0.0 and
+           tree_volume > parameters_.max_volume_ratio * rebuilt_tree_volume;
+#endif
+  }
+
+  void CollisionSearchTree::update_primitives(
+      const std::vector<std::pair<int, BoundingVolume>>& primitives)
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("Core::GeometricSearch::CollisionSearchTree::update_primitives");
+
+    const bool rebuild_tree = needs_rebuild(primitives);
+
+    // Refit the primitives in place, the exact volumes are used in the query callback.
+    primitives_ = primitives;
+
+    if (rebuild_tree)
+      rebuild();
+    else
+      number_of_refits_++;
+  }
+
+  void CollisionSearchTree::rebuild()
+  {
+#ifdef FOUR_C_WITH_ARBORX
+    TEUCHOS_FUNC_TIME_MONITOR("Core::GeometricSearch::CollisionSearchTree::rebuild");
+
+    TreeBoxes& tree_boxes = tree_data_->tree_boxes;
+    Kokkos::realloc(tree_boxes, primitives_.size());
+    for (std::size_t i = 0; i < primitives_.size(); i++)
+      tree_boxes(i) = enlarge_box(
+          ArborX::Box{primitives_[i].second.bounding_volume_}, parameters_.refit_margin);
+
+    // ArborX produces a floating point exception for empty trees, see collision_search(). An empty
+    // tree is handled in the query.
+    if (primitives_.size() > 0)
+    {
+      switch (parameters_.execution_space)
+      {
+        case SearchExecutionSpace::kokkos_default:
+          tree_data_->tree = build_tree<Kokkos::DefaultExecutionSpace>(tree_boxes);
+          break;
+        case SearchExecutionSpace::openmp:
+#ifdef KOKKOS_ENABLE_OPENMP
+          tree_data_->tree = build_tree<Kokkos::OpenMP>(tree_boxes);
+          break;
+#else
+          FOUR_C_THROW("The OpenMP execution space requires Kokkos to be built with OpenMP.");
+#endif
+      }
+    }
+
+    tree_data_->is_built = true;
+    number_of_rebuilds_++;
+#endif
+  }
+
+  std::pair<const std::vector<int>&, const std::vector<int>&> CollisionSearchTree::query(
+      const std::vector<std::pair<int, BoundingVolume>>& predicates)
+  {
+#ifdef FOUR_C_WITH_ARBORX
+    TEUCHOS_FUNC_TIME_MONITOR("Core::GeometricSearch::CollisionSearchTree::query");
+
+    FOUR_C_ASSERT(tree_data_->is_built, "The primitives of the search tree have not been set!");
+
+    if (primitives_.size() == 0 or predicates.size() == 0)
+    {
+      // No collisions possible, see collision_search().
+      indices_.clear();
+      offsets_.assign(predicates.size() + 1, 0);
+    }
+    else
+    {
+      auto& indices = tree_data_->indices;
+      auto& offsets = tree_data_->offsets;
+      switch (parameters_.execution_space)
+      {
+        case SearchExecutionSpace::kokkos_default:
+          query_tree<Kokkos::DefaultExecutionSpace>(
+              tree_data_->tree, primitives_, predicates, indices, offsets);
+          break;
+        case SearchExecutionSpace::openmp:
+#ifdef KOKKOS_ENABLE_OPENMP
+          query_tree<Kokkos::OpenMP>(tree_data_->tree, primitives_, predicates, indices, offsets);
+          break;
+#else
+          FOUR_C_THROW("The OpenMP execution space requires Kokkos to be built with OpenMP.");
+#endif
+      }
+
+      // Copy into the persistent result buffers (reusing their capacity).
+      indices_.assign(indices.data(), indices.data() + indices.extent(0));
+      offsets_.assign(offsets.data(), offsets.data() + offsets.extent(0));
+    }
+
+    if (verbosity_ == Core::IO::verbose)
+    {
+      Core::GeometricSearch::GeometricSearchInfo info = {static_cast<int>(primitives_.size()),
+          static_cast<int>(predicates.size()), static_cast<int>(indices_.size())};
+      Core::GeometricSearch::print_geometric_search_details(comm_, info);
+    }
+#endif
+
+    return {indices_, offsets_};
+  }
 }  // namespace Core::GeometricSearch
 
 FOUR_C_NAMESPACE_CLOSE
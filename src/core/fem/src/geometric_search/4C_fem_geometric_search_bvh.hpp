@@ -12,6 +12,7 @@
 
 #include "4C_io_pstream.hpp"
 
+#include <memory>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -43,6 +44,109 @@ namespace Core::GeometricSearch
       const std::vector<std::pair<int, BoundingVolume>>& predicates, MPI_Comm comm,
       const Core::IO::Verbositylevel verbosity);
 
+  /*! \brief Kokkos execution space used to build and query a collision search tree
+   */
+  enum class SearchExecutionSpace
+  {
+    kokkos_default,  ///< build and query the tree in the default Kokkos execution space
+    openmp           ///< build and query the tree with Kokkos OpenMP threads on the host
+  };
+
+  /*! \brief Parameters controlling the life cycle of a persistent collision search tree
+   */
+  struct CollisionSearchTreeParameters
+  {
+    //! Relative margin (with respect to the box diagonal) by which the primitive boxes are enlarged
+    //! when the tree is built. Primitives moving within this margin only require a refit.
+    double refit_margin = 0.1;
+
+    //! The tree is rebuilt once the summed volume of the (enlarged) tree boxes exceeds this
+    //! multiple of the summed volume of the enlarged current primitive boxes, i.e., of the tree
+    //! boxes after a rebuild.
+    double max_volume_ratio = 4.0;
+
+    //! Execution space for tree construction and query
+    SearchExecutionSpace execution_space = SearchExecutionSpace::kokkos_default;
+  };
+
+  /*! \brief Persistent bounding volume hierarchy for repeated local collision searches.
+   *
+   * In contrast to collision_search(), the tree and the result buffers are kept alive between
+   * calls. The tree is built from the axis-aligned boxes of the primitives, enlarged by a relative
+   * margin. When the primitives are updated, the exact bounding volumes are refitted in place and
+   * the tree is only rebuilt if the set of primitives changed, a primitive left its enlarged box,
+   * or the tree boxes have become too loose compared to the current primitives (volume growth
+   * criterion). Since the query callback always checks the exact bounding volumes, the result
+   * is identical to the one of collision_search().
+   */
+  class CollisionSearchTree
+  {
+   public:
+    CollisionSearchTree(MPI_Comm comm, const CollisionSearchTreeParameters& parameters,
+        const Core::IO::Verbositylevel verbosity);
+
+    ~CollisionSearchTree();
+
+    /*! \brief Set the primitives of the tree, refitting the existing tree if possible.
+     *
+     * @param primitives Bounding volumes to search for intersections
+     */
+    void update_primitives(const std::vector<std::pair<int, BoundingVolume>>& primitives);
+
+    /*! \brief Check if the given primitives can be refitted into the current tree.
+     *
+     * @param primitives Bounding volumes to search for intersections
+     * @return True if the tree has to be rebuilt for the given primitives
+     */
+    [[nodiscard]] bool needs_rebuild(
+        const std::vector<std::pair<int, BoundingVolume>>& primitives) const;
+
+    /*! \brief Finds all primitives meeting the predicates.
+     *
+     * The results are stored in buffers owned by this object, i.e., the returned references are
+     * valid until the next call to query(). See collision_search() for the meaning of the indices
+     * and offsets.
+     *
+     * @param predicates Bounding volumes to intersect with
+     * @return {indices, offsets} of the found collisions
+     */
+    std::pair<const std::vector<int>&, const std::vector<int>&> query(
+        const std::vector<std::pair<int, BoundingVolume>>& predicates);
+
+    //! Number of times the tree has been (re)built
+    [[nodiscard]] int number_of_rebuilds() const { return number_of_rebuilds_; }
+
+    //! Number of times the tree has been refitted without rebuild
+    [[nodiscard]] int number_of_refits() const { return number_of_refits_; }
+
+   private:
+    //! Build the tree from the currently stored primitives
+    void rebuild();
+
+    //! Communicator (only used for printing details of the search)
+    MPI_Comm comm_;
+
+    //! Life cycle and execution parameters
+    CollisionSearchTreeParameters parameters_;
+
+    //! Verbosity of the search
+    Core::IO::Verbositylevel verbosity_;
+
+    //! Current (refitted) primitives, used for the exact intersection check
+    std::vector<std::pair<int, BoundingVolume>> primitives_;
+
+    //! ArborX tree and enlarged tree boxes (hidden to avoid exposing ArborX in this header)
+    struct TreeData;
+    std::unique_ptr<TreeData> tree_data_;
+
+    //! Result buffers
+    std::vector<int> indices_;
+    std::vector<int> offsets_;
+
+    int number_of_rebuilds_ = 0;
+    int number_of_refits_ = 0;
+  };
+
 }  // namespace Core::GeometricSearch
 
 FOUR_C_NAMESPACE_CLOSE
@@ -32,5 +32,18 @@ Core::GeometricSearch::GeometricSearchParams::GeometricSearchParams(
   verbosity_ = Teuchos::getIntegralValue<Core::IO::Verbositylevel>(io_params, "VERBOSITY");
 
   write_visualization_ = geometric_search_params.get<bool>("WRITE_GEOMETRIC_SEARCH_VISUALIZATION");
+
+  collision_search_tree_parameters_.refit_margin =
+      geometric_search_params.get<double>("TREE_REFIT_MARGIN");
+  FOUR_C_ASSERT(!std::signbit(collision_search_tree_parameters_.refit_margin),
+      "Tree refit margin needs to be positive!");
+
+  collision_search_tree_parameters_.max_volume_ratio =
+      geometric_search_params.get<double>("TREE_MAX_VOLUME_RATIO");
+  FOUR_C_ASSERT(collision_search_tree_parameters_.max_volume_ratio >= 1.0,
+      "Tree maximum volume ratio needs to be at least 1!");
+
+  collision_search_tree_parameters_.execution_space =
+      Teuchos::getIntegralValue<SearchExecutionSpace>(geometric_search_params, "EXECUTION_SPACE");
 }
 FOUR_C_NAMESPACE_CLOSE
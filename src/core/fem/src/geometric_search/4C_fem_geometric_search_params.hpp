@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_fem_geometric_search_bvh.hpp"
 #include "4C_io_pstream.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
@@ -42,6 +43,14 @@ namespace Core::GeometricSearch
      */
     bool get_write_visualization_flag() const { return write_visualization_; }
 
+    /*!
+     * \brief Returns the parameters for persistent collision search trees
+     */
+    const CollisionSearchTreeParameters& get_collision_search_tree_parameters() const
+    {
+      return collision_search_tree_parameters_;
+    }
+
     /*! \brief verbosity level of the geometric search algorithm
      */
     Core::IO::Verbositylevel verbosity_;
@@ -50,6 +59,7 @@ namespace Core::GeometricSearch
     double beam_radius_extension_factor_;
     double sphere_radius_extension_factor_;
     bool write_visualization_;
+    CollisionSearchTreeParameters collision_search_tree_parameters_;
   };
 }  // namespace Core::GeometricSearch
 
@@ -128,6 +128,130 @@ namespace
     EXPECT_EQ(pairs.size(), 0);
   }
 
+  /**
+   * Checking that the persistent collision search tree gives the same result as the collision
+   * search and is refitted for small changes of the primitives
+   */
+  TEST_F(GeometricSearch, CollisionSearchTreeRefit)
+  {
+    auto volumes = create_kdop_bounding_volumes();
+
+    primitives_.emplace_back(std::pair{0, volumes[0]});
+    primitives_.emplace_back(std::pair{1, volumes[1]});
+    predicates_.emplace_back(std::pair{2, volumes[2]});
+
+    Core::GeometricSearch::CollisionSearchTree tree(comm_, {}, verbosity_);
+    tree.update_primitives(primitives_);
+
+    {
+      const auto& [indices, offsets] = tree.query(predicates_);
+      const auto pairs = Core::GeometricSearch::get_pairs(indices, offsets);
+      EXPECT_EQ(pairs.size(), 1);
+      EXPECT_EQ(pairs[0].first, 0);
+      EXPECT_EQ(pairs[0].second, 0);
+    }
+
+    // A small extension of the primitives stays within the refit margin of the tree.
+    for (auto& [id, volume] : primitives_) volume.extend_boundaries(0.01);
+    EXPECT_FALSE(tree.needs_rebuild(primitives_));
+    tree.update_primitives(primitives_);
+
+    const auto& [indices_reference, offsets_reference] =
+        Core::GeometricSearch::collision_search(primitives_, predicates_, comm_, verbosity_);
+    const auto& [indices, offsets] = tree.query(predicates_);
+    EXPECT_EQ(indices, indices_reference);
+    EXPECT_EQ(offsets, offsets_reference);
+
+    EXPECT_EQ(tree.number_of_rebuilds(), 1);
+    EXPECT_EQ(tree.number_of_refits(), 1);
+  }
+
+  /**
+   * Checking that the persistent collision search tree is rebuilt if the primitives leave the
+   * tree boxes or the set of primitives changes
+   */
+  TEST_F(GeometricSearch, CollisionSearchTreeRebuild)
+  {
+    auto volumes = create_kdop_bounding_volumes();
+
+    primitives_.emplace_back(std::pair{0, volumes[0]});
+    primitives_.emplace_back(std::pair{1, volumes[1]});
+    predicates_.emplace_back(std::pair{2, volumes[2]});
+
+    Core::GeometricSearch::CollisionSearchTree tree(comm_, {}, verbosity_);
+    tree.update_primitives(primitives_);
+
+    // Move the second primitive such that it intersects the predicate.
+    Core::LinAlg::Matrix<3, 1, double> point(true);
+    point(0) = 0.55;
+    point(1) = 0.24;
+    primitives_[1].second.add_point(point);
+    EXPECT_TRUE(tree.needs_rebuild(primitives_));
+    tree.update_primitives(primitives_);
+
+    {
+      const auto& [indices, offsets] = tree.query(predicates_);
+      const auto pairs = Core::GeometricSearch::get_pairs(indices, offsets);
+      EXPECT_EQ(pairs.size(), 2);
+    }
+
+    // Change the set of primitives.
+    primitives_.pop_back();
+    EXPECT_TRUE(tree.needs_rebuild(primitives_));
+    tree.update_primitives(primitives_);
+
+    {
+      const auto& [indices, offsets] = tree.query(predicates_);
+      const auto pairs = Core::GeometricSearch::get_pairs(indices, offsets);
+      EXPECT_EQ(pairs.size(), 1);
+    }
+
+    EXPECT_EQ(tree.number_of_rebuilds(), 3);
+    EXPECT_EQ(tree.number_of_refits(), 0);
+  }
+
+  /**
+   * Checking that slender primitives (e.g. beam segments) moving within the refit margin are
+   * refitted and only rebuilt once they shrink considerably
+   */
+  TEST_F(GeometricSearch, CollisionSearchTreeSlenderPrimitives)
+  {
+    // slender boxes along the x-axis with an aspect ratio of 100
+    const auto slender_box = [](double x_offset, double length)
+    {
+      Core::GeometricSearch::BoundingVolume volume;
+      Core::LinAlg::Matrix<3, 1, double> point(true);
+      point(0) = x_offset;
+      volume.add_point(point);
+      point(0) = x_offset + length;
+      point(1) = 0.01 * length;
+      point(2) = 0.01 * length;
+      volume.add_point(point);
+      return volume;
+    };
+
+    for (int i = 0; i < 3; i++) primitives_.emplace_back(std::pair{i, slender_box(2.0 * i, 1.0)});
+
+    Core::GeometricSearch::CollisionSearchTree tree(comm_, {}, verbosity_);
+    tree.update_primitives(primitives_);
+
+    // Move the primitives along their axis within the refit margin.
+    for (int step = 1; step <= 3; step++)
+    {
+      for (int i = 0; i < 3; i++) primitives_[i].second = slender_box(2.0 * i + 0.01 * step, 1.0);
+      EXPECT_FALSE(tree.needs_rebuild(primitives_));
+      tree.update_primitives(primitives_);
+    }
+    EXPECT_EQ(tree.number_of_rebuilds(), 1);
+    EXPECT_EQ(tree.number_of_refits(), 3);
+
+    // Shrinking the primitives to a fraction of their length makes the tree boxes too loose.
+    for (int i = 0; i < 3; i++) primitives_[i].second = slender_box(2.0 * i + 0.4, 0.2);
+    EXPECT_TRUE(tree.needs_rebuild(primitives_));
+    tree.update_primitives(primitives_);
+    EXPECT_EQ(tree.number_of_rebuilds(), 2);
+  }
+
   /**
    * Check that the tolerance mechanism in the kDOP visualization works. The present values are
    * taken from a previously failing kDOP.
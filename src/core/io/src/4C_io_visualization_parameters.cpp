@@ -28,6 +28,12 @@ Core::IO::VisualizationParameters Core::IO::visualization_parameters_factory(
   // Data format
   parameters.data_format_ = Teuchos::getIntegralValue<OutputDataFormat>(
       visualization_output_parameter_list, "OUTPUT_DATA_FORMAT");
+  parameters.compression_ = Teuchos::getIntegralValue<OutputCompression>(
+      visualization_output_parameter_list, "OUTPUT_DATA_COMPRESSION");
+  parameters.compression_level_ =
+      visualization_output_parameter_list.get<int>("OUTPUT_DATA_COMPRESSION_LEVEL");
+  if (parameters.compression_level_ < 1 or parameters.compression_level_ > 9)
+    FOUR_C_THROW("The compression level of the visualization output has to be between 1 and 9.");
 
   // Number of digits to reserve for time step count
   parameters.digits_for_time_step_ =
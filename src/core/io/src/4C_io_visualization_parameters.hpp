@@ -25,11 +25,19 @@ namespace Core::IO
   /// data format for written numeric data
   enum class OutputDataFormat
   {
-    binary,
+    binary,           // inline base64 encoded binary data
+    binary_appended,  // raw binary data appended to the end of the file
     ascii,
     vague
   };
 
+  /// compression of appended binary data
+  enum class OutputCompression
+  {
+    none,
+    zlib
+  };
+
   // Specify the output writer that shall be used
   enum class OutputWriter
   {
@@ -45,6 +53,12 @@ namespace Core::IO
     //! Enum containing the type of output data format, i.e., binary or ascii.
     OutputDataFormat data_format_;
 
+    //! Compression of appended binary data
+    OutputCompression compression_;
+
+    //! zlib compression level (1: fastest, 9: best compression) of appended binary data
+    int compression_level_;
+
     //! Base output directory
     std::string directory_name_;
 
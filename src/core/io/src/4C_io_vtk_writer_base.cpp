@@ -11,7 +11,9 @@
 #include "4C_io_pstream.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <iomanip>
 #include <limits>
@@ -174,6 +176,11 @@ namespace LibB64
 
 }  // namespace LibB64
 
+namespace
+{
+  //! number of uncompressed bytes per compressed block of appended data (default of VTK)
+  constexpr std::size_t appended_data_block_size = 32768;
+}  // namespace
 
 
 /*----------------------------------------------------------------------*
@@ -182,7 +189,9 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
     unsigned int max_number_timesteps_to_be_written,
     const std::string& path_existing_working_directory,
     const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-    const std::string& restart_name, const double restart_time, bool write_binary_output)
+    const std::string& restart_name, const double restart_time,
+    Core::IO::OutputDataFormat data_format, Core::IO::OutputCompression compression,
+    int compression_level)
     : currentPhase_(VAGUE),
       num_timestep_digits_(LibB64::ndigits(max_number_timesteps_to_be_written)),
       num_processor_digits_(LibB64::ndigits(num_processors)),
@@ -191,7 +200,11 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
       timestep_(std::numeric_limits<unsigned int>::min()),
       is_restart_(restart_time > 0.0),
       cycle_(std::numeric_limits<int>::max()),
-      write_binary_output_(write_binary_output),
+      write_binary_output_(data_format == Core::IO::OutputDataFormat::binary or
+                           data_format == Core::IO::OutputDataFormat::binary_appended),
+      write_appended_data_(data_format == Core::IO::OutputDataFormat::binary_appended),
+      compression_(compression),
+      compression_level_(compression_level),
       myrank_(myrank),
       numproc_(num_processors)
 {
@@ -268,7 +281,12 @@ void VtkWriterBase::initialize_vtk_file_stream_this_processor()
             << get_part_of_file_name_indicating_processor_id(myrank_) << this->writer_suffix();
 
   currentout_.close();
-  currentout_.open(tmpstream.str().c_str());
+  if (write_appended_data_)
+    currentout_.open(tmpstream.str().c_str(), std::ofstream::out | std::ofstream::binary);
+  else
+    currentout_.open(tmpstream.str().c_str());
+
+  appended_data_.clear();
 }
 
 /*----------------------------------------------------------------------*
@@ -386,7 +404,8 @@ void VtkWriterBase::write_vtk_header_this_processor(const std::string& byteorder
   currentout_ << "# vtk DataFile Version 3.0\n";
   currentout_ << "-->\n";
   currentout_ << "<VTKFile type=\"" << this->writer_string() << "\" version=\"0.1\"";
-  currentout_ << " compressor=\"vtkZLibDataCompressor\"";
+  if (not write_appended_data_ or compression_ == Core::IO::OutputCompression::zlib)
+    currentout_ << " compressor=\"vtkZLibDataCompressor\"";
   currentout_ << " byte_order=\"" << byteorder << "\"";
   currentout_ << ">\n";
   currentout_ << "  " << this->writer_opening_tag() << "\n";
@@ -494,9 +513,7 @@ void VtkWriterBase::write_data_array_this_processor(
 
   if (write_binary_output_)
   {
-    filestream << " format=\"binary\">\n";
-
-    LibB64::write_compressed_block(data, filestream);
+    write_binary_data_array(data);
   }
   else
   {
@@ -521,6 +538,62 @@ void VtkWriterBase::write_data_array_this_processor(
   filestream << "        </DataArray>\n";
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void VtkWriterBase::append_data_blocks(const char* data, const std::size_t num_bytes)
+{
+  if (num_bytes > std::numeric_limits<uint32_t>::max())
+    FOUR_C_THROW("VtkWriterBase: data arrays larger than 4 GB cannot be written.");
+
+  const auto append = [&](const void* bytes, const std::size_t size)
+  {
+    const char* begin = static_cast<const char*>(bytes);
+    appended_data_.insert(appended_data_.end(), begin, begin + size);
+  };
+
+  if (compression_ == Core::IO::OutputCompression::none)
+  {
+    // header: number of bytes
+    const uint32_t header = num_bytes;
+    append(&header, sizeof(header));
+    append(data, num_bytes);
+    return;
+  }
+
+  // header: number of blocks, size of blocks, size of last block, compressed sizes of blocks
+  const std::size_t num_blocks =
+      (num_bytes + appended_data_block_size - 1) / appended_data_block_size;
+  std::vector<uint32_t> header(3 + num_blocks);
+  header[0] = num_blocks;
+  header[1] = appended_data_block_size;
+  header[2] = num_blocks > 0 ? num_bytes - (num_blocks - 1) * appended_data_block_size : 0;
+
+  // the compressed sizes are only known after compression, so reserve space for the header first
+  const std::size_t header_position = appended_data_.size();
+  appended_data_.resize(header_position + header.size() * sizeof(uint32_t));
+
+  for (std::size_t block = 0; block < num_blocks; ++block)
+  {
+    const std::size_t block_begin = block * appended_data_block_size;
+    const std::size_t block_size = std::min(appended_data_block_size, num_bytes - block_begin);
+
+    const std::size_t position = appended_data_.size();
+    uLongf compressed_size = compressBound(block_size);
+    appended_data_.resize(position + compressed_size);
+
+    int err = compress2(reinterpret_cast<Bytef*>(appended_data_.data() + position),
+        &compressed_size, reinterpret_cast<const Bytef*>(data + block_begin), block_size,
+        compression_level_);
+    if (err != Z_OK) FOUR_C_THROW("zlib compression failed");
+
+    appended_data_.resize(position + compressed_size);
+    header[3 + block] = compressed_size;
+  }
+
+  std::memcpy(
+      appended_data_.data() + header_position, header.data(), header.size() * sizeof(uint32_t));
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 void VtkWriterBase::write_vtk_footers()
@@ -604,6 +677,18 @@ void VtkWriterBase::write_vtk_footer_this_processor()
   currentout_ << "    </Piece>\n";
 
   currentout_ << "  </" << this->writer_string() << ">\n";
+
+  if (write_appended_data_)
+  {
+    // the raw data starts right after the underscore, offsets of the DataArrays are relative to it
+    currentout_ << "  <AppendedData encoding=\"raw\">\n   _";
+    currentout_.write(appended_data_.data(), appended_data_.size());
+    currentout_ << "\n  </AppendedData>\n";
+
+    appended_data_.clear();
+    appended_data_.shrink_to_fit();
+  }
+
   currentout_ << "</VTKFile>\n";
 
   currentout_ << std::flush;
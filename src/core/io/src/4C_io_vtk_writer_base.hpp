@@ -12,6 +12,7 @@
 #include "4C_config.hpp"
 
 #include "4C_io_visualization_data.hpp"
+#include "4C_io_visualization_parameters.hpp"
 #include "4C_utils_exceptions.hpp"
 
 #include <stdint.h>
@@ -104,7 +105,8 @@ class VtkWriterBase
       unsigned int max_number_timesteps_to_be_written,
       const std::string& path_existing_working_directory,
       const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-      const std::string& restart_name, double restart_time, bool write_binary_output);
+      const std::string& restart_name, double restart_time, Core::IO::OutputDataFormat data_format,
+      Core::IO::OutputCompression compression, int compression_level);
 
   //! destructor
   virtual ~VtkWriterBase() = default;
@@ -153,6 +155,27 @@ class VtkWriterBase
   void write_data_array(const Core::IO::visualization_vector_type_variant& data,
       const int num_components, const std::string& name);
 
+  /*! \brief write the binary data of a DataArray whose opening tag has been written up to the
+   *  format attribute
+   *
+   *  Depending on the data format, the data is either base64 encoded and written inline or
+   *  appended to the raw binary data that is written at the end of the file.
+   */
+  template <typename T>
+  void write_binary_data_array(const std::vector<T>& data)
+  {
+    if (write_appended_data_)
+    {
+      currentout_ << " format=\"appended\" offset=\"" << appended_data_.size() << "\">\n";
+      append_data_blocks(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+    }
+    else
+    {
+      currentout_ << " format=\"binary\">\n";
+      LibB64::write_compressed_block(data, currentout_);
+    }
+  }
+
   //! generate the part of the filename that expresses the processor ID
   const std::string& get_part_of_file_name_indicating_processor_id(unsigned int processor_id) const;
 
@@ -201,6 +224,13 @@ class VtkWriterBase
       const std::vector<T>& data, const int num_components, const std::string& name);
 
 
+  /*! \brief append raw binary data to the appended data section of this processor's file
+   *
+   *  The data is split into blocks which are compressed one after another, so that no copy of
+   *  the uncompressed data is required.
+   */
+  void append_data_blocks(const char* data, std::size_t num_bytes);
+
   //! write epilogue of of the VTK master file (handled by proc 0)
   void write_vtk_footer_master_file();
 
@@ -336,6 +366,18 @@ class VtkWriterBase
   //! toggle between ascii and binary output
   const bool write_binary_output_;
 
+  //! write binary data as raw data appended to the end of the file instead of inline base64
+  const bool write_appended_data_;
+
+  //! compression of appended binary data
+  const Core::IO::OutputCompression compression_;
+
+  //! zlib compression level of appended binary data
+  const int compression_level_;
+
+  //! (compressed) binary data to be appended to the file on this processor
+  std::vector<char> appended_data_;
+
 
   //! global processor id of this processor
   const unsigned int myrank_;
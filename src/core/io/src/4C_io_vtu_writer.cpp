@@ -24,10 +24,12 @@ VtuWriter::VtuWriter(unsigned int myrank, unsigned int num_processors,
     unsigned int max_number_timesteps_to_be_written,
     const std::string& path_existing_working_directory,
     const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-    const std::string& restart_name, const double restart_time, bool write_binary_output)
+    const std::string& restart_name, const double restart_time,
+    Core::IO::OutputDataFormat data_format, Core::IO::OutputCompression compression,
+    int compression_level)
     : VtkWriterBase(myrank, num_processors, max_number_timesteps_to_be_written,
           path_existing_working_directory, name_new_vtk_subdirectory, geometry_name, restart_name,
-          restart_time, write_binary_output)
+          restart_time, data_format, compression, compression_level)
 {
   // empty constructor
 }
@@ -139,8 +141,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(point_coordinates, currentout_);
+    write_binary_data_array(point_coordinates);
   }
   else
   {
@@ -177,8 +178,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(point_cell_connectivity, currentout_);
+    write_binary_data_array(point_cell_connectivity);
   }
   else
   {
@@ -199,8 +199,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
 
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(cell_offset, currentout_);
+    write_binary_data_array(cell_offset);
   }
   else
   {
@@ -219,8 +218,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
   currentout_ << "        <DataArray type=\"UInt8\" Name=\"types\"";
   if (write_binary_output_)
   {
-    currentout_ << " format=\"binary\">\n";
-    LibB64::write_compressed_block(cell_types, currentout_);
+    write_binary_data_array(cell_types);
   }
   else
   {
@@ -237,8 +235,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
     currentout_ << R"(        <DataArray type="Int32" Name="faces")";
     if (write_binary_output_)
     {
-      currentout_ << " format=\"binary\">\n";
-      LibB64::write_compressed_block(face_connectivity, currentout_);
+      write_binary_data_array(face_connectivity);
     }
     else
     {
@@ -251,8 +248,7 @@ void VtuWriter::write_geometry_unstructured_grid(const std::vector<double>& poin
     currentout_ << R"(        <DataArray type="Int32" Name="faceoffsets")";
     if (write_binary_output_)
     {
-      currentout_ << " format=\"binary\">\n";
-      LibB64::write_compressed_block(face_offset, currentout_);
+      write_binary_data_array(face_offset);
     }
     else
     {
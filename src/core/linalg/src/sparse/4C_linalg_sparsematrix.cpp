@@ -12,6 +12,7 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iterator>
 #include <memory>
@@ -1058,12 +1059,15 @@ void Core::LinAlg::SparseMatrix::apply_dirichlet(const Epetra_Map& dbctoggle, bo
     else
       FOUR_C_THROW("matrix type is not correct");
 
+    const std::vector<int>& dbcrows = dirichlet_condensation(dbctoggle, false).rows;
+    auto nextdbcrow = dbcrows.begin();
+
     std::vector<int> indices(maxnumentries, 0);
     std::vector<double> values(maxnumentries, 0.0);
     for (int i = 0; i < nummyrows; ++i)
     {
       int row = sysmat_->GRID(i);
-      if (not dbctoggle.MyGID(row))
+      if (nextdbcrow == dbcrows.end() or *nextdbcrow != i)
       {
         int numentries;
 #ifdef FOUR_C_ENABLE_ASSERTIONS
@@ -1085,6 +1089,7 @@ void Core::LinAlg::SparseMatrix::apply_dirichlet(const Epetra_Map& dbctoggle, bo
       }
       else
       {
+        ++nextdbcrow;
         if (diagonalblock)
         {
           double v = 1.0;
@@ -1104,37 +1109,159 @@ void Core::LinAlg::SparseMatrix::apply_dirichlet(const Epetra_Map& dbctoggle, bo
   }
   else
   {
-    const int nummyrows = sysmat_->NumMyRows();
-    for (int i = 0; i < nummyrows; ++i)
+    // zero the Dirichlet rows in place, only the rows known from the condensation are touched
+    const DirichletCondensation& condensation = dirichlet_condensation(dbctoggle, false);
+
+    int* indexOffset;
+    int* indices;
+    double* values;
+    int err = sysmat_->ExtractCrsDataPointers(indexOffset, indices, values);
+    if (err < 0) FOUR_C_THROW("Epetra_CrsMatrix::ExtractCrsDataPointers returned err=%d", err);
+
+    const int numdbcrows = static_cast<int>(condensation.rows.size());
+    for (int k = 0; k < numdbcrows; ++k)
     {
-      int row = sysmat_->GRID(i);
-      if (dbctoggle.MyGID(row))
+      const int i = condensation.rows[k];
+      memset(&values[indexOffset[i]], 0, (indexOffset[i + 1] - indexOffset[i]) * sizeof(double));
+      if (diagonalblock)
       {
-        int* indexOffset;
-        int* indices;
-        double* values;
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-        int err = sysmat_->ExtractCrsDataPointers(indexOffset, indices, values);
-        if (err < 0) FOUR_C_THROW("Epetra_CrsMatrix::ExtractCrsDataPointers returned err=%d", err);
-#else
-        sysmat_->ExtractCrsDataPointers(indexOffset, indices, values);
-#endif
-        // zero row
-        memset(&values[indexOffset[i]], 0, (indexOffset[i + 1] - indexOffset[i]) * sizeof(double));
+        if (condensation.diagonal[k] < 0)
+          FOUR_C_THROW(
+              "Dirichlet row %d has no diagonal entry in the matrix graph", sysmat_->GRID(i));
+        values[condensation.diagonal[k]] = 1.0;
+      }
+    }
+  }
+}
 
-        if (diagonalblock)
-        {
-          double one = 1.0;
-#ifdef FOUR_C_ENABLE_ASSERTIONS
-          err = sysmat_->SumIntoMyValues(i, 1, &one, &i);
-          if (err < 0) FOUR_C_THROW("Epetra_CrsMatrix::SumIntoMyValues returned err=%d", err);
-#else
-          sysmat_->SumIntoMyValues(i, 1, &one, &i);
-#endif
-        }
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::SparseMatrix::apply_dirichlet_symmetric(
+    const Epetra_Map& dbcmap, bool diagonalblock)
+{
+  if (not filled()) FOUR_C_THROW("expect filled matrix to apply dirichlet conditions");
+
+  if (dbcmaps_ != nullptr)
+    FOUR_C_THROW("Symmetric Dirichlet elimination cannot be combined with a Dirichlet map");
+
+  const DirichletCondensation& condensation = dirichlet_condensation(dbcmap, true);
+
+  int* indexOffset;
+  int* indices;
+  double* values;
+  int err = sysmat_->ExtractCrsDataPointers(indexOffset, indices, values);
+  if (err < 0) FOUR_C_THROW("Epetra_CrsMatrix::ExtractCrsDataPointers returned err=%d", err);
+
+  // zero rows
+  const int numdbcrows = static_cast<int>(condensation.rows.size());
+  for (int k = 0; k < numdbcrows; ++k)
+  {
+    const int i = condensation.rows[k];
+    memset(&values[indexOffset[i]], 0, (indexOffset[i + 1] - indexOffset[i]) * sizeof(double));
+    if (diagonalblock)
+    {
+      if (condensation.diagonal[k] < 0)
+        FOUR_C_THROW(
+            "Dirichlet row %d has no diagonal entry in the matrix graph", sysmat_->GRID(i));
+      values[condensation.diagonal[k]] = 1.0;
+    }
+  }
+
+  // zero columns
+  for (const int entry : condensation.column_entries) values[entry] = 0.0;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const Core::LinAlg::SparseMatrix::DirichletCondensation&
+Core::LinAlg::SparseMatrix::dirichlet_condensation(const Epetra_Map& dbcmap, bool symmetric)
+{
+  const Epetra_CrsGraph& graph = sysmat_->Graph();
+
+  // the graph data is shared by all copies of a graph, i.e. the offsets are still valid if the
+  // matrix has been rebuilt from the saved graph
+  if (dirichlet_condensation_ != nullptr and
+      dirichlet_condensation_->graph->DataPtr() == graph.DataPtr() and
+      (dirichlet_condensation_->symmetric or not symmetric) and
+      dirichlet_condensation_->dbcmap->SameAs(dbcmap))
+    return *dirichlet_condensation_;
+
+  TEUCHOS_FUNC_TIME_MONITOR("Core::LinAlg::SparseMatrix::dirichlet_condensation");
+
+  auto condensation = std::make_shared<DirichletCondensation>();
+  condensation->dbcmap = std::make_shared<Epetra_Map>(dbcmap);
+  condensation->graph = std::make_shared<Epetra_CrsGraph>(graph);
+  condensation->symmetric = symmetric;
+
+  int* indexOffset;
+  int* indices;
+  double* values;
+  int err = sysmat_->ExtractCrsDataPointers(indexOffset, indices, values);
+  if (err < 0) FOUR_C_THROW("Epetra_CrsMatrix::ExtractCrsDataPointers returned err=%d", err);
+
+  // Dirichlet dofs that are not rows of this matrix are ignored
+  const int numdbc = dbcmap.NumMyElements();
+  const int* dbcgids = dbcmap.MyGlobalElements();
+  condensation->rows.reserve(numdbc);
+  for (int k = 0; k < numdbc; ++k)
+  {
+    const int lid = sysmat_->LRID(dbcgids[k]);
+    if (lid >= 0) condensation->rows.push_back(lid);
+  }
+  std::sort(condensation->rows.begin(), condensation->rows.end());
+
+  condensation->diagonal.reserve(condensation->rows.size());
+  for (const int i : condensation->rows)
+  {
+    const int diagcol = sysmat_->LCID(sysmat_->GRID(i));
+    int diagentry = -1;
+    for (int j = indexOffset[i]; j < indexOffset[i + 1]; ++j)
+    {
+      if (indices[j] == diagcol)
+      {
+        diagentry = j;
+        break;
       }
     }
+    condensation->diagonal.push_back(diagentry);
   }
+
+  if (symmetric)
+  {
+    // mark the Dirichlet columns, the Dirichlet dofs of other processors enter via the importer
+    const Epetra_Map& domainmap = sysmat_->DomainMap();
+    Core::LinAlg::Vector<double> domaintoggle(domainmap, true);
+    for (int k = 0; k < numdbc; ++k)
+    {
+      const int lid = domainmap.LID(dbcgids[k]);
+      if (lid >= 0) domaintoggle[lid] = 1.0;
+    }
+
+    Core::LinAlg::Vector<double> coltoggle(sysmat_->ColMap(), true);
+    if (sysmat_->Importer() != nullptr)
+    {
+      err = coltoggle.Import(
+          domaintoggle.get_ref_of_Epetra_Vector(), *sysmat_->Importer(), Insert);
+      if (err) FOUR_C_THROW("Import of Dirichlet toggle to column map failed with err=%d", err);
+    }
+    else
+      coltoggle.Update(1.0, domaintoggle, 0.0);
+
+    std::vector<char> isdbcrow(sysmat_->NumMyRows(), 0);
+    for (const int i : condensation->rows) isdbcrow[i] = 1;
+
+    for (int i = 0; i < sysmat_->NumMyRows(); ++i)
+    {
+      if (isdbcrow[i]) continue;
+      for (int j = indexOffset[i]; j < indexOffset[i + 1]; ++j)
+        if (coltoggle[indices[j]] == 1.0) condensation->column_entries.push_back(j);
+    }
+  }
+
+  dirichlet_condensation_ = condensation;
+  return *dirichlet_condensation_;
 }
 
 
@@ -16,6 +16,8 @@
 
 #include <Epetra_FECrsMatrix.h>
 
+#include <vector>
+
 class Epetra_CrsMatrix;
 
 FOUR_C_NAMESPACE_OPEN
@@ -289,6 +291,16 @@ namespace Core::LinAlg
     ///  manner.
     void apply_dirichlet(const Epetra_Map& dbctoggle, bool diagonalblock = true) override;
 
+    /// Apply dirichlet boundary condition to a matrix by symmetric elimination.
+    ///
+    ///  This method blanks the rows and the columns associated with Dirichlet DOFs
+    ///  and puts a 1.0 at the diagonal entry if diagonalblock==true. The matrix
+    ///  graph is never modified, i.e. the entries are set to zero in place
+    ///  independent of explicitdirichlet. The contribution of the blanked columns
+    ///  to the right hand side has to be taken into account by the caller, see
+    ///  apply_dirichlet_to_system_symmetric().
+    void apply_dirichlet_symmetric(const Epetra_Map& dbcmap, bool diagonalblock = true);
+
     /// Apply dirichlet boundary condition to a matrix using a #trafo matrix
     ///
     /// This method the same as the method #ApplyDirichlet, but instead of
@@ -364,9 +376,46 @@ namespace Core::LinAlg
     //@}
 
    private:
+    /// Dirichlet rows and entries of a matrix graph for a given Dirichlet map
+    struct DirichletCondensation
+    {
+      /// copy of the Dirichlet map the condensation was built for
+      std::shared_ptr<Epetra_Map> dbcmap;
+
+      /// copy of the matrix graph the offsets refer to (shares the graph data)
+      std::shared_ptr<Epetra_CrsGraph> graph;
+
+      /// local ids of the Dirichlet rows in ascending order
+      std::vector<int> rows;
+
+      /// offsets of the diagonal entries of the Dirichlet rows in the CRS value array (-1 if the
+      /// diagonal is not part of the graph)
+      std::vector<int> diagonal;
+
+      /// whether the column entries have been collected
+      bool symmetric = false;
+
+      /// offsets of all entries in Dirichlet columns of the free rows in the CRS value array
+      std::vector<int> column_entries;
+    };
+
+    /*!
+     \brief Get the Dirichlet rows and entries of the current matrix graph
+
+     The condensation is built once and reused as long as the Dirichlet map and the matrix graph
+     do not change, e.g. in all Newton iterations of a time step with saved graph.
+
+     \param dbcmap (in): map of the Dirichlet dofs
+     \param symmetric (in): whether the entries in the Dirichlet columns are needed as well
+     */
+    const DirichletCondensation& dirichlet_condensation(const Epetra_Map& dbcmap, bool symmetric);
+
     /// saved graph (if any)
     std::shared_ptr<Epetra_CrsGraph> graph_;
 
+    /// cached Dirichlet rows and entries (if any)
+    std::shared_ptr<DirichletCondensation> dirichlet_condensation_;
+
     /// Dirichlet row map (if known)
     std::shared_ptr<Core::LinAlg::MultiMapExtractor> dbcmaps_;
 
@@ -228,6 +228,41 @@ void Core::LinAlg::apply_dirichlet_to_system(Core::LinAlg::SparseMatrix& A,
   apply_dirichlet_to_system(x, b, dbcval, dbcmap);
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::apply_dirichlet_to_system_symmetric(Core::LinAlg::SparseMatrix& A,
+    Core::LinAlg::Vector<double>& x, Core::LinAlg::Vector<double>& b,
+    const Core::LinAlg::Vector<double>& dbcval, const Epetra_Map& dbcmap)
+{
+  if (not dbcmap.UniqueGIDs()) FOUR_C_THROW("unique map required");
+
+  // prescribed values in the layout of the matrix columns
+  Core::LinAlg::Vector<double> xdbc(A.domain_map(), true);
+  const int mylength = dbcmap.NumMyElements();
+  const int* mygids = dbcmap.MyGlobalElements();
+  for (int i = 0; i < mylength; ++i)
+  {
+    const int gid = mygids[i];
+
+    const int dbcvlid = dbcval.Map().LID(gid);
+    if (dbcvlid < 0) FOUR_C_THROW("illegal Dirichlet map");
+
+    const int xlid = A.domain_map().LID(gid);
+    if (xlid < 0) FOUR_C_THROW("illegal Dirichlet map");
+
+    xdbc[xlid] = dbcval[dbcvlid];
+  }
+
+  // move the Dirichlet columns to the right hand side
+  Core::LinAlg::Vector<double> axdbc(A.range_map(), true);
+  int err = A.multiply(false, xdbc, axdbc);
+  if (err) FOUR_C_THROW("Multiplication with prescribed values failed with err=%d", err);
+  b.Update(-1.0, axdbc, 1.0);
+
+  A.apply_dirichlet_symmetric(dbcmap);
+  apply_dirichlet_to_system(x, b, dbcval, dbcmap);
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 std::shared_ptr<Core::LinAlg::MapExtractor> Core::LinAlg::convert_dirichlet_toggle_vector_to_maps(
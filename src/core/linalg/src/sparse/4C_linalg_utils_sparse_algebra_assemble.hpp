@@ -197,6 +197,26 @@ namespace Core::LinAlg
       Core::LinAlg::Vector<double>& b, const Core::LinAlg::SparseMatrix& trafo,
       const Core::LinAlg::Vector<double>& dbcval, const Epetra_Map& dbcmap);
 
+  /*!
+   \brief Apply dirichlet boundary condition to a linear system of equations by symmetric
+   elimination
+
+   The contribution of the prescribed values to the free equations is moved to the right hand
+   side, b_f -= A_fD x_D, before the Dirichlet rows and columns of A are blanked in place. A
+   symmetric matrix stays symmetric and the matrix graph is not modified.
+
+   \param A (in/out)         : Matrix of Ax=b
+   \param x (in/out)         : vector x of Ax=b
+   \param b (in/out)         : vector b of Ax=b
+   \param dbcval (in)        : vector holding values that are supposed to be prescribed
+   \param dbcmap (in)        : unique map of all dofs that should be constrained
+
+   \pre The map dbcmap must be subset of the maps of the vectors.
+   */
+  void apply_dirichlet_to_system_symmetric(Core::LinAlg::SparseMatrix& A,
+      Core::LinAlg::Vector<double>& x, Core::LinAlg::Vector<double>& b,
+      const Core::LinAlg::Vector<double>& dbcval, const Epetra_Map& dbcmap);
+
   /*!
    \brief Apply dirichlet boundary condition to a linear system of equations
 
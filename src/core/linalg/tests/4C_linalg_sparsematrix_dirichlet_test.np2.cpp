@@ -0,0 +1,164 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linalg_sparsematrix.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_utils_sparse_algebra_assemble.hpp"
+
+#include <Epetra_Map.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  class SparseMatrixDirichletTest : public testing::Test
+  {
+   public:
+    MPI_Comm comm_;
+    std::shared_ptr<Epetra_Map> map_;
+    std::shared_ptr<Epetra_Map> dbcmap_;
+    int NumGlobalElements = 10;
+
+   protected:
+    SparseMatrixDirichletTest()
+    {
+      comm_ = MPI_COMM_WORLD;
+      map_ = std::make_shared<Epetra_Map>(
+          NumGlobalElements, 0, Core::Communication::as_epetra_comm(comm_));
+
+      // constrain both ends and one dof in the interior
+      std::vector<int> dbcgids;
+      for (int gid : {0, 4, NumGlobalElements - 1})
+        if (map_->MyGID(gid)) dbcgids.push_back(gid);
+      dbcmap_ = std::make_shared<Epetra_Map>(-1, static_cast<int>(dbcgids.size()), dbcgids.data(),
+          0, Core::Communication::as_epetra_comm(comm_));
+    }
+
+    //! assemble the [-1 2 -1] tri-diagonal matrix of a 1d poisson problem
+    void assemble_poisson(Core::LinAlg::SparseMatrix& A) const
+    {
+      for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+      {
+        const int gid = map_->GID(lid);
+        A.assemble(2.0, gid, gid);
+        if (gid > 0) A.assemble(-1.0, gid, gid - 1);
+        if (gid < NumGlobalElements - 1) A.assemble(-1.0, gid, gid + 1);
+      }
+      A.complete();
+    }
+
+    std::shared_ptr<Core::LinAlg::SparseMatrix> poisson_matrix(bool explicitdirichlet) const
+    {
+      auto A = std::make_shared<Core::LinAlg::SparseMatrix>(*map_, 3, explicitdirichlet, true);
+      assemble_poisson(*A);
+      return A;
+    }
+
+    //! global value of the matrix, zero if the entry is not part of the graph
+    static double entry(const Core::LinAlg::SparseMatrix& A, int rgid, int cgid)
+    {
+      int numentries;
+      std::vector<double> values(A.max_num_entries());
+      std::vector<int> indices(A.max_num_entries());
+      A.epetra_matrix()->ExtractGlobalRowCopy(
+          rgid, A.max_num_entries(), numentries, values.data(), indices.data());
+      for (int j = 0; j < numentries; ++j)
+        if (indices[j] == cgid) return values[j];
+      return 0.0;
+    }
+  };
+
+  TEST_F(SparseMatrixDirichletTest, ApplyDirichletRows)
+  {
+    for (bool explicitdirichlet : {false, true})
+    {
+      auto A = poisson_matrix(explicitdirichlet);
+
+      // the second application reuses the cached Dirichlet rows of the saved graph
+      for (int call = 0; call < 2; ++call)
+      {
+        if (call > 0)
+        {
+          A->zero();
+          assemble_poisson(*A);
+        }
+        A->apply_dirichlet(*dbcmap_, true);
+
+        for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+        {
+          const int gid = map_->GID(lid);
+          if (dbcmap_->MyGID(gid))
+          {
+            EXPECT_DOUBLE_EQ(entry(*A, gid, gid), 1.0);
+            if (gid > 0) EXPECT_DOUBLE_EQ(entry(*A, gid, gid - 1), 0.0);
+            if (gid < NumGlobalElements - 1) EXPECT_DOUBLE_EQ(entry(*A, gid, gid + 1), 0.0);
+          }
+          else
+          {
+            EXPECT_DOUBLE_EQ(entry(*A, gid, gid), 2.0);
+            if (gid > 0) EXPECT_DOUBLE_EQ(entry(*A, gid, gid - 1), -1.0);
+          }
+        }
+      }
+    }
+  }
+
+  TEST_F(SparseMatrixDirichletTest, ApplyDirichletSymmetric)
+  {
+    const std::vector<int> dbcgids = {0, 4, NumGlobalElements - 1};
+
+    auto A = poisson_matrix(false);
+    A->apply_dirichlet_symmetric(*dbcmap_, true);
+    // a second application does not change the result
+    A->apply_dirichlet_symmetric(*dbcmap_, true);
+
+    for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+    {
+      const int gid = map_->GID(lid);
+      const bool isdbcrow = std::find(dbcgids.begin(), dbcgids.end(), gid) != dbcgids.end();
+      EXPECT_DOUBLE_EQ(entry(*A, gid, gid), isdbcrow ? 1.0 : 2.0);
+      for (int cgid : {gid - 1, gid + 1})
+      {
+        if (cgid < 0 or cgid >= NumGlobalElements) continue;
+        const bool isdbccol = std::find(dbcgids.begin(), dbcgids.end(), cgid) != dbcgids.end();
+        EXPECT_DOUBLE_EQ(entry(*A, gid, cgid), (isdbcrow or isdbccol) ? 0.0 : -1.0);
+      }
+    }
+  }
+
+  TEST_F(SparseMatrixDirichletTest, ApplyDirichletToSystemSymmetric)
+  {
+    // prescribe x = 1 at the Dirichlet dofs, the solution of the homogeneous problem is then
+    // constant and the right hand side has to be consistent with it
+    auto A = poisson_matrix(false);
+    Core::LinAlg::Vector<double> x(*map_, true);
+    Core::LinAlg::Vector<double> b(*map_, true);
+    Core::LinAlg::Vector<double> dbcval(*map_, true);
+    dbcval.PutScalar(1.0);
+
+    Core::LinAlg::apply_dirichlet_to_system_symmetric(*A, x, b, dbcval, *dbcmap_);
+
+    Core::LinAlg::Vector<double> ones(*map_, true);
+    ones.PutScalar(1.0);
+    Core::LinAlg::Vector<double> residual(*map_, true);
+    A->multiply(false, ones, residual);
+    residual.Update(-1.0, b, 1.0);
+
+    double norm = 0.0;
+    residual.Norm2(&norm);
+    EXPECT_NEAR(norm, 0.0, 1e-14);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -15,14 +15,61 @@
 #include <Amesos_Umfpack.h>
 #include <Epetra_LinearProblem.h>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! whether two matrices have the same row and column maps and the same local pattern
+  bool has_same_pattern(const Epetra_CrsMatrix& a, const Epetra_CrsMatrix& b)
+  {
+    int same = 1;
+    if (a.Graph().DataPtr() != b.Graph().DataPtr())
+    {
+      if (not a.RowMap().SameAs(b.RowMap()) or not a.ColMap().SameAs(b.ColMap())) return false;
+
+      same = a.NumMyRows() == b.NumMyRows() and a.NumMyNonzeros() == b.NumMyNonzeros();
+      for (int row = 0; same and row < a.NumMyRows(); ++row)
+      {
+        int numa, numb;
+        int *indicesa, *indicesb;
+        a.Graph().ExtractMyRowView(row, numa, indicesa);
+        b.Graph().ExtractMyRowView(row, numb, indicesb);
+        same = numa == numb and std::equal(indicesa, indicesa + numa, indicesb);
+      }
+    }
+
+    int allsame = 0;
+    a.Comm().MinAll(&same, &allsame, 1);
+    return allsame == 1;
+  }
+
+  //! copy the values of @p source into @p target with the same pattern
+  void copy_values(const Epetra_CrsMatrix& source, Epetra_CrsMatrix& target)
+  {
+    for (int row = 0; row < source.NumMyRows(); ++row)
+    {
+      int num;
+      double *sourcevalues, *targetvalues;
+      int* indices;
+      source.ExtractMyRowView(row, num, sourcevalues, indices);
+      target.ExtractMyRowView(row, num, targetvalues, indices);
+      std::copy(sourcevalues, sourcevalues + num, targetvalues);
+    }
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 template <class MatrixType, class VectorType>
-Core::LinearSolver::DirectSolver<MatrixType, VectorType>::DirectSolver(std::string solvertype)
+Core::LinearSolver::DirectSolver<MatrixType, VectorType>::DirectSolver(
+    std::string solvertype, bool reuse_symbolic_factorization)
     : solvertype_(solvertype),
       factored_(false),
+      reuse_symbolic_(reuse_symbolic_factorization),
+      symbolic_factored_(false),
+      num_symbolic_factorizations_(0),
       solver_(nullptr),
       reindexer_(nullptr),
       projector_(nullptr)
@@ -69,14 +116,34 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
   b_ = b;
   a_ = crsA;
 
-  // 3. Do a GID reindexing of the overall problem and create the direct solver
+  // 3. With the same sparsity pattern as before, the values are copied into the factored matrix
+  // and only a numeric factorization is necessary
+  bool numeric_only = false;
+  if (reuse_symbolic_ and projector_ == nullptr)
+  {
+    numeric_only = refactor and not reset and solver_ != nullptr and symbolic_matrix_ != nullptr and
+                   has_same_pattern(*crsA, *symbolic_matrix_);
+    if (numeric_only)
+      copy_values(*crsA, *symbolic_matrix_);
+    else if (reset or refactor or not is_factored())
+      symbolic_matrix_ = std::make_shared<Epetra_CrsMatrix>(*crsA);
+    a_ = symbolic_matrix_;
+  }
+  else
+    symbolic_matrix_ = nullptr;
+
+  // 4. Do a GID reindexing of the overall problem and create the direct solver
   linear_problem_->SetRHS(b_->get_ptr_of_Epetra_MultiVector().get());
   linear_problem_->SetLHS(x_->get_ptr_of_Epetra_MultiVector().get());
   linear_problem_->SetOperator(a_.get());
 
-  if (reindexer_ and not(reset or refactor)) reindexer_->fwd();
+  if (reindexer_ and (numeric_only or not(reset or refactor))) reindexer_->fwd();
 
-  if (reset or refactor or not is_factored())
+  if (numeric_only)
+  {
+    factored_ = false;
+  }
+  else if (reset or refactor or not is_factored())
   {
     reindexer_ = std::make_shared<EpetraExt::LinearProblem_Reindex2>(nullptr);
 
@@ -94,6 +161,7 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
     }
 
     factored_ = false;
+    symbolic_factored_ = false;
   }
 }
 
@@ -104,7 +172,12 @@ int Core::LinearSolver::DirectSolver<MatrixType, VectorType>::solve()
 {
   if (not is_factored())
   {
-    solver_->SymbolicFactorization();
+    if (not symbolic_factored_)
+    {
+      solver_->SymbolicFactorization();
+      symbolic_factored_ = true;
+      ++num_symbolic_factorizations_;
+    }
     solver_->NumericFactorization();
     factored_ = true;
   }
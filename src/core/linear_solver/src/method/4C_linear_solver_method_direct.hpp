@@ -13,6 +13,7 @@
 #include "4C_linear_solver_method.hpp"
 
 #include <Amesos_BaseSolver.h>
+#include <Epetra_CrsMatrix.h>
 #include <EpetraExt_Reindex_LinearProblem2.h>
 
 FOUR_C_NAMESPACE_OPEN
@@ -24,8 +25,14 @@ namespace Core::LinearSolver
   class DirectSolver : public SolverTypeBase<MatrixType, VectorType>
   {
    public:
-    //! Constructor
-    explicit DirectSolver(std::string solvertype);
+    /*! \brief Constructor
+     *
+     * @param solvertype Type of the Amesos solver
+     * @param reuse_symbolic_factorization If true, a matrix with the same sparsity pattern as the
+     * factored matrix is only factored numerically on refactor (unless reset is requested). The
+     * solver keeps a copy of the factored matrix for this purpose.
+     */
+    explicit DirectSolver(std::string solvertype, bool reuse_symbolic_factorization = false);
 
     /*! \brief Setup the solver object
      *
@@ -45,6 +52,9 @@ namespace Core::LinearSolver
 
     bool is_factored() { return factored_; }
 
+    //! number of symbolic factorizations done so far
+    int num_symbolic_factorizations() const { return num_symbolic_factorizations_; }
+
    private:
     //! type/implementation of Amesos solver to be used
     const std::string solvertype_;
@@ -52,6 +62,18 @@ namespace Core::LinearSolver
     //! flag indicating whether a valid factorization is stored
     bool factored_;
 
+    //! reuse the symbolic factorization for matrices with the same sparsity pattern
+    const bool reuse_symbolic_;
+
+    //! flag indicating whether a valid symbolic factorization is stored
+    bool symbolic_factored_;
+
+    //! number of symbolic factorizations done so far
+    int num_symbolic_factorizations_;
+
+    //! copy of the factored matrix, the values are replaced on numeric refactorization
+    std::shared_ptr<Epetra_CrsMatrix> symbolic_matrix_;
+
     //! a linear problem wrapper class used by Trilinos and for scaling of the system
     std::shared_ptr<Epetra_LinearProblem> linear_problem_;
 
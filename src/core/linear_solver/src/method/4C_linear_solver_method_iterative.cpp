@@ -13,6 +13,7 @@
 #include "4C_linear_solver_preconditioner_muelu.hpp"
 #include "4C_linear_solver_preconditioner_teko.hpp"
 #include "4C_utils_exceptions.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <BelosBiCGStabSolMgr.hpp>
 #include <BelosBlockCGSolMgr.hpp>
@@ -31,6 +32,46 @@ FOUR_C_NAMESPACE_OPEN
 
 using BelosVectorType = Epetra_MultiVector;
 
+namespace
+{
+  /*!
+   * \brief Create a Belos solver manager
+   *
+   * Block solvers build one Krylov space for all right hand sides, pseudo-block solvers iterate
+   * the right hand sides independently.
+   */
+  template <class MatrixType>
+  std::shared_ptr<Belos::SolverManager<double, BelosVectorType, MatrixType>> create_solver_manager(
+      const std::string& solverType, const bool blockKrylov,
+      const Teuchos::RCP<Belos::LinearProblem<double, BelosVectorType, MatrixType>>& problem,
+      const Teuchos::RCP<Teuchos::ParameterList>& belosSolverList)
+  {
+    if (solverType == "GMRES")
+    {
+      if (blockKrylov)
+        return std::make_shared<Belos::BlockGmresSolMgr<double, BelosVectorType, MatrixType>>(
+            problem, belosSolverList);
+      return std::make_shared<Belos::PseudoBlockGmresSolMgr<double, BelosVectorType, MatrixType>>(
+          problem, belosSolverList);
+    }
+    else if (solverType == "CG")
+    {
+      if (blockKrylov)
+        return std::make_shared<Belos::BlockCGSolMgr<double, BelosVectorType, MatrixType>>(
+            problem, belosSolverList);
+      return std::make_shared<Belos::PseudoBlockCGSolMgr<double, BelosVectorType, MatrixType>>(
+          problem, belosSolverList);
+    }
+    else if (solverType == "BiCGSTAB")
+    {
+      return std::make_shared<Belos::BiCGStabSolMgr<double, BelosVectorType, MatrixType>>(
+          problem, belosSolverList);
+    }
+
+    FOUR_C_THROW("Core::LinearSolver::BelosSolver: Unknown iterative solver solver type chosen.");
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 template <class MatrixType, class VectorType>
@@ -87,7 +128,11 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
   if (set == false)
     FOUR_C_THROW("Core::LinearSolver::BelosSolver: Iterative solver failed to set up correctly.");
 
-  std::shared_ptr<Belos::SolverManager<double, BelosVectorType, MatrixType>> newSolver;
+  const int num_rhs = b_->NumVectors();
+
+  std::string solverType;
+  Teuchos::RCP<Teuchos::ParameterList> belosSolverList;
+  bool blockKrylov = false;
 
   if (belist.isParameter("SOLVER_XML_FILE"))
   {
@@ -97,42 +142,25 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
         Teuchos::Ptr<Teuchos::ParameterList>(&belosParams),
         *Xpetra::toXpetra(Core::Communication::as_epetra_comm(comm_)));
 
-    if (belosParams.isSublist("GMRES"))
+    for (const std::string type : {"GMRES", "CG", "BiCGSTAB"})
     {
-      auto belosSolverList = rcpFromRef(belosParams.sublist("GMRES"));
-      if (belist.isParameter("Convergence Tolerance"))
+      if (belosParams.isSublist(type))
       {
-        belosSolverList->set("Convergence Tolerance", belist.get<double>("Convergence Tolerance"));
+        solverType = type;
+        break;
       }
-
-      newSolver =
-          std::make_shared<Belos::PseudoBlockGmresSolMgr<double, BelosVectorType, MatrixType>>(
-              problem, belosSolverList);
     }
-    else if (belosParams.isSublist("CG"))
-    {
-      auto belosSolverList = rcpFromRef(belosParams.sublist("CG"));
-      if (belist.isParameter("Convergence Tolerance"))
-      {
-        belosSolverList->set("Convergence Tolerance", belist.get<double>("Convergence Tolerance"));
-      }
+    if (solverType.empty())
+      FOUR_C_THROW("Core::LinearSolver::BelosSolver: Unknown iterative solver solver type chosen.");
 
-      newSolver = std::make_shared<Belos::PseudoBlockCGSolMgr<double, BelosVectorType, MatrixType>>(
-          problem, belosSolverList);
-    }
-    else if (belosParams.isSublist("BiCGSTAB"))
+    belosSolverList = Teuchos::make_rcp<Teuchos::ParameterList>(belosParams.sublist(solverType));
+    if (belist.isParameter("Convergence Tolerance"))
     {
-      auto belosSolverList = rcpFromRef(belosParams.sublist("BiCGSTAB"));
-      if (belist.isParameter("Convergence Tolerance"))
-      {
-        belosSolverList->set("Convergence Tolerance", belist.get<double>("Convergence Tolerance"));
-      }
-
-      newSolver = std::make_shared<Belos::BiCGStabSolMgr<double, BelosVectorType, MatrixType>>(
-          problem, belosSolverList);
+      belosSolverList->set("Convergence Tolerance", belist.get<double>("Convergence Tolerance"));
     }
-    else
-      FOUR_C_THROW("Core::LinearSolver::BelosSolver: Unknown iterative solver solver type chosen.");
+
+    // a single right hand side is solved by the pseudo-block variants
+    blockKrylov = num_rhs > 1;
   }
   else
   {
@@ -141,21 +169,46 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
                    "depreciated soon. Switch to an appropriate xml-file version."
                 << std::endl;
 
-    std::string solverType = belist.get<std::string>("Solver Type");
-    if (solverType == "GMRES")
-      newSolver = std::make_shared<Belos::BlockGmresSolMgr<double, BelosVectorType, MatrixType>>(
-          problem, Teuchos::rcpFromRef(belist));
-    else if (solverType == "CG")
-      newSolver = std::make_shared<Belos::BlockCGSolMgr<double, BelosVectorType, MatrixType>>(
-          problem, Teuchos::rcpFromRef(belist));
-    else if (solverType == "BiCGSTAB")
-      newSolver = std::make_shared<Belos::BiCGStabSolMgr<double, BelosVectorType, MatrixType>>(
-          problem, Teuchos::rcpFromRef(belist));
-    else
-      FOUR_C_THROW("Core::LinearSolver::BelosSolver: Unknown iterative solver solver type chosen.");
+    solverType = belist.get<std::string>("Solver Type");
+    belosSolverList = Teuchos::make_rcp<Teuchos::ParameterList>(belist);
+    blockKrylov = true;
+  }
+
+  // all right hand sides span one Krylov space, i.e. the operator and the preconditioner are
+  // applied to all columns at once
+  if (solverType == "BiCGSTAB") blockKrylov = false;
+  if (blockKrylov) belosSolverList->set("Block Size", num_rhs);
+
+  std::shared_ptr<Belos::SolverManager<double, BelosVectorType, MatrixType>> newSolver =
+      create_solver_manager<MatrixType>(solverType, blockKrylov, problem, belosSolverList);
+
+  Belos::ReturnType ret = Belos::Unconverged;
+  try
+  {
+    ret = newSolver->solve();
   }
+  catch (const Belos::BelosError&)
+  {
+    // block methods break down if the block of search directions becomes rank deficient
+    if (not(blockKrylov and num_rhs > 1)) throw;
+  }
+  numiters_ = newSolver->getNumIters();
 
-  Belos::ReturnType ret = newSolver->solve();
+  // fallback for several right hand sides: continue from the current iterate and iterate the
+  // right hand sides independently
+  if (blockKrylov and num_rhs > 1 and ret != Belos::Converged)
+  {
+    if (Core::Communication::my_mpi_rank(comm_) == 0)
+      std::cout << "Core::LinearSolver::BelosSolver: block Krylov solver did not converge, "
+                   "continuing with independent right hand sides."
+                << std::endl;
+
+    belosSolverList->remove("Block Size");
+    problem->setProblem();
+    newSolver = create_solver_manager<MatrixType>(solverType, false, problem, belosSolverList);
+    ret = newSolver->solve();
+    numiters_ += newSolver->getNumIters();
+  }
 
   int my_error = 0;
   if (ret != Belos::Converged) my_error = 1;
@@ -167,7 +220,7 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
               << "Core::LinearSolver::BelosSolver: WARNING: Iterative solver did not converge!"
               << std::endl;
 
-  numiters_ = newSolver->getNumIters();
+  Core::Utils::Profiling::add_counter("Krylov iterations", numiters_);
 
   ncall_ += 1;
 
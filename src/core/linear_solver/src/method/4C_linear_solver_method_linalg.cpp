@@ -13,6 +13,7 @@
 #include "4C_linear_solver_method_direct.hpp"
 #include "4C_linear_solver_method_iterative.hpp"
 #include "4C_utils_parameter_list.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <BelosTypes.hpp>  // for Belos verbosity codes
 #include <Epetra_LinearProblem.h>
@@ -189,7 +190,7 @@ void Core::LinAlg::Solver::setup(std::shared_ptr<Epetra_Operator> matrix,
     {
       solver_ = std::make_shared<
           Core::LinearSolver::DirectSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>>(
-          solvertype);
+          solvertype, Solver::params().get("reuse symbolic factorization", false));
     }
     else
       FOUR_C_THROW("Unknown type of solver");
@@ -205,6 +206,8 @@ int Core::LinAlg::Solver::solve_with_multi_vector(std::shared_ptr<Epetra_Operato
     std::shared_ptr<Core::LinAlg::MultiVector<double>> x,
     std::shared_ptr<Core::LinAlg::MultiVector<double>> b, const Core::LinAlg::SolverParams& params)
 {
+  FOUR_C_PROFILE_REGION("Core::LinAlg::Solver::solve");
+
   setup(matrix, x, b, params);
 
   int error_value = 0;
@@ -220,6 +223,8 @@ int Core::LinAlg::Solver::solve(std::shared_ptr<Epetra_Operator> matrix,
     std::shared_ptr<Core::LinAlg::Vector<double>> x,
     std::shared_ptr<Core::LinAlg::Vector<double>> b, const SolverParams& params)
 {
+  FOUR_C_PROFILE_REGION("Core::LinAlg::Solver::solve");
+
   setup(matrix, x->get_ptr_of_MultiVector(), b->get_ptr_of_MultiVector(), params);
 
   int error_value = 0;
@@ -0,0 +1,141 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_method_direct.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_multi_vector.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  using DirectSolver =
+      Core::LinearSolver::DirectSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+
+  class DirectSolverTest : public testing::Test
+  {
+   protected:
+    DirectSolverTest()
+        : map_(std::make_shared<Epetra_Map>(
+              num_rows_, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD))),
+          x_(std::make_shared<Core::LinAlg::MultiVector<double>>(*map_, 1, true)),
+          b_(std::make_shared<Core::LinAlg::MultiVector<double>>(*map_, 1, true))
+    {
+      b_->PutScalar(1.0);
+    }
+
+    /*!
+     * tridiagonal matrix with the given diagonal value, optionally with an additional coupling of
+     * every row to the first row, i.e. a different sparsity pattern
+     */
+    std::shared_ptr<Epetra_CrsMatrix> create_matrix(double diagonal, bool couple_to_first) const
+    {
+      auto matrix = std::make_shared<Epetra_CrsMatrix>(Copy, *map_, 4);
+      for (int lid = 0; lid < map_->NumMyElements(); ++lid)
+      {
+        const int row = map_->GID(lid);
+        std::vector<int> cols = {row};
+        std::vector<double> values = {diagonal};
+        if (row > 0)
+        {
+          cols.push_back(row - 1);
+          values.push_back(-1.0);
+        }
+        if (row < num_rows_ - 1)
+        {
+          cols.push_back(row + 1);
+          values.push_back(-1.0);
+        }
+        if (couple_to_first and row > 1)
+        {
+          cols.push_back(0);
+          values.push_back(-0.5);
+        }
+        matrix->InsertGlobalValues(row, static_cast<int>(cols.size()), values.data(), cols.data());
+      }
+      matrix->FillComplete();
+      return matrix;
+    }
+
+    //! solve A x = b and check the residual
+    void solve_and_check(DirectSolver& solver, const std::shared_ptr<Epetra_CrsMatrix>& matrix,
+        bool refactor, bool reset)
+    {
+      x_->PutScalar(0.0);
+      solver.setup(matrix, x_, b_, refactor, reset);
+      solver.solve();
+
+      Core::LinAlg::MultiVector<double> residual(*map_, 1, true);
+      matrix->Multiply(false, *x_, residual);
+      residual.Update(-1.0, *b_, 1.0);
+      double norm = 0.0;
+      residual.Norm2(&norm);
+      EXPECT_LT(norm, 1e-12);
+    }
+
+    static constexpr int num_rows_ = 20;
+
+    std::shared_ptr<Epetra_Map> map_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> x_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> b_;
+  };
+
+  TEST_F(DirectSolverTest, NumericRefactorizationForSamePattern)
+  {
+    DirectSolver solver("klu", true);
+
+    solve_and_check(solver, create_matrix(4.0, false), true, false);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 1);
+
+    // new values on the same pattern (a different matrix object) are only factored numerically
+    solve_and_check(solver, create_matrix(3.0, false), true, false);
+    solve_and_check(solver, create_matrix(5.0, false), true, false);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 1);
+  }
+
+  TEST_F(DirectSolverTest, FullFactorizationForDifferentPattern)
+  {
+    DirectSolver solver("klu", true);
+
+    solve_and_check(solver, create_matrix(4.0, false), true, false);
+    solve_and_check(solver, create_matrix(4.0, true), true, false);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 2);
+
+    // and the new pattern is reused afterwards
+    solve_and_check(solver, create_matrix(6.0, true), true, false);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 2);
+  }
+
+  TEST_F(DirectSolverTest, FullFactorizationOnReset)
+  {
+    DirectSolver solver("klu", true);
+
+    solve_and_check(solver, create_matrix(4.0, false), true, false);
+    solve_and_check(solver, create_matrix(3.0, false), true, true);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 2);
+  }
+
+  TEST_F(DirectSolverTest, FullFactorizationWithoutReuse)
+  {
+    DirectSolver solver("klu");
+
+    solve_and_check(solver, create_matrix(4.0, false), true, false);
+    solve_and_check(solver, create_matrix(3.0, false), true, false);
+    EXPECT_EQ(solver.num_symbolic_factorizations(), 2);
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
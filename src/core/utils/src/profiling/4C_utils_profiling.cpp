@@ -0,0 +1,400 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_utils_profiling.hpp"
+
+#include "4C_utils_exceptions.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+bool Core::Utils::Profiling::Internal::enabled = false;
+
+namespace
+{
+  //! A completed region
+  struct Event
+  {
+    const char* name;
+    std::string path;
+    int step;
+    double begin;
+    double duration;
+  };
+
+  //! A region that has not been completed yet
+  struct OpenRegion
+  {
+    const char* name;
+    std::string path;
+    double begin;
+    bool recorded;
+  };
+
+  //! Counters and memory usage at the end of a step
+  struct Sample
+  {
+    double time;
+    int step;
+    std::map<std::string, double> counters;
+    double memory_high_water_mark;
+    double memory_resident;
+  };
+
+  //! Number of buffered events after which the events and samples are appended to the trace file
+  constexpr std::size_t max_buffered_events = 1 << 14;
+
+  //! Data recorded on this rank
+  struct State
+  {
+    MPI_Comm comm = MPI_COMM_NULL;
+    std::string file_prefix;
+    int max_depth = -1;
+    std::chrono::steady_clock::time_point start;
+
+    //! trace file of this rank
+    std::ofstream trace;
+    int rank = 0;
+
+    std::vector<OpenRegion> stack;
+
+    //! events and samples not yet written to the trace file
+    std::vector<Event> events;
+    std::vector<Sample> samples;
+
+    //! counters of the current step
+    std::map<std::string, double> counters;
+
+    //! current step (-1 outside of steps)
+    int step = -1;
+    double step_begin = 0.0;
+
+    //! accumulated time of all recorded regions per hierarchical name
+    std::map<std::string, double> region_times;
+  };
+
+  State& state()
+  {
+    static State state;
+    return state;
+  }
+
+  //! time since enabling the profiler in microseconds
+  double elapsed()
+  {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - state().start)
+        .count();
+  }
+
+  //! memory high water mark and resident set size of this process in MB (-1 if not available)
+  void memory_usage(double& high_water_mark, double& resident)
+  {
+    high_water_mark = -1.0;
+    resident = -1.0;
+#if defined(__linux__)
+    std::ifstream status_file("/proc/self/status");
+    std::string line;
+    while (std::getline(status_file, line))
+    {
+      const bool hwm = line.rfind("VmHWM:", 0) == 0;
+      const bool rss = line.rfind("VmRSS:", 0) == 0;
+      if (not hwm and not rss) continue;
+
+      double kb = 0.0;
+      std::stringstream(line.substr(6)) >> kb;
+      (hwm ? high_water_mark : resident) = kb / 1024.0;
+    }
+#endif
+  }
+
+  //! write a string as JSON string literal
+  void write_json_string(std::ostream& out, const std::string& str)
+  {
+    out << '"';
+    for (const char c : str)
+    {
+      if (c == '"' or c == '\\')
+        out << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+        out << ' ';
+      else
+        out << c;
+    }
+    out << '"';
+  }
+
+  //! open the trace of this rank in the Chrome trace event format and write its header
+  void open_trace(State& state)
+  {
+    std::ostringstream file_name;
+    file_name << state.file_prefix << ".rank" << state.rank << ".trace.json";
+    state.trace.open(file_name.str());
+    if (not state.trace.good())
+      FOUR_C_THROW("Could not open trace file %s.", file_name.str().c_str());
+
+    std::ofstream& out = state.trace;
+    const int rank = state.rank;
+    out << std::setprecision(15);
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+        << ",\"args\":{\"name\":\"rank " << rank << "\"}},\n";
+    out << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << rank
+        << ",\"args\":{\"sort_index\":" << rank << "}}";
+  }
+
+  //! append the buffered events and samples to the trace and clear the buffers
+  void flush_trace(State& state)
+  {
+    std::ofstream& out = state.trace;
+    const int rank = state.rank;
+
+    for (const Event& event : state.events)
+    {
+      out << ",\n{\"name\":";
+      write_json_string(out, event.name);
+      out << ",\"cat\":\"" << (event.step >= 0 ? "step" : "setup") << "\",\"ph\":\"X\",\"ts\":"
+          << event.begin << ",\"dur\":" << event.duration << ",\"pid\":" << rank
+          << ",\"tid\":0,\"args\":{\"path\":";
+      write_json_string(out, event.path);
+      out << ",\"step\":" << event.step << "}}";
+    }
+
+    for (const Sample& sample : state.samples)
+    {
+      if (not sample.counters.empty())
+      {
+        out << ",\n{\"name\":\"counters\",\"ph\":\"C\",\"ts\":" << sample.time
+            << ",\"pid\":" << rank << ",\"args\":{";
+        bool first = true;
+        for (const auto& [name, value] : sample.counters)
+        {
+          if (not first) out << ",";
+          first = false;
+          write_json_string(out, name);
+          out << ":" << value;
+        }
+        out << "}}";
+      }
+      if (sample.memory_high_water_mark >= 0.0)
+      {
+        out << ",\n{\"name\":\"memory [MB]\",\"ph\":\"C\",\"ts\":" << sample.time
+            << ",\"pid\":" << rank << ",\"args\":{\"high water mark\":"
+            << sample.memory_high_water_mark << ",\"resident\":" << sample.memory_resident << "}}";
+      }
+    }
+
+    state.events.clear();
+    state.samples.clear();
+  }
+
+  //! write the remaining events and samples and close the trace
+  void close_trace(State& state, int num_ranks)
+  {
+    flush_trace(state);
+
+    std::ofstream& out = state.trace;
+    const int rank = state.rank;
+    out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"rank\":" << rank
+        << ",\"num_ranks\":" << num_ranks << "}}\n";
+    out.close();
+  }
+
+  //! print minimum, mean and maximum time over the ranks of the regions known on rank 0
+  void print_summary(const State& state, int rank, int num_ranks)
+  {
+    // broadcast the names of the regions of rank 0
+    std::string names;
+    if (rank == 0)
+      for (const auto& [path, time] : state.region_times) names += path + '\n';
+    int length = static_cast<int>(names.size());
+    MPI_Bcast(&length, 1, MPI_INT, 0, state.comm);
+    names.resize(length);
+    MPI_Bcast(names.data(), length, MPI_CHAR, 0, state.comm);
+
+    std::vector<std::string> paths;
+    {
+      std::istringstream stream(names);
+      std::string path;
+      while (std::getline(stream, path)) paths.push_back(path);
+    }
+
+    std::vector<double> times(paths.size(), 0.0);
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+      auto it = state.region_times.find(paths[i]);
+      if (it != state.region_times.end()) times[i] = it->second * 1.0e-6;
+    }
+
+    const int num = static_cast<int>(times.size());
+    std::vector<double> min_times(num), max_times(num), sum_times(num);
+    MPI_Reduce(times.data(), min_times.data(), num, MPI_DOUBLE, MPI_MIN, 0, state.comm);
+    MPI_Reduce(times.data(), max_times.data(), num, MPI_DOUBLE, MPI_MAX, 0, state.comm);
+    MPI_Reduce(times.data(), sum_times.data(), num, MPI_DOUBLE, MPI_SUM, 0, state.comm);
+
+    if (rank != 0 or num == 0) return;
+
+    // regions sorted by their maximum time over the ranks
+    std::vector<int> order(num);
+    for (int i = 0; i < num; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(),
+        [&](int a, int b) { return max_times[a] > max_times[b]; });
+
+    constexpr int max_lines = 30;
+    std::cout << "\nProfiling summary (time in s, imbalance = max / mean over " << num_ranks
+              << " ranks)\n"
+              << std::setw(12) << "min" << std::setw(12) << "mean" << std::setw(12) << "max"
+              << std::setw(12) << "imbalance"
+              << "  region\n";
+    for (int k = 0; k < std::min(num, max_lines); ++k)
+    {
+      const int i = order[k];
+      const double mean = sum_times[i] / num_ranks;
+      std::cout << std::scientific << std::setprecision(3) << std::setw(12) << min_times[i]
+                << std::setw(12) << mean << std::setw(12) << max_times[i] << std::fixed
+                << std::setprecision(2) << std::setw(12) << (mean > 0.0 ? max_times[i] / mean : 1.0)
+                << "  " << paths[i] << "\n";
+    }
+    std::cout << "Traces written to " << state.file_prefix << ".rank*.trace.json\n" << std::endl;
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::enable(MPI_Comm comm, const std::string& file_prefix, int max_depth)
+{
+  State& s = state();
+  s = State();
+  s.comm = comm;
+  s.file_prefix = file_prefix;
+  s.max_depth = max_depth;
+  MPI_Comm_rank(comm, &s.rank);
+  open_trace(s);
+
+  // align the time origin of the ranks
+  MPI_Barrier(comm);
+  s.start = std::chrono::steady_clock::now();
+
+  Internal::enabled = true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::Internal::begin_region(const char* name)
+{
+  State& s = state();
+
+  OpenRegion region{name, "", 0.0, false};
+  const int depth = static_cast<int>(s.stack.size());
+  region.recorded =
+      (s.max_depth < 0 or depth < s.max_depth) and (depth == 0 or s.stack.back().recorded);
+  if (region.recorded)
+  {
+    region.path = depth == 0 ? std::string(name) : s.stack.back().path + '/' + name;
+    region.begin = elapsed();
+  }
+  s.stack.emplace_back(std::move(region));
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::Internal::end_region()
+{
+  State& s = state();
+
+  // the profiler has been finalized while the region was open
+  if (s.stack.empty()) return;
+
+  OpenRegion& region = s.stack.back();
+  if (region.recorded)
+  {
+    const double duration = elapsed() - region.begin;
+    s.region_times[region.path] += duration;
+    s.events.emplace_back(
+        Event{region.name, std::move(region.path), s.step, region.begin, duration});
+  }
+  s.stack.pop_back();
+
+  if (s.events.size() >= max_buffered_events) flush_trace(s);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::begin_step(int step)
+{
+  if (not is_enabled()) return;
+
+  State& s = state();
+  if (s.step >= 0) end_step();
+  s.step = step;
+  s.step_begin = elapsed();
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::end_step()
+{
+  if (not is_enabled()) return;
+
+  State& s = state();
+  if (s.step < 0) return;
+
+  const double time = elapsed();
+  s.events.emplace_back(Event{"step", "step", s.step, s.step_begin, time - s.step_begin});
+
+  Sample sample{time, s.step, std::move(s.counters), -1.0, -1.0};
+  memory_usage(sample.memory_high_water_mark, sample.memory_resident);
+  s.samples.emplace_back(std::move(sample));
+
+  s.counters.clear();
+  s.step = -1;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::Internal::add_counter(const char* name, double value)
+{
+  state().counters[name] += value;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::Utils::Profiling::finalize()
+{
+  if (not is_enabled()) return;
+
+  end_step();
+  Internal::enabled = false;
+
+  State& s = state();
+
+  // counters outside of steps are recorded at the end
+  if (not s.counters.empty())
+  {
+    Sample sample{elapsed(), -1, std::move(s.counters), -1.0, -1.0};
+    memory_usage(sample.memory_high_water_mark, sample.memory_resident);
+    s.samples.emplace_back(std::move(sample));
+  }
+
+  int num_ranks = 1;
+  MPI_Comm_size(s.comm, &num_ranks);
+
+  close_trace(s, num_ranks);
+  print_summary(s, s.rank, num_ranks);
+
+  s = State();
+}
+
+FOUR_C_NAMESPACE_CLOSE
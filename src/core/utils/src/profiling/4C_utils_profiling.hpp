@@ -0,0 +1,144 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_UTILS_PROFILING_HPP
+#define FOUR_C_UTILS_PROFILING_HPP
+
+#include "4C_config.hpp"
+
+#include <mpi.h>
+
+#include <string>
+
+FOUR_C_NAMESPACE_OPEN
+
+/**
+ * @brief Instrumentation of a simulation with scoped regions, counters and memory samples.
+ *
+ * The profiler records nested regions with hierarchical names, accumulates named counters (e.g.
+ * evaluated elements or Krylov iterations) and samples the memory high water mark at the end of
+ * every step. Every rank writes its own trace in the Chrome trace event format, which can be
+ * loaded (for several ranks at once) into chrome://tracing or https://ui.perfetto.dev. In
+ * contrast to the Teuchos::TimeMonitor summary, the traces show the evolution over the steps and
+ * the imbalance between the ranks. The recorded events are appended to the trace file whenever a
+ * fixed number of them has been buffered, i.e. the memory of the profiler does not grow with the
+ * number of steps.
+ *
+ * The profiler is disabled by default. In this case, a region or counter costs a single check of
+ * a boolean. The profiler is not thread safe, i.e. regions and counters must only be used outside
+ * of threaded sections.
+ *
+ * Usage:
+ * @code
+ *   void Foo::evaluate()
+ *   {
+ *     FOUR_C_PROFILE_REGION("Foo::evaluate");
+ *     ...
+ *     Core::Utils::Profiling::add_counter("elements evaluated", numele);
+ *   }
+ * @endcode
+ */
+namespace Core::Utils::Profiling
+{
+  namespace Internal
+  {
+    //! whether the profiler records data (use is_enabled())
+    extern bool enabled;
+
+    //! begin a region nested in the current region
+    void begin_region(const char* name);
+
+    //! end the innermost region
+    void end_region();
+
+    //! add to a counter of the current step
+    void add_counter(const char* name, double value);
+  }  // namespace Internal
+
+  /**
+   * @brief Enable the profiler on all ranks of @p comm.
+   *
+   * @param comm Communicator of all ranks writing a trace.
+   * @param file_prefix The trace of rank r is written to <file_prefix>.rank<r>.trace.json.
+   * @param max_depth Regions nested deeper than @p max_depth are not recorded (-1: no limit).
+   */
+  void enable(MPI_Comm comm, const std::string& file_prefix, int max_depth = -1);
+
+  //! Whether the profiler records data
+  inline bool is_enabled() { return Internal::enabled; }
+
+  /**
+   * @brief Begin step @p step, all regions up to the next end_step() are attributed to it.
+   */
+  void begin_step(int step);
+
+  /**
+   * @brief End the current step.
+   *
+   * The counters accumulated during the step and the memory usage of the rank are recorded and
+   * the counters are reset.
+   */
+  void end_step();
+
+  /**
+   * @brief Add @p value to the counter @p name of the current step.
+   */
+  inline void add_counter(const char* name, double value)
+  {
+    if (is_enabled()) Internal::add_counter(name, value);
+  }
+
+  /**
+   * @brief Write the traces of all ranks, print a summary of the region times over the ranks and
+   * disable the profiler.
+   *
+   * Collective call on the communicator passed to enable(). Nothing happens if the profiler is
+   * disabled.
+   */
+  void finalize();
+
+  /**
+   * @brief Scoped region of the profiler, use via FOUR_C_PROFILE_REGION.
+   *
+   * @note The name has to outlive the region, i.e. usually it is a string literal.
+   */
+  class [[nodiscard]] Region
+  {
+   public:
+    explicit Region(const char* name) : active_(is_enabled())
+    {
+      if (active_) Internal::begin_region(name);
+    }
+
+    ~Region()
+    {
+      if (active_) Internal::end_region();
+    }
+
+    Region(const Region&) = delete;
+    Region(Region&&) = delete;
+    Region& operator=(const Region&) = delete;
+    Region& operator=(Region&&) = delete;
+
+   private:
+    //! whether the profiler was enabled when the region began
+    const bool active_;
+  };
+}  // namespace Core::Utils::Profiling
+
+#define FOUR_C_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FOUR_C_PROFILE_CONCAT(a, b) FOUR_C_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * Record the enclosing scope as a region of the profiler with the given name.
+ */
+#define FOUR_C_PROFILE_REGION(name) \
+  const FourC::Core::Utils::Profiling::Region FOUR_C_PROFILE_CONCAT(region_, __LINE__)(name)
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
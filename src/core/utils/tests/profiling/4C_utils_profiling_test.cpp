@@ -0,0 +1,126 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_profiling.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+  using namespace FourC;
+
+  std::string read_file(const std::string& file_name)
+  {
+    std::ifstream file(file_name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  TEST(Profiling, DisabledByDefault)
+  {
+    EXPECT_FALSE(Core::Utils::Profiling::is_enabled());
+
+    // nothing is recorded and finalize does not write anything
+    {
+      FOUR_C_PROFILE_REGION("not recorded");
+      Core::Utils::Profiling::add_counter("not recorded", 1.0);
+    }
+    Core::Utils::Profiling::finalize();
+  }
+
+  TEST(Profiling, WriteTrace)
+  {
+    const std::string prefix =
+        (std::filesystem::temp_directory_path() / "four_c_profiling_test").string();
+    const std::string file_name = prefix + ".rank0.trace.json";
+
+    Core::Utils::Profiling::enable(MPI_COMM_SELF, prefix);
+    EXPECT_TRUE(Core::Utils::Profiling::is_enabled());
+
+    for (int step = 1; step <= 2; ++step)
+    {
+      Core::Utils::Profiling::begin_step(step);
+      {
+        FOUR_C_PROFILE_REGION("outer");
+        {
+          FOUR_C_PROFILE_REGION("inner");
+          Core::Utils::Profiling::add_counter("elements evaluated", 10.0);
+        }
+        Core::Utils::Profiling::add_counter("elements evaluated", 5.0);
+      }
+      Core::Utils::Profiling::end_step();
+    }
+    Core::Utils::Profiling::finalize();
+    EXPECT_FALSE(Core::Utils::Profiling::is_enabled());
+
+    const std::string trace = read_file(file_name);
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"outer\""), std::string::npos);
+    EXPECT_NE(trace.find("\"path\":\"outer/inner\""), std::string::npos);
+    EXPECT_NE(trace.find("\"elements evaluated\":15"), std::string::npos);
+    EXPECT_NE(trace.find("\"step\":2"), std::string::npos);
+
+    std::filesystem::remove(file_name);
+  }
+
+  TEST(Profiling, MaxDepth)
+  {
+    const std::string prefix =
+        (std::filesystem::temp_directory_path() / "four_c_profiling_depth_test").string();
+    const std::string file_name = prefix + ".rank0.trace.json";
+
+    Core::Utils::Profiling::enable(MPI_COMM_SELF, prefix, 1);
+    {
+      FOUR_C_PROFILE_REGION("outer");
+      FOUR_C_PROFILE_REGION("inner");
+    }
+    Core::Utils::Profiling::finalize();
+
+    const std::string trace = read_file(file_name);
+    EXPECT_NE(trace.find("\"name\":\"outer\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"name\":\"inner\""), std::string::npos);
+
+    std::filesystem::remove(file_name);
+  }
+
+  TEST(Profiling, ManyEventsAreFlushed)
+  {
+    const std::string prefix =
+        (std::filesystem::temp_directory_path() / "four_c_profiling_flush_test").string();
+    const std::string file_name = prefix + ".rank0.trace.json";
+
+    // more events than are buffered by the profiler
+    constexpr int num_regions = 40000;
+
+    Core::Utils::Profiling::enable(MPI_COMM_SELF, prefix);
+    Core::Utils::Profiling::begin_step(1);
+    for (int i = 0; i < num_regions; ++i)
+    {
+      FOUR_C_PROFILE_REGION("region");
+    }
+    Core::Utils::Profiling::end_step();
+    Core::Utils::Profiling::finalize();
+
+    const std::string trace = read_file(file_name);
+    const std::string region_event = "\"name\":\"region\"";
+    int num_events = 0;
+    for (auto pos = trace.find(region_event); pos != std::string::npos;
+        pos = trace.find(region_event, pos + 1))
+      ++num_events;
+    EXPECT_EQ(num_events, num_regions);
+    EXPECT_NE(trace.find("\"name\":\"step\""), std::string::npos);
+    EXPECT_NE(trace.find("\"otherData\""), std::string::npos);
+
+    std::filesystem::remove(file_name);
+  }
+}  // namespace
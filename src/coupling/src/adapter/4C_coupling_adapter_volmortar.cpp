@@ -37,7 +37,8 @@ Coupling::Adapter::MortarVolCoupl::MortarVolCoupl()
       coupleddof21_(nullptr),
       dofsets12_(nullptr),
       dofsets21_(nullptr),
-      materialstrategy_(nullptr)
+      materialstrategy_(nullptr),
+      coupling_(nullptr)
 {
   // empty...
 }
@@ -73,6 +74,7 @@ void Coupling::Adapter::MortarVolCoupl::init(int spatial_dimension,
   dofsets12_ = dofsets12;
   dofsets21_ = dofsets21;
   materialstrategy_ = materialstrategy;
+  coupling_ = nullptr;
 
   if ((dis1->num_dof_sets() == 1) and (dis2->num_dof_sets() == 1) and createauxdofs)
   {
@@ -100,35 +102,49 @@ void Coupling::Adapter::MortarVolCoupl::setup(
     materialstrategy_ =
         std::make_shared<FourC::Coupling::VolMortar::Utils::DefaultMaterialStrategy>();
 
-  // create coupling instance
-  std::shared_ptr<FourC::Coupling::VolMortar::VolMortarCoupl> coupdis =
-      std::make_shared<FourC::Coupling::VolMortar::VolMortarCoupl>(spatial_dimension_, masterdis_,
-          slavedis_, params, cut_params, coupleddof12_, coupleddof21_, dofsets12_, dofsets21_,
-          materialstrategy_);
+  // only ghost the elements required for the coupling instead of relying on a redistribution
+  // with extended ghosting
+  if (Teuchos::getIntegralValue<FourC::Coupling::VolMortar::SearchAlgorithm>(
+          params, "SEARCH_ALGORITHM") == FourC::Coupling::VolMortar::search_bvh)
+  {
+    FourC::Coupling::VolMortar::VolMortarCoupl::extend_ghosting_to_candidates(
+        spatial_dimension_, *masterdis_, *slavedis_);
+  }
+
+  // create coupling instance, an existing one keeps its projection operators as long as the
+  // meshes did not move
+  if (coupling_ == nullptr or not coupling_->layouts_unchanged())
+  {
+    coupling_ = std::make_shared<FourC::Coupling::VolMortar::VolMortarCoupl>(spatial_dimension_,
+        masterdis_, slavedis_, params, cut_params, coupleddof12_, coupleddof21_, dofsets12_,
+        dofsets21_, materialstrategy_);
+  }
+  else
+    coupling_->set_material_strategy(materialstrategy_);
 
   //-----------------------
   // Evaluate volmortar coupling:
   if (Teuchos::getIntegralValue<FourC::Coupling::VolMortar::CouplingType>(params, "COUPLINGTYPE") ==
       FourC::Coupling::VolMortar::couplingtype_volmortar)
-    coupdis->evaluate_volmortar();
+    coupling_->evaluate_volmortar();
   //-----------------------
   // consistent interpolation (NO Core::VOLMORTAR)
   else if (Teuchos::getIntegralValue<FourC::Coupling::VolMortar::CouplingType>(
                params, "COUPLINGTYPE") == FourC::Coupling::VolMortar::couplingtype_coninter)
-    coupdis->evaluate_consistent_interpolation();
+    coupling_->evaluate_consistent_interpolation();
   //-----------------------
   else
     FOUR_C_THROW("ERROR: Chosen coupling not implemented!!!");
 
   // get the P operators
-  p12_ = coupdis->get_p_matrix12();
-  p21_ = coupdis->get_p_matrix21();
+  p12_ = coupling_->get_p_matrix12();
+  p21_ = coupling_->get_p_matrix21();
 
   /***********************************************************
    * Assign materials                                        *
    ***********************************************************/
   // assign materials from one discretization to the other
-  coupdis->assign_materials();
+  coupling_->assign_materials();
 
   // validate flag issetup_
   issetup_ = true;
@@ -199,6 +215,17 @@ void Coupling::Adapter::MortarVolCoupl::assign_materials(
   if (materialstrategy == nullptr)
     materialstrategy =
         std::make_shared<FourC::Coupling::VolMortar::Utils::DefaultMaterialStrategy>();
+
+  // reuse the coupling of setup() and its search results for the same discretizations
+  if (coupling_ != nullptr and dis1 == masterdis_ and dis2 == slavedis_ and
+      coupling_->layouts_unchanged())
+  {
+    coupling_->set_material_strategy(materialstrategy);
+    coupling_->assign_materials();
+    coupling_->set_material_strategy(materialstrategy_);
+    return;
+  }
+
   // create coupling instance
   FourC::Coupling::VolMortar::VolMortarCoupl coupdis(spatial_dimension_, dis1, dis2,
       volmortar_params, cut_params, nullptr, nullptr, nullptr, nullptr, materialstrategy);
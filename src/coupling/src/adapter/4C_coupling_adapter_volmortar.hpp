@@ -44,6 +44,8 @@ namespace Core::LinAlg
 
 namespace Coupling::VolMortar
 {
+  class VolMortarCoupl;
+
   namespace Utils
   {
     class DefaultMaterialStrategy;
@@ -228,6 +230,9 @@ namespace Coupling::Adapter
     std::pair<int, int>* dofsets21_;
     std::shared_ptr<VolMortar::Utils::DefaultMaterialStrategy> materialstrategy_;
 
+    //! coupling of masterdis_ and slavedis_, reused as long as their layouts do not change
+    std::shared_ptr<VolMortar::VolMortarCoupl> coupling_;
+
     int spatial_dimension_{};
   };
 }  // namespace Coupling::Adapter
@@ -7,6 +7,8 @@
 
 #include "4C_coupling_volmortar.hpp"
 
+#include "4C_binstrategy_utils.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_coupling_volmortar_cell.hpp"
 #include "4C_coupling_volmortar_defines.hpp"
 #include "4C_coupling_volmortar_integrator.hpp"
@@ -16,6 +18,11 @@
 #include "4C_cut_volumecell.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_dofset_predefineddofnumber.hpp"
+#include "4C_fem_geometric_search_bounding_volume.hpp"
+#include "4C_fem_geometric_search_bvh.hpp"
+#include "4C_fem_geometric_search_distributed_tree.hpp"
+#include "4C_fem_geometry_intersection_math.hpp"
+#include "4C_fem_geometry_intersection_service.hpp"
 #include "4C_fem_geometry_searchtree.hpp"
 #include "4C_fem_geometry_searchtree_service.hpp"
 #include "4C_linalg_mapextractor.hpp"
@@ -34,9 +41,118 @@
 #include "4C_utils_parameter_list.hpp"
 
 #include <Teuchos_Time.hpp>
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! copies of the element, node and dof column maps of @p dis
+  std::vector<std::shared_ptr<const Epetra_Map>> col_maps(const Core::FE::Discretization& dis)
+  {
+    std::vector<std::shared_ptr<const Epetra_Map>> maps = {
+        std::make_shared<Epetra_Map>(*dis.element_col_map()),
+        std::make_shared<Epetra_Map>(*dis.node_col_map())};
+    if (dis.have_dofs())
+    {
+      for (int nds = 0; nds < dis.num_dof_sets(); ++nds)
+        maps.emplace_back(std::make_shared<Epetra_Map>(*dis.dof_col_map(nds)));
+    }
+    return maps;
+  }
+
+  //! whether @p maps still share their data with the column maps of @p dis
+  bool same_col_maps(
+      const std::vector<std::shared_ptr<const Epetra_Map>>& maps, const Core::FE::Discretization& dis)
+  {
+    if (not dis.filled()) return false;
+
+    const std::vector<std::shared_ptr<const Epetra_Map>> current = col_maps(dis);
+    if (maps.size() != current.size()) return false;
+    for (std::size_t i = 0; i < maps.size(); ++i)
+      if (maps[i]->DataPtr() != current[i]->DataPtr()) return false;
+    return true;
+  }
+
+  /*!
+   * \brief bounding volume of the first @p dim coordinates of the nodes of @p ele
+   *
+   * ArborX stores the bounding volumes in single precision, hence they are enlarged to contain
+   * all candidates of the k-DOP intersection test of the octree search.
+   */
+  Core::GeometricSearch::BoundingVolume bounding_volume(
+      const Core::Elements::Element& ele, int dim)
+  {
+    Core::GeometricSearch::BoundingVolume volume;
+    double max_coordinate = 0.0;
+    for (int k = 0; k < ele.num_node(); ++k)
+    {
+      Core::LinAlg::Matrix<3, 1> pos(true);
+      for (int j = 0; j < dim; ++j)
+      {
+        pos(j) = ele.nodes()[k]->x()[j];
+        max_coordinate = std::max(max_coordinate, std::abs(pos(j)));
+      }
+      volume.add_point(pos);
+    }
+    volume.extend_boundaries(2.0 * Core::Geo::TOL7 + 1.0e-6 * max_coordinate);
+    return volume;
+  }
+
+  //! gids of the row elements of @p searchdis colliding with a column element of @p querydis,
+  //! which are no column elements of @p searchdis on this proc
+  std::vector<int> missing_candidates(const Core::FE::Discretization& querydis,
+      const Core::FE::Discretization& searchdis, int dim)
+  {
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> primitives;
+    primitives.reserve(searchdis.num_my_row_elements());
+    for (const auto* ele : searchdis.my_row_element_range())
+      primitives.emplace_back(ele->id(), bounding_volume(*ele, dim));
+
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> predicates;
+    predicates.reserve(querydis.num_my_col_elements());
+    for (const auto* ele : querydis.my_col_element_range())
+      predicates.emplace_back(ele->id(), bounding_volume(*ele, dim));
+
+    const std::vector<Core::GeometricSearch::GlobalCollisionSearchResult> collisions =
+        Core::GeometricSearch::global_collision_search(
+            primitives, predicates, querydis.get_comm(), Core::IO::minimal);
+
+    std::set<int> missing;
+    for (const auto& collision : collisions)
+    {
+      if (searchdis.element_col_map()->LID(collision.gid_primitive) < 0)
+        missing.insert(collision.gid_primitive);
+    }
+    return {missing.begin(), missing.end()};
+  }
+
+  //! ghost the elements @p missing on this proc in addition, return whether any proc did so
+  bool extend_ghosting(Core::FE::Discretization& dis, const std::vector<int>& missing)
+  {
+    int local_missing = missing.empty() ? 0 : 1;
+    int global_missing = 0;
+    Core::Communication::max_all(&local_missing, &global_missing, 1, dis.get_comm());
+    if (global_missing == 0) return false;
+
+    const Epetra_Map& elecolmap = *dis.element_col_map();
+    std::vector<int> colgids(
+        elecolmap.MyGlobalElements(), elecolmap.MyGlobalElements() + elecolmap.NumMyElements());
+    colgids.insert(colgids.end(), missing.begin(), missing.end());
+
+    Epetra_Map extendedelecolmap(-1, static_cast<int>(colgids.size()), colgids.data(), 0,
+        Core::Communication::as_epetra_comm(dis.get_comm()));
+    Core::Binstrategy::Utils::extend_discretization_ghosting(
+        dis, extendedelecolmap, true, false, true);
+
+    return true;
+  }
+}  // namespace
+
 /*----------------------------------------------------------------------*
  |  ctor (public)                                            farah 10/13|
  *----------------------------------------------------------------------*/
@@ -121,6 +237,9 @@ Coupling::VolMortar::VolMortarCoupl::VolMortarCoupl(int dim,
   inteles_ = 0;
   volume_ = 0.0;
 
+  // remember the layouts the maps of the projection operators are based on
+  layout_states_ = {mesh_state(*dis1_), mesh_state(*dis2_)};
+
   return;
 }
 
@@ -175,6 +294,9 @@ void Coupling::VolMortar::VolMortarCoupl::build_maps(std::shared_ptr<Core::FE::D
  *----------------------------------------------------------------------*/
 void Coupling::VolMortar::VolMortarCoupl::evaluate_volmortar()
 {
+  // the projection operators only have to be recomputed if one of the meshes changed
+  if (operators_up_to_date(couplingtype_volmortar)) return;
+
   /***********************************************************
    * Welcome                                                 *
    ***********************************************************/
@@ -222,6 +344,7 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_volmortar()
    ***********************************************************/
   complete();
   create_projection_operator();
+  store_operator_state(couplingtype_volmortar);
 
   /**************************************************
    * Bye                                            *
@@ -423,6 +546,176 @@ std::vector<int> Coupling::VolMortar::VolMortarCoupl::search(Core::Elements::Ele
   return gids;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+std::vector<std::vector<int>> Coupling::VolMortar::VolMortarCoupl::search_candidates(
+    std::shared_ptr<Core::FE::Discretization> querydis,
+    std::shared_ptr<Core::FE::Discretization> searchdis)
+{
+  std::vector<std::vector<int>> candidates(querydis->num_my_col_elements());
+
+  if (searchalgorithm_ == search_octree)
+  {
+    std::shared_ptr<Core::Geo::SearchTree> searchtree = init_search(searchdis);
+    std::map<int, Core::LinAlg::Matrix<9, 2>> dops = calc_background_dops(searchdis);
+
+    for (int lid = 0; lid < querydis->num_my_col_elements(); ++lid)
+      candidates[lid] = search(*querydis->l_col_element(lid), searchtree, dops);
+
+    return candidates;
+  }
+
+  // one query of the bounding volume hierarchy for all elements, the collisions of the bounding
+  // volumes are refined with the same k-DOP test as in the octree search
+  std::vector<Core::LinAlg::Matrix<9, 2>> searchdops;
+  std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> primitives;
+  searchdops.reserve(searchdis->num_my_col_elements());
+  primitives.reserve(searchdis->num_my_col_elements());
+  for (int lid = 0; lid < searchdis->num_my_col_elements(); ++lid)
+  {
+    Core::Elements::Element* ele = searchdis->l_col_element(lid);
+    searchdops.push_back(calc_dop(*ele));
+    primitives.emplace_back(ele->id(), bounding_volume(*ele, dim_));
+  }
+
+  std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> predicates;
+  predicates.reserve(querydis->num_my_col_elements());
+  for (int lid = 0; lid < querydis->num_my_col_elements(); ++lid)
+  {
+    Core::Elements::Element* ele = querydis->l_col_element(lid);
+    predicates.emplace_back(ele->id(), bounding_volume(*ele, dim_));
+  }
+
+  const auto [indices, offsets] =
+      Core::GeometricSearch::collision_search(primitives, predicates, comm_, Core::IO::minimal);
+
+  for (int lid = 0; lid < querydis->num_my_col_elements(); ++lid)
+  {
+    const Core::LinAlg::Matrix<9, 2> querydop = calc_dop(*querydis->l_col_element(lid));
+    for (int j = offsets[lid]; j < offsets[lid + 1]; ++j)
+    {
+      if (Core::Geo::intersection_of_kdo_ps(querydop, searchdops[indices[j]]))
+        candidates[lid].push_back(primitives[indices[j]].first);
+    }
+
+    // same order as the octree search
+    std::sort(candidates[lid].begin(), candidates[lid].end());
+  }
+
+  return candidates;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Coupling::VolMortar::VolMortarCoupl::update_candidates()
+{
+  if (candidates_valid_ and meshes_unchanged(candidate_states_)) return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("Coupling::VolMortar::VolMortarCoupl::update_candidates");
+
+  candidates12_ = search_candidates(dis1_, dis2_);
+  candidates21_ = search_candidates(dis2_, dis1_);
+  candidate_states_ = {mesh_state(*dis1_), mesh_state(*dis2_)};
+  candidates_valid_ = true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Coupling::VolMortar::VolMortarCoupl::MeshState Coupling::VolMortar::VolMortarCoupl::mesh_state(
+    const Core::FE::Discretization& dis) const
+{
+  MeshState state;
+  state.col_maps = col_maps(dis);
+
+  state.positions.reserve(static_cast<std::size_t>(dim_) * dis.num_my_col_nodes());
+  for (int lid = 0; lid < dis.num_my_col_nodes(); ++lid)
+  {
+    const std::vector<double>& x = dis.l_col_node(lid)->x();
+    state.positions.insert(state.positions.end(), x.begin(), x.begin() + dim_);
+  }
+
+  return state;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Coupling::VolMortar::VolMortarCoupl::mesh_unchanged(
+    const MeshState& state, const Core::FE::Discretization& dis) const
+{
+  if (not same_col_maps(state.col_maps, dis)) return false;
+
+  // the same node column map implies the same number of positions
+  for (int lid = 0; lid < dis.num_my_col_nodes(); ++lid)
+  {
+    const std::vector<double>& x = dis.l_col_node(lid)->x();
+    if (not std::equal(x.begin(), x.begin() + dim_, state.positions.begin() + dim_ * lid))
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Coupling::VolMortar::VolMortarCoupl::meshes_unchanged(
+    const std::pair<MeshState, MeshState>& states) const
+{
+  int local_unchanged =
+      mesh_unchanged(states.first, *dis1_) and mesh_unchanged(states.second, *dis2_) ? 1 : 0;
+  int global_unchanged = 0;
+  Core::Communication::min_all(&local_unchanged, &global_unchanged, 1, comm_);
+
+  return global_unchanged == 1;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Coupling::VolMortar::VolMortarCoupl::layouts_unchanged() const
+{
+  int local_unchanged = same_col_maps(layout_states_.first.col_maps, *dis1_) and
+                                same_col_maps(layout_states_.second.col_maps, *dis2_)
+                            ? 1
+                            : 0;
+  int global_unchanged = 0;
+  Core::Communication::min_all(&local_unchanged, &global_unchanged, 1, comm_);
+
+  return global_unchanged == 1;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Coupling::VolMortar::VolMortarCoupl::operators_up_to_date(CouplingType type) const
+{
+  return operators_valid_ and operators_type_ == type and meshes_unchanged(operator_states_);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Coupling::VolMortar::VolMortarCoupl::store_operator_state(CouplingType type)
+{
+  operators_valid_ = true;
+  operators_type_ = type;
+  operator_states_ = {mesh_state(*dis1_), mesh_state(*dis2_)};
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Coupling::VolMortar::VolMortarCoupl::extend_ghosting_to_candidates(
+    int dim, Core::FE::Discretization& dis1, Core::FE::Discretization& dis2)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Coupling::VolMortar::VolMortarCoupl::extend_ghosting_to_candidates");
+
+  // the candidates are only required for the original column elements, since additionally
+  // ghosted elements do not contribute to rows owned by this proc
+  const std::vector<int> missing2 = missing_candidates(dis1, dis2, dim);
+  const std::vector<int> missing1 = missing_candidates(dis2, dis1, dim);
+
+  const bool extended1 = extend_ghosting(dis1, missing1);
+  const bool extended2 = extend_ghosting(dis2, missing2);
+
+  return extended1 or extended2;
+}
+
 /*----------------------------------------------------------------------*
  |  Assign materials for both fields                         vuong 09/14|
  *----------------------------------------------------------------------*/
@@ -431,13 +724,8 @@ void Coupling::VolMortar::VolMortarCoupl::assign_materials()
   if (dis1_ == nullptr or dis2_ == nullptr)
     FOUR_C_THROW("no discretization for assigning materials!");
 
-  // init search trees
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeA = init_search(dis1_);
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeB = init_search(dis2_);
-
-  // calculate DOPs for search algorithm
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsA = calc_background_dops(dis1_);
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsB = calc_background_dops(dis2_);
+  // search colliding elements
+  update_candidates();
 
   /**************************************************
    * loop over all Adis elements                    *
@@ -447,12 +735,10 @@ void Coupling::VolMortar::VolMortarCoupl::assign_materials()
     // get master element
     Core::Elements::Element* Aele = dis1_->l_col_element(j);
 
-    std::vector<int> found = search(*Aele, SearchTreeB, CurrentDOPsB);
-
     /***********************************************************
      * Assign materials                                        *
      ***********************************************************/
-    materialstrategy_->assign_material2_to1(this, Aele, found, dis1_, dis2_);
+    materialstrategy_->assign_material2_to1(this, Aele, candidates12_[j], dis1_, dis2_);
   }
 
   /**************************************************
@@ -463,12 +749,10 @@ void Coupling::VolMortar::VolMortarCoupl::assign_materials()
     // get master element
     Core::Elements::Element* Bele = dis2_->l_col_element(j);
 
-    std::vector<int> found = search(*Bele, SearchTreeA, CurrentDOPsA);
-
     /***********************************************************
      * Assign materials                                        *
      ***********************************************************/
-    materialstrategy_->assign_material1_to2(this, Bele, found, dis1_, dis2_);
+    materialstrategy_->assign_material1_to2(this, Bele, candidates21_[j], dis1_, dis2_);
   }
 
   return;
@@ -708,6 +992,9 @@ void Coupling::VolMortar::VolMortarCoupl::create_trafo_operator(Core::Elements::
  *----------------------------------------------------------------------*/
 void Coupling::VolMortar::VolMortarCoupl::evaluate_consistent_interpolation()
 {
+  // the projection operators only have to be recomputed if one of the meshes changed
+  if (operators_up_to_date(couplingtype_coninter)) return;
+
   /***********************************************************
    * Welcome                                                 *
    ***********************************************************/
@@ -725,12 +1012,9 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_consistent_interpolation()
   p21_ = std::make_shared<Core::LinAlg::SparseMatrix>(*p21_dofrowmap_, 100);
 
   /***********************************************************
-   * create search tree and current dops                     *
+   * search colliding elements                               *
    ***********************************************************/
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeA = init_search(dis1_);
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeB = init_search(dis2_);
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsA = calc_background_dops(dis1_);
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsB = calc_background_dops(dis2_);
+  update_candidates();
 
   /***********************************************************
    * Create P operators                                      *
@@ -742,9 +1026,8 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_consistent_interpolation()
     Core::Nodes::Node* anode = dis1_->g_node(gid);
 
     // get found elements from other discr.
-    std::vector<int> found = search(*anode->elements()[0], SearchTreeB, CurrentDOPsB);
-
-    assemble_consistent_interpolation_p12(anode, found);
+    const int elelid = dis1_->element_col_map()->LID(anode->elements()[0]->id());
+    assemble_consistent_interpolation_p12(anode, candidates12_[elelid]);
   }  // end node loop
 
   //================================================
@@ -755,9 +1038,8 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_consistent_interpolation()
     Core::Nodes::Node* bnode = dis2_->g_node(gid);
 
     // get found elements from other discr.
-    std::vector<int> found = search(*bnode->elements()[0], SearchTreeA, CurrentDOPsA);
-
-    assemble_consistent_interpolation_p21(bnode, found);
+    const int elelid = dis2_->element_col_map()->LID(bnode->elements()[0]->id());
+    assemble_consistent_interpolation_p21(bnode, candidates21_[elelid]);
   }  // end node loop
 
   /***********************************************************
@@ -765,6 +1047,7 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_consistent_interpolation()
    ***********************************************************/
   p12_->complete(*p12_dofdomainmap_, *p12_dofrowmap_);
   p21_->complete(*p21_dofdomainmap_, *p21_dofrowmap_);
+  store_operator_state(couplingtype_coninter);
 
   return;
 }
@@ -781,13 +1064,8 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_elements()
     std::cout << "*****       Calc First Projector:            *****" << std::endl;
   }
 
-  // init search trees
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeA = init_search(dis1_);
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeB = init_search(dis2_);
-
-  // calculate DOPs for search algorithm
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsA = calc_background_dops(dis1_);
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsB = calc_background_dops(dis2_);
+  // search colliding elements
+  update_candidates();
 
   /**************************************************
    * loop over all Adis elements                    *
@@ -800,8 +1078,7 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_elements()
     // get master element
     Core::Elements::Element* Aele = dis1_->l_col_element(j);
 
-    std::vector<int> found = search(*Aele, SearchTreeB, CurrentDOPsB);
-    integrate_3d_ele_based_p12(*Aele, found);
+    integrate_3d_ele_based_p12(*Aele, candidates12_[j]);
 
     // create trafo operator for quadr. modification
     if (dualquad_ != dualquad_no_mod) create_trafo_operator(*Aele, dis1_, true, donebeforea);
@@ -825,8 +1102,7 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_elements()
     // get master element
     Core::Elements::Element* Bele = dis2_->l_col_element(j);
 
-    std::vector<int> found = search(*Bele, SearchTreeA, CurrentDOPsA);
-    integrate_3d_ele_based_p21(*Bele, found);
+    integrate_3d_ele_based_p21(*Bele, candidates21_[j]);
 
     // create trafo operator for quadr. modification
     if (dualquad_ != dualquad_no_mod) create_trafo_operator(*Bele, dis2_, false, donebeforeb);
@@ -842,9 +1118,8 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_elements()
  *----------------------------------------------------------------------*/
 void Coupling::VolMortar::VolMortarCoupl::evaluate_segments()
 {
-  // create search tree and current dops
-  std::shared_ptr<Core::Geo::SearchTree> SearchTreeB = init_search(dis2_);
-  std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsB = calc_background_dops(dis2_);
+  // search colliding elements
+  update_candidates();
 
   /**************************************************
    * loop over all slave elements                   *
@@ -858,7 +1133,7 @@ void Coupling::VolMortar::VolMortarCoupl::evaluate_segments()
     Core::Elements::Element* Aele = dis1_->l_col_element(i);
 
     // get found elements from other discr.
-    std::vector<int> found = search(*Aele, SearchTreeB, CurrentDOPsB);
+    const std::vector<int>& found = candidates12_[i];
 
     /***********************************************************
      * Assign materials                                        *
@@ -1052,6 +1327,7 @@ void Coupling::VolMortar::VolMortarCoupl::read_and_check_input(
 
   // get specific and frequently reused parameters
   dualquad_ = Teuchos::getIntegralValue<DualQuad>(params_, "DUALQUAD");
+  searchalgorithm_ = Teuchos::getIntegralValue<SearchAlgorithm>(params_, "SEARCH_ALGORITHM");
 }
 
 /*----------------------------------------------------------------------*
@@ -1179,13 +1455,8 @@ void Coupling::VolMortar::VolMortarCoupl::mesh_init()
     // output
     if (myrank_ == 0) std::cout << "*****       step " << mi << std::endl;
 
-    // init search trees
-    std::shared_ptr<Core::Geo::SearchTree> SearchTreeA = init_search(dis1_);
-    std::shared_ptr<Core::Geo::SearchTree> SearchTreeB = init_search(dis2_);
-
-    // calculate DOPs for search algorithm
-    std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsA = calc_background_dops(dis1_);
-    std::map<int, Core::LinAlg::Matrix<9, 2>> CurrentDOPsB = calc_background_dops(dis2_);
+    // search colliding elements for the current nodal positions
+    update_candidates();
 
     /**************************************************
      * loop over all Adis elements                    *
@@ -1196,8 +1467,7 @@ void Coupling::VolMortar::VolMortarCoupl::mesh_init()
       // get master element
       Core::Elements::Element* Aele = dis1_->l_col_element(j);
 
-      std::vector<int> found = search(*Aele, SearchTreeB, CurrentDOPsB);
-      integrate_3d_ele_based_a_dis_mesh_init(*Aele, found, dofseta, dofsetb);
+      integrate_3d_ele_based_a_dis_mesh_init(*Aele, candidates12_[j], dofseta, dofsetb);
     }
 
     /**************************************************
@@ -1209,8 +1479,7 @@ void Coupling::VolMortar::VolMortarCoupl::mesh_init()
       // get master element
       Core::Elements::Element* Bele = dis2_->l_col_element(j);
 
-      std::vector<int> found = search(*Bele, SearchTreeA, CurrentDOPsA);
-      integrate_3d_ele_based_b_dis_mesh_init(*Bele, found, dofseta, dofsetb);
+      integrate_3d_ele_based_b_dis_mesh_init(*Bele, candidates21_[j], dofseta, dofsetb);
     }
 
     // complete...
@@ -16,9 +16,12 @@
 #include "4C_cut_utils.hpp"
 #include "4C_mortar_coupling3d_classes.hpp"
 
+#include <Epetra_Map.h>
 #include <Teuchos_ParameterList.hpp>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -83,6 +86,13 @@ namespace Coupling::VolMortar
     couplingtype_coninter    ///< consist. interpolation
   };
 
+  // Type of search algorithm
+  enum SearchAlgorithm
+  {
+    search_octree,  ///< octree over the k-DOPs of all column elements
+    search_bvh      ///< bounding volume hierarchy of ArborX, one query for all elements
+  };
+
   // Type of coupling
   enum Shapefcn
   {
@@ -162,6 +172,42 @@ namespace Coupling::VolMortar
      */
     virtual void assign_materials();
 
+    /*!
+     \brief set strategy for element information transfer
+
+     */
+    void set_material_strategy(
+        std::shared_ptr<Coupling::VolMortar::Utils::DefaultMaterialStrategy> materialstrategy)
+    {
+      materialstrategy_ = materialstrategy;
+    }
+
+    /*!
+     \brief whether the layouts of both discretizations are still the ones at construction
+
+     The maps of the projection operators are built in the constructor. As long as the layouts
+     did not change, this object can be reused and only recomputes its projection operators if
+     the nodal positions changed.
+     */
+    bool layouts_unchanged() const;
+
+    /*!
+     \brief Extend the ghosting of both discretizations by all coupling candidates
+
+     For every column element of one discretization, all elements of the other discretization it
+     collides with have to be available as column elements for the evaluation of the coupling. The
+     colliding elements are found with a distributed search over the row elements, and only the
+     missing ones are ghosted in addition. Nothing happens if no element is missing on any proc.
+     This requires ArborX.
+
+     \note Call this function before constructing the coupling, since the column maps of the
+     projection operators are based on the column layout of the discretizations.
+
+     \return whether the ghosting of at least one discretization has been extended
+     */
+    static bool extend_ghosting_to_candidates(
+        int dim, Core::FE::Discretization& dis1, Core::FE::Discretization& dis2);
+
    private:
     /*!
      \brief Assemble p matrix for cons. interpolation approach
@@ -432,6 +478,65 @@ namespace Coupling::VolMortar
         std::shared_ptr<Core::Geo::SearchTree> SearchTree,
         std::map<int, Core::LinAlg::Matrix<9, 2>>& currentKDOPs);
 
+    /*!
+     \brief search colliding elements of @p searchdis for all column elements of @p querydis
+
+     \return global ids of the colliding column elements of @p searchdis, in the order of the
+     column elements of @p querydis
+     */
+    virtual std::vector<std::vector<int>> search_candidates(
+        std::shared_ptr<Core::FE::Discretization> querydis,
+        std::shared_ptr<Core::FE::Discretization> searchdis);
+
+    /*!
+     \brief search colliding elements for all column elements of both discretizations
+
+     The search is only repeated if the layout or the nodal positions of one of the
+     discretizations changed since the last search.
+     */
+    virtual void update_candidates();
+
+    //! layout and nodal reference positions of a discretization
+    struct MeshState
+    {
+      //! copies of the element, node and dof column maps, sharing their data with the maps of
+      //! the discretization
+      std::vector<std::shared_ptr<const Epetra_Map>> col_maps;
+
+      //! reference positions of all column nodes
+      std::vector<double> positions;
+    };
+
+    /*!
+     \brief current layout and nodal reference positions of @p dis
+
+     */
+    MeshState mesh_state(const Core::FE::Discretization& dis) const;
+
+    /*!
+     \brief whether @p dis still matches @p state on this proc
+
+     */
+    bool mesh_unchanged(const MeshState& state, const Core::FE::Discretization& dis) const;
+
+    /*!
+     \brief whether both discretizations still match @p states on all procs
+
+     */
+    bool meshes_unchanged(const std::pair<MeshState, MeshState>& states) const;
+
+    /*!
+     \brief whether the projection operators of @p type are up to date with both meshes
+
+     */
+    bool operators_up_to_date(CouplingType type) const;
+
+    /*!
+     \brief remember that the projection operators of @p type match the current meshes
+
+     */
+    void store_operator_state(CouplingType type);
+
     // don't want = operator and cctor
     VolMortarCoupl operator=(const VolMortarCoupl& old);
     VolMortarCoupl(const VolMortarCoupl& old);
@@ -504,8 +609,23 @@ namespace Coupling::VolMortar
     // search algorithm
     Core::LinAlg::Matrix<9, 3> dopnormals_;  /// dop normals for search algorithm
 
+    //! @name cached search results and projection operators
+    std::vector<std::vector<int>>
+        candidates12_;  /// colliding Omega_2 elements of the column elements of Omega_1
+    std::vector<std::vector<int>>
+        candidates21_;  /// colliding Omega_1 elements of the column elements of Omega_2
+    bool candidates_valid_ = false;  /// whether candidates were searched for candidate_states_
+    std::pair<MeshState, MeshState> candidate_states_;  /// meshes of the last search
+
+    bool operators_valid_ = false;  /// whether p12_ and p21_ were computed for operator_states_
+    CouplingType operators_type_ = couplingtype_volmortar;  /// coupling type of p12_ and p21_
+    std::pair<MeshState, MeshState> operator_states_;       /// meshes of p12_ and p21_
+    std::pair<MeshState, MeshState> layout_states_;         /// meshes at construction
+    //@}
+
     // input
     DualQuad dualquad_;  /// type of quadratic weighting interpolation
+    SearchAlgorithm searchalgorithm_;  /// algorithm to search colliding elements
 
     /// strategy for element information transfer (mainly material, but can be more)
     std::shared_ptr<Coupling::VolMortar::Utils::DefaultMaterialStrategy> materialstrategy_;
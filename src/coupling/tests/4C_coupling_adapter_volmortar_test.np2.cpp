@@ -0,0 +1,154 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_coupling_adapter_volmortar.hpp"
+
+#include "4C_coupling_volmortar.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_rebalance_binning_based.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Teuchos_ParameterList.hpp>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  Teuchos::ParameterList volmortar_parameters(Coupling::VolMortar::SearchAlgorithm search)
+  {
+    Teuchos::ParameterList params;
+    params.set("INTTYPE", Coupling::VolMortar::inttype_elements);
+    params.set("COUPLINGTYPE", Coupling::VolMortar::couplingtype_volmortar);
+    params.set("SHAPEFCN", Coupling::VolMortar::shape_dual);
+    params.set("CUTTYPE", Coupling::VolMortar::cuttype_directdivergence);
+    params.set("DUALQUAD", Coupling::VolMortar::dualquad_no_mod);
+    params.set("SEARCH_ALGORITHM", search);
+    params.set("MESH_INIT", false);
+    params.set("KEEP_EXTENDEDGHOSTING", true);
+    return params;
+  }
+
+  // Two non-matching hex8 meshes of the unit cube distributed over two processors. Both meshes
+  // are ghosted on all processors, such that also the octree search finds all candidates.
+  class MortarVolCouplTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    std::shared_ptr<Core::FE::Discretization> create_discretization(
+        const std::string& name, int intervals, int first_node_gid) const
+    {
+      auto dis = std::make_shared<Core::FE::Discretization>(name, comm_, 3);
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{intervals, intervals, 2 * intervals};
+      inputData.node_gid_of_first_new_node_ = first_node_gid;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*dis, inputData, false);
+      dis->fill_complete(false, false, false);
+      Core::Rebalance::ghost_discretization_on_all_procs(*dis);
+      dis->fill_complete(true, false, false);
+
+      return dis;
+    }
+
+    //! set up a coupling of two new meshes with the given search algorithm
+    std::shared_ptr<Coupling::Adapter::MortarVolCoupl> create_coupling(
+        Coupling::VolMortar::SearchAlgorithm search)
+    {
+      auto coupling = std::make_shared<Coupling::Adapter::MortarVolCoupl>();
+      coupling->init(3, create_discretization("structure", 2, 0),
+          create_discretization("thermo", 3, 1000), &coupleddof_, &coupleddof_);
+      coupling->setup(volmortar_parameters(search), Teuchos::ParameterList());
+      return coupling;
+    }
+
+    static void expect_same_operator(
+        const Core::LinAlg::SparseMatrix& result, const Core::LinAlg::SparseMatrix& reference)
+    {
+      EXPECT_EQ(result.epetra_matrix()->NumGlobalNonzeros(),
+          reference.epetra_matrix()->NumGlobalNonzeros());
+      EXPECT_NEAR(result.norm_frobenius(), reference.norm_frobenius(), 1e-12);
+      EXPECT_NEAR(result.norm_one(), reference.norm_one(), 1e-12);
+    }
+
+    MPI_Comm comm_;
+    std::vector<int> coupleddof_ = {1, 1, 1};
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(MortarVolCouplTest, RepeatedSetupReusesOperators)
+  {
+    auto coupling = create_coupling(Coupling::VolMortar::search_octree);
+
+    const auto p12 = coupling->get_p_matrix12();
+    const auto p21 = coupling->get_p_matrix21();
+    ASSERT_NE(p12, nullptr);
+    ASSERT_NE(p21, nullptr);
+
+    // the meshes did not change, hence the operators of the first setup are kept
+    coupling->setup(
+        volmortar_parameters(Coupling::VolMortar::search_octree), Teuchos::ParameterList());
+    EXPECT_EQ(coupling->get_p_matrix12(), p12);
+    EXPECT_EQ(coupling->get_p_matrix21(), p21);
+
+    // and they are the same as the ones of a new coupling
+    const auto reference = create_coupling(Coupling::VolMortar::search_octree);
+    expect_same_operator(*coupling->get_p_matrix12(), *reference->get_p_matrix12());
+    expect_same_operator(*coupling->get_p_matrix21(), *reference->get_p_matrix21());
+  }
+
+#ifdef FOUR_C_WITH_ARBORX
+  TEST_F(MortarVolCouplTest, BoundingVolumeHierarchyMatchesOctree)
+  {
+    const auto octree = create_coupling(Coupling::VolMortar::search_octree);
+    const auto bvh = create_coupling(Coupling::VolMortar::search_bvh);
+
+    expect_same_operator(*bvh->get_p_matrix12(), *octree->get_p_matrix12());
+    expect_same_operator(*bvh->get_p_matrix21(), *octree->get_p_matrix21());
+
+    // a repeated setup with the extended ghosting keeps the operators as well
+    const auto p12 = bvh->get_p_matrix12();
+    bvh->setup(volmortar_parameters(Coupling::VolMortar::search_bvh), Teuchos::ParameterList());
+    EXPECT_EQ(bvh->get_p_matrix12(), p12);
+  }
+#endif
+}  // namespace
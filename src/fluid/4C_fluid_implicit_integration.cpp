@@ -22,6 +22,7 @@
 #include "4C_fluid_DbcHDG.hpp"
 #include "4C_fluid_ele.hpp"
 #include "4C_fluid_ele_action.hpp"
+#include "4C_fluid_ele_calc_intfaces_stab.hpp"
 #include "4C_fluid_ele_intfaces_calc.hpp"
 #include "4C_fluid_impedancecondition.hpp"
 #include "4C_fluid_meshtying.hpp"
@@ -386,6 +387,9 @@ void FLD::FluidImplicitTimeInt::create_faces_extension()
   // including the faces between elements
   facediscret_ = std::dynamic_pointer_cast<Core::FE::DiscretizationFaces>(discret_);
   facediscret_->create_internal_faces_extension(true);
+
+  // geometry data cached for the previous internal faces is not valid anymore
+  Discret::Elements::FluidIntFaceStab::clear_face_geometry_cache(*discret_);
 }
 /*----------------------------------------------------------------------*
  |  initialize algorithm for nonlinear BCs                   thon 09/14 |
@@ -1871,6 +1875,9 @@ void FLD::FluidImplicitTimeInt::assemble_edge_based_matand_rhs()
     {
       discret_->set_state(ndsale_, "dispnp", dispnp_);
       discret_->set_state(ndsale_, "gridv", gridv_);
+
+      // the mesh may have moved since the last evaluation
+      Discret::Elements::FluidIntFaceStab::clear_face_geometry_cache(*discret_);
     }
 
     Teuchos::ParameterList params;
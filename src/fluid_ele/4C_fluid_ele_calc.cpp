@@ -814,7 +814,7 @@ void Discret::Elements::FluidEleCalc<distype, enrtype>::sysmat(
       iquad != intpoints.end(); ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
 
     //----------------------------------------------------------------------
     //  evaluation of various values at integration point:
@@ -1681,8 +1681,42 @@ void Discret::Elements::FluidEleCalc<distype, enrtype>::eval_shape_func_and_deri
       Core::FE::Nurbs::nurbs_get_funct_deriv(funct_, deriv_, xsi_, myknots_, weights_, distype);
   }
 
-  //
+  eval_global_derivs_at_int_point(gpweight);
+}
+
+/*----------------------------------------------------------------------*
+ | evaluate shape functions and derivatives at integr. point of a rule  |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Discret::Elements::Fluid::EnrichmentType enrtype>
+void Discret::Elements::FluidEleCalc<distype, enrtype>::eval_shape_func_and_derivs_at_int_point(
+    const Core::FE::GaussIntegration& intpoints,           // integration rule
+    const Core::FE::GaussIntegration::const_iterator& iquad  // actual integration point
+)
+{
+  if (not is_tabulated_int_point(intpoints, *iquad))
+  {
+    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    return;
+  }
+
+  // shape functions and their derivatives are identical for all elements of this type
+  xsi_ = shape_function_table_.xsi[*iquad];
+  funct_ = shape_function_table_.funct[*iquad];
+  deriv_ = shape_function_table_.deriv[*iquad];
+  derxy2_.clear();
+  if (is_higher_order_ele_) deriv2_ = shape_function_table_.deriv2[*iquad];
+
+  eval_global_derivs_at_int_point(iquad.weight());
+}
 
+/*----------------------------------------------------------------------*
+ | evaluate Jacobian and global derivatives at integr. point            |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Discret::Elements::Fluid::EnrichmentType enrtype>
+void Discret::Elements::FluidEleCalc<distype, enrtype>::eval_global_derivs_at_int_point(
+    double gpweight  // actual integration point (weight)
+)
+{
   // get Jacobian matrix and determinant
   // actually compute its transpose....
   /*
@@ -1725,6 +1759,54 @@ void Discret::Elements::FluidEleCalc<distype, enrtype>::eval_shape_func_and_deri
   return;
 }
 
+/*----------------------------------------------------------------------*
+ | check for integration point of tabulated standard integration rule   |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Discret::Elements::Fluid::EnrichmentType enrtype>
+bool Discret::Elements::FluidEleCalc<distype, enrtype>::is_tabulated_int_point(
+    const Core::FE::GaussIntegration& intpoints,  // integration rule
+    int iquad                                     // index of integration point
+)
+{
+  // only the standard integration rule of the element is tabulated, other rules (e.g. of cut
+  // elements) are evaluated directly
+  const std::shared_ptr<Core::FE::GaussPoints> gausspoints = intpoints.points();
+  if (isNurbs_ or gausspoints == nullptr or gausspoints != intpoints_.points()) return false;
+
+  // (re-)tabulate shape functions if the standard integration rule changed or second derivatives
+  // are needed, but not yet tabulated
+  const int numgp = gausspoints->num_points();
+  if (shape_function_table_.gausspoints != gausspoints or
+      static_cast<int>(shape_function_table_.xsi.size()) != numgp or
+      (is_higher_order_ele_ and not shape_function_table_.has_deriv2))
+  {
+    shape_function_table_.gausspoints = gausspoints;
+    shape_function_table_.has_deriv2 = is_higher_order_ele_;
+    shape_function_table_.xsi.resize(numgp);
+    shape_function_table_.funct.resize(numgp);
+    shape_function_table_.deriv.resize(numgp);
+    shape_function_table_.deriv2.resize(is_higher_order_ele_ ? numgp : 0);
+
+    for (int q = 0; q < numgp; ++q)
+    {
+      Core::LinAlg::Matrix<nsd_, 1>& xsi = shape_function_table_.xsi[q];
+      for (int idim = 0; idim < nsd_; idim++) xsi(idim) = gausspoints->point(q)[idim];
+
+      Core::FE::shape_function<distype>(xsi, shape_function_table_.funct[q]);
+      Core::FE::shape_function_deriv1<distype>(xsi, shape_function_table_.deriv[q]);
+      if (is_higher_order_ele_)
+        Core::FE::shape_function_deriv2<distype>(xsi, shape_function_table_.deriv2[q]);
+    }
+  }
+
+  // the coordinates are compared in addition to detect rules that were modified in place
+  const double* gpcoord = gausspoints->point(iquad);
+  for (int idim = 0; idim < nsd_; idim++)
+    if (shape_function_table_.xsi[iquad](idim) != gpcoord[idim]) return false;
+
+  return true;
+}
+
 /*---------------------------------------------------------------------------*
  | get ALE grid displacements and grid velocity for element     schott 11/14 |
  *---------------------------------------------------------------------------*/
@@ -5998,7 +6080,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::integrate_shape_function(
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
 
     for (int ui = 0; ui < nen_; ++ui)  // loop rows  (test functions)
     {
@@ -6043,7 +6125,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::calc_div_op(Discret::Elem
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     for (int nodes = 0; nodes < nen_; nodes++)  // loop over nodes
     {
@@ -6102,7 +6184,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::vel_gradient_projection(
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     vderxy_.multiply_nt(evel, derxy_);
 
@@ -6176,7 +6258,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::pres_gradient_projection(
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     gradp_.multiply(derxy_, epres);
 
@@ -6401,7 +6483,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::compute_error(Discret::El
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
 
     // get velocity at integration point
     // (values at n+alpha_F for generalized-alpha scheme, n+1 otherwise)
@@ -7401,7 +7483,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::calc_dissipation(Fluid* e
     //---------------------------------------------------------------
     // evaluate shape functions and derivatives at integration point
     //---------------------------------------------------------------
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     // get velocity at integration point
     // (values at n+alpha_F for generalized-alpha scheme, n+1 otherwise)
@@ -8544,7 +8626,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::calc_mass_matrix(
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     for (int ui = 0; ui < nen_; ++ui)
     {
@@ -8619,7 +8701,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::calc_mass_matrix(
         ++iquad)
     {
       // evaluate shape functions and derivatives at integration point
-      eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+      eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
       for (int ui = 0; ui < nen_; ++ui)
       {
@@ -9478,7 +9560,7 @@ int Discret::Elements::FluidEleCalc<distype, enrtype>::calc_mass_flow_periodic_h
       ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints_, iquad);
 
     // create dummy matrices
     Core::LinAlg::Matrix<nsd_, nen_> mat1(true);
@@ -11259,7 +11341,7 @@ void Discret::Elements::FluidEleCalc<distype, enrtype>::sysmat_ost_new(
       iquad != intpoints.end(); ++iquad)
   {
     // evaluate shape functions and derivatives at integration point
-    eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+    eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
 
     //----------------------------------------------------------------------
     //  evaluation of various values at integration point:
@@ -600,6 +600,25 @@ namespace Discret
           double gpweight          ///< actual integration point (weight)
       );
 
+      //! brief evaluate shape functions and their derivatives at integration point of a rule,
+      //! the shape functions are taken from a table for the standard integration rule
+      virtual void eval_shape_func_and_derivs_at_int_point(
+          const Core::FE::GaussIntegration& intpoints,            ///< integration rule
+          const Core::FE::GaussIntegration::const_iterator& iquad  ///< actual integration point
+      );
+
+      //! evaluate Jacobian, integration factor and global derivatives at integration point
+      void eval_global_derivs_at_int_point(
+          double gpweight  ///< actual integration point (weight)
+      );
+
+      //! check whether an integration point belongs to the tabulated standard integration rule of
+      //! this element type (tabulates the shape functions if necessary)
+      bool is_tabulated_int_point(
+          const Core::FE::GaussIntegration& intpoints,  ///< integration rule
+          int iquad                                     ///< index of integration point
+      );
+
       //! get ALE grid displacements and grid velocity for element
       void get_grid_disp_vel_ale(Core::FE::Discretization& discretization,
           const std::vector<int>& lm, Core::LinAlg::Matrix<nsd_, nen_>& edispnp,
@@ -1294,6 +1313,24 @@ namespace Discret
       std::vector<Core::LinAlg::SerialDenseVector> myknots_;
       //! Gaussian integration points
       Core::FE::GaussIntegration intpoints_;
+      //! shape functions and derivatives w.r.t r,s,t tabulated at the standard integration points
+      //! (elements are still evaluated one at a time, the table only avoids re-evaluating the
+      //! polynomials for every element)
+      struct ShapeFunctionTable
+      {
+        //! tabulated integration rule
+        std::shared_ptr<Core::FE::GaussPoints> gausspoints;
+        //! whether second derivatives are tabulated (see is_higher_order_ele_)
+        bool has_deriv2 = false;
+        //! tabulated coordinates of the integration points
+        std::vector<Core::LinAlg::Matrix<nsd_, 1>> xsi;
+        //! shape functions at integration points
+        std::vector<Core::LinAlg::Matrix<nen_, 1>> funct;
+        //! first derivatives w.r.t r,s,t at integration points
+        std::vector<Core::LinAlg::Matrix<nsd_, nen_>> deriv;
+        //! second derivatives w.r.t r,s,t at integration points (if has_deriv2)
+        std::vector<Core::LinAlg::Matrix<numderiv2_, nen_>> deriv2;
+      } shape_function_table_;
       //! identify elements of inflow section
       //! required for turbulence modeling
       bool is_inflow_ele_;
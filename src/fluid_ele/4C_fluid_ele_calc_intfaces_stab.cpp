@@ -205,6 +205,24 @@ Discret::Elements::FluidIntFaceStab* Discret::Elements::FluidIntFaceStab::impl(
   return nullptr;
 }
 
+std::map<std::string, int> Discret::Elements::FluidIntFaceStab::face_geometry_cache_generations_;
+
+//-----------------------------------------------------------------
+//   invalidate the cached face geometry data of a discretization
+//-----------------------------------------------------------------
+void Discret::Elements::FluidIntFaceStab::clear_face_geometry_cache(
+    const Core::FE::Discretization& discretization)
+{
+  face_geometry_cache_generations_[discretization.name()]++;
+}
+
+int Discret::Elements::FluidIntFaceStab::face_geometry_cache_generation(
+    const std::string& discretization_name)
+{
+  const auto generation = face_geometry_cache_generations_.find(discretization_name);
+  return generation == face_geometry_cache_generations_.end() ? 0 : generation->second;
+}
+
 template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
 Discret::Elements::FluidInternalSurfaceStab<distype, pdistype, ndistype>*
 Discret::Elements::FluidInternalSurfaceStab<distype, pdistype, ndistype>::instance(
@@ -870,157 +888,95 @@ int Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
 
 
 
-  //--------------------------------------------------
-  // compute element length w.r.t patch of master and slave parent element
-
-  // compute the element length w.r.t master and slave element
-  compute_patch_hk(pele, nele, intface, fldintfacepara.eos_element_length());
-
+  //------------------------------------------------------------------
+  // set flags
 
-  //--------------------------------------------------
-  // compute velocity norm patch of master and slave parent element
-  double max_vel_L2_norm = 0.0;
+  bool use2ndderiv = false;  // do we stabilize the 2nd order derivatives in u and p for this face?
 
-  if (fldintfacepara.physical_type() != Inpar::FLUID::stokes)
+  if (!GP_visc and !GP_trans and GP_u_p_2nd)
   {
-    // get the L_inf-norm of the parent's element velocity for stabilization
-    max_vel_L2_norm = std::max(peconvvelaf_.norm_inf(), neconvvelaf_.norm_inf());
+    FOUR_C_THROW(
+        "do you really want to neglect the gradient based ghost penalty term but stabilize the 2nd "
+        "order derivatives?");
   }
-
-
-  //--------------------------------------------------
-  // transform the face's Gaussian points to both parent elements
-
-  // local coordinates of the face's gausspoints w.r.t parent and neighbor element
-  p_xi_points_.putScalar(0.0);
-  n_xi_points_.putScalar(0.0);
-  face_xi_points_master_.putScalar(0.0);
-  face_xi_points_slave_.putScalar(0.0);
-
-  //------------------------
-  // local coordinates of the face nodes w.r.t slave side
-  Core::LinAlg::Matrix<facensd_, iel> local_slave_coordinates_trafo(true);
-
-  const std::vector<int>& localtrafomap = intface->get_local_trafo_map();
-
-
-  for (int i = 0; i < iel; i++)
+  else if (ishigherorder_ and
+           ((pdistype == Core::FE::CellType::hex8 and ndistype == Core::FE::CellType::hex8) or
+               (pdistype == Core::FE::CellType::quad4 and ndistype == Core::FE::CellType::quad4)))
   {
-    const int localtrafomap_idx = localtrafomap[i];
-
-    for (int isd = 0; isd < facensd_; isd++)
-    {
-      switch (distype)
-      {
-        case Core::FE::CellType::line2:
-        case Core::FE::CellType::line3:
-        {
-          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
-              Core::FE::eleNodeNumbering_line3_nodes_reference[i][isd];
-          break;
-        }
-        case Core::FE::CellType::tri3:
-        case Core::FE::CellType::tri6:
-        {
-          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
-              Core::FE::eleNodeNumbering_tri6_nodes_reference[i][isd];
-          break;
-        }
-        case Core::FE::CellType::quad4:
-        case Core::FE::CellType::quad8:
-        case Core::FE::CellType::quad9:
-        {
-          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
-              Core::FE::eleNodeNumbering_quad9_nodes_reference[i][isd];
-          break;
-        }
-        default:
-          FOUR_C_THROW("intface type not supported %d", distype);
-          break;
-      }
-    }
+    // allow only gradient-based ghost-penalties for hex8 or quad4 elements
   }
-
-  //------------------------
-  // coordinates of all integration points as with local coordinates w.r.t the respective local side
-  // of the respective parent element
-  for (unsigned int q = 0; q < numgp_; q++)
+  else if (ishigherorder_ and (GP_visc or GP_trans) and !GP_u_p_2nd)
   {
-    Core::LinAlg::Matrix<facensd_, 1> face_xi_points_master_linalg(true);
-    Core::LinAlg::Matrix<facensd_, 1> face_xi_points_slave_linalg(true);
+    // however, force the 2nd order ghost-penalties for real higher order elements (hex20, hex 27
+    // etc)
+    FOUR_C_THROW("you should switch on the 2nd order ghost penalty terms for u and p!");
+  }
 
+  if (ishigherorder_ and GP_u_p_2nd) use2ndderiv = true;
 
-    // Gaussian point in face's element's local coordinates w.r.t master element
-    const double* gpcoord = intpoints_->point(q);
-    for (int idim = 0; idim < facensd_; idim++)
-    {
-      face_xi_points_master_(q, idim) = gpcoord[idim];
-      face_xi_points_master_linalg(idim) = gpcoord[idim];
-    }
 
-    // transform the local coordinates from the local coordinate system of the face w.r.t master
-    // face to the local coordinate system of the face w.r.t slave face
-    Core::FE::shape_function<distype>(face_xi_points_master_linalg, funct_);
+  //--------------------------------------------------
+  // check whether the geometry data of this face from a previous evaluation can be reused, i.e.,
+  // whether the node positions of both parent elements did not change since then
 
-    face_xi_points_slave_linalg.multiply(local_slave_coordinates_trafo, funct_);
+  FaceGeometryData* face_geometry = nullptr;
+  bool reuse_face_geometry = false;
 
-    for (int idim = 0; idim < facensd_; idim++)
+  if (fldintfacepara.cache_face_geometry())
+  {
+    // drop data of all faces of this discretization if it has been invalidated in the meantime
+    FaceGeometryCache& cache = face_geometry_cache_[discretization.name()];
+    const int generation = face_geometry_cache_generation(discretization.name());
+    if (cache.generation != generation)
     {
-      face_xi_points_slave_(q, idim) = face_xi_points_slave_linalg(idim);
+      cache.faces.clear();
+      cache.generation = generation;
     }
+
+    face_geometry = &cache.faces[intface->id()];
+    reuse_face_geometry = is_face_geometry_data_valid(*face_geometry, pele->id(), nele->id(),
+        use2ndderiv, fldintfacepara.eos_element_length());
   }
 
-  //------------------------
-  // transform the 2D gaussian point coordinates on the parent element's face to local coordinates
-  // of the parent element
-  if (nsd_ == 3)
-  {
-    // get the local gp coordinates w.r.t parent (master) element
-    Core::FE::boundary_gp_to_parent_gp3(
-        p_xi_points_, face_xi_points_master_, pdistype, distype, intface->face_master_number());
 
-    // get the local gp coordinates w.r.t parent (master) element
-    Core::FE::boundary_gp_to_parent_gp3(
-        n_xi_points_, face_xi_points_slave_, ndistype, distype, intface->face_slave_number());
-  }
-  else if (nsd_ == 2)
-  {
-    // get the local gp coordinates w.r.t parent (master) element
-    Core::FE::boundary_gp_to_parent_gp2(
-        p_xi_points_, face_xi_points_master_, pdistype, distype, intface->face_master_number());
+  //--------------------------------------------------
+  // compute element length w.r.t patch of master and slave parent element
 
-    // get the local gp coordinates w.r.t neighbor (slave) element
-    Core::FE::boundary_gp_to_parent_gp2(
-        n_xi_points_, face_xi_points_slave_, ndistype, distype, intface->face_slave_number());
+  if (reuse_face_geometry)
+  {
+    p_hk_ = face_geometry->p_hk;
+    p_hk_squared_ = p_hk_ * p_hk_;
+    p_hk_cubed_ = p_hk_ * p_hk_squared_;
   }
   else
-    FOUR_C_THROW("invalid nsd");
+  {
+    // compute the element length w.r.t master and slave element
+    compute_patch_hk(pele, nele, intface, fldintfacepara.eos_element_length());
+  }
 
-  //------------------------------------------------------------------
-  // set flags
 
-  bool use2ndderiv = false;  // do we stabilize the 2nd order derivatives in u and p for this face?
+  //--------------------------------------------------
+  // compute velocity norm patch of master and slave parent element
+  double max_vel_L2_norm = 0.0;
 
-  if (!GP_visc and !GP_trans and GP_u_p_2nd)
-  {
-    FOUR_C_THROW(
-        "do you really want to neglect the gradient based ghost penalty term but stabilize the 2nd "
-        "order derivatives?");
-  }
-  else if (ishigherorder_ and
-           ((pdistype == Core::FE::CellType::hex8 and ndistype == Core::FE::CellType::hex8) or
-               (pdistype == Core::FE::CellType::quad4 and ndistype == Core::FE::CellType::quad4)))
+  if (fldintfacepara.physical_type() != Inpar::FLUID::stokes)
   {
-    // allow only gradient-based ghost-penalties for hex8 or quad4 elements
+    // get the L_inf-norm of the parent's element velocity for stabilization
+    max_vel_L2_norm = std::max(peconvvelaf_.norm_inf(), neconvvelaf_.norm_inf());
   }
-  else if (ishigherorder_ and (GP_visc or GP_trans) and !GP_u_p_2nd)
+
+
+  //--------------------------------------------------
+  // transform the face's Gaussian points to both parent elements
+
+  if (!reuse_face_geometry)
   {
-    // however, force the 2nd order ghost-penalties for real higher order elements (hex20, hex 27
-    // etc)
-    FOUR_C_THROW("you should switch on the 2nd order ghost penalty terms for u and p!");
-  }
+    compute_parent_gauss_point_coordinates(intface);
 
-  if (ishigherorder_ and GP_u_p_2nd) use2ndderiv = true;
+    if (face_geometry != nullptr)
+      initialize_face_geometry_data(*face_geometry, pele->id(), nele->id(), use2ndderiv,
+          fldintfacepara.eos_element_length());
+  }
 
 
   //------------------------------------------------------------------
@@ -1032,21 +988,30 @@ int Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
     TEUCHOS_FUNC_TIME_MONITOR("XFEM::Edgestab EOS: gauss point loop");
 
     //-----------------------------------------------------
+    // evaluate the shape functions at the integration point or restore them from the cache
+    double fac = 0.0;
 
-    for (int idim = 0; idim < facensd_; idim++)
+    if (reuse_face_geometry)
     {
-      face_xi_gp_(idim) = face_xi_points_master_(iquad, idim);
+      fac = restore_face_geometry_at_int_point(*face_geometry, iquad);
     }
-    for (int idim = 0; idim < nsd_; idim++)
+    else
     {
-      p_xi_gp_(idim) = p_xi_points_(iquad, idim);
-      n_xi_gp_(idim) = n_xi_points_(iquad, idim);
-    }
+      for (int idim = 0; idim < facensd_; idim++)
+      {
+        face_xi_gp_(idim) = face_xi_points_master_(iquad, idim);
+      }
+      for (int idim = 0; idim < nsd_; idim++)
+      {
+        p_xi_gp_(idim) = p_xi_points_(iquad, idim);
+        n_xi_gp_(idim) = n_xi_points_(iquad, idim);
+      }
 
-    //-----------------------------------------------------
-    // evaluate the shape functions at the integration point
-    const double fac = eval_shape_func_and_derivs_at_int_point(intpoints_->weight(iquad),
-        face_xi_gp_, p_xi_gp_, n_xi_gp_, pele->id(), nele->id(), use2ndderiv);
+      fac = eval_shape_func_and_derivs_at_int_point(intpoints_->weight(iquad), face_xi_gp_,
+          p_xi_gp_, n_xi_gp_, pele->id(), nele->id(), use2ndderiv);
+
+      if (face_geometry != nullptr) store_face_geometry_at_int_point(*face_geometry, iquad, fac);
+    }
 
 
     //-----------------------------------------------------
@@ -1579,6 +1544,228 @@ void Discret::Elements::FluidInternalSurfaceStab<distype, pdistype, ndistype>::g
 }
 
 
+/*----------------------------------------------------------------------*
+ | transform the face's Gaussian points to both parent elements         |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
+void Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
+    ndistype>::compute_parent_gauss_point_coordinates(Discret::Elements::FluidIntFace*
+        intface  ///< internal face element
+)
+{
+  // local coordinates of the face's gausspoints w.r.t parent and neighbor element
+  p_xi_points_.putScalar(0.0);
+  n_xi_points_.putScalar(0.0);
+  face_xi_points_master_.putScalar(0.0);
+  face_xi_points_slave_.putScalar(0.0);
+
+  //------------------------
+  // local coordinates of the face nodes w.r.t slave side
+  Core::LinAlg::Matrix<facensd_, iel> local_slave_coordinates_trafo(true);
+
+  const std::vector<int>& localtrafomap = intface->get_local_trafo_map();
+
+
+  for (int i = 0; i < iel; i++)
+  {
+    const int localtrafomap_idx = localtrafomap[i];
+
+    for (int isd = 0; isd < facensd_; isd++)
+    {
+      switch (distype)
+      {
+        case Core::FE::CellType::line2:
+        case Core::FE::CellType::line3:
+        {
+          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
+              Core::FE::eleNodeNumbering_line3_nodes_reference[i][isd];
+          break;
+        }
+        case Core::FE::CellType::tri3:
+        case Core::FE::CellType::tri6:
+        {
+          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
+              Core::FE::eleNodeNumbering_tri6_nodes_reference[i][isd];
+          break;
+        }
+        case Core::FE::CellType::quad4:
+        case Core::FE::CellType::quad8:
+        case Core::FE::CellType::quad9:
+        {
+          local_slave_coordinates_trafo(isd, localtrafomap_idx) =
+              Core::FE::eleNodeNumbering_quad9_nodes_reference[i][isd];
+          break;
+        }
+        default:
+          FOUR_C_THROW("intface type not supported %d", distype);
+          break;
+      }
+    }
+  }
+
+  //------------------------
+  // coordinates of all integration points as with local coordinates w.r.t the respective local side
+  // of the respective parent element
+  for (unsigned int q = 0; q < numgp_; q++)
+  {
+    Core::LinAlg::Matrix<facensd_, 1> face_xi_points_master_linalg(true);
+    Core::LinAlg::Matrix<facensd_, 1> face_xi_points_slave_linalg(true);
+
+
+    // Gaussian point in face's element's local coordinates w.r.t master element
+    const double* gpcoord = intpoints_->point(q);
+    for (int idim = 0; idim < facensd_; idim++)
+    {
+      face_xi_points_master_(q, idim) = gpcoord[idim];
+      face_xi_points_master_linalg(idim) = gpcoord[idim];
+    }
+
+    // transform the local coordinates from the local coordinate system of the face w.r.t master
+    // face to the local coordinate system of the face w.r.t slave face
+    Core::FE::shape_function<distype>(face_xi_points_master_linalg, funct_);
+
+    face_xi_points_slave_linalg.multiply(local_slave_coordinates_trafo, funct_);
+
+    for (int idim = 0; idim < facensd_; idim++)
+    {
+      face_xi_points_slave_(q, idim) = face_xi_points_slave_linalg(idim);
+    }
+  }
+
+  //------------------------
+  // transform the 2D gaussian point coordinates on the parent element's face to local coordinates
+  // of the parent element
+  if (nsd_ == 3)
+  {
+    // get the local gp coordinates w.r.t parent (master) element
+    Core::FE::boundary_gp_to_parent_gp3(
+        p_xi_points_, face_xi_points_master_, pdistype, distype, intface->face_master_number());
+
+    // get the local gp coordinates w.r.t parent (master) element
+    Core::FE::boundary_gp_to_parent_gp3(
+        n_xi_points_, face_xi_points_slave_, ndistype, distype, intface->face_slave_number());
+  }
+  else if (nsd_ == 2)
+  {
+    // get the local gp coordinates w.r.t parent (master) element
+    Core::FE::boundary_gp_to_parent_gp2(
+        p_xi_points_, face_xi_points_master_, pdistype, distype, intface->face_master_number());
+
+    // get the local gp coordinates w.r.t neighbor (slave) element
+    Core::FE::boundary_gp_to_parent_gp2(
+        n_xi_points_, face_xi_points_slave_, ndistype, distype, intface->face_slave_number());
+  }
+  else
+    FOUR_C_THROW("invalid nsd");
+}
+
+/*----------------------------------------------------------------------*
+ | check whether cached face geometry data can be reused                |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
+bool Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
+    ndistype>::is_face_geometry_data_valid(const FaceGeometryData& face_geometry, int master_eid,
+    int slave_eid, bool use2ndderiv, Inpar::FLUID::EosElementLength eos_element_length) const
+{
+  if (face_geometry.fac.size() != numgp_) return false;
+
+  if (face_geometry.master_eid != master_eid or face_geometry.slave_eid != slave_eid or
+      face_geometry.use2ndderiv != use2ndderiv or
+      face_geometry.eos_element_length != eos_element_length)
+    return false;
+
+  // the geometry data is only valid for exactly the same node positions (including ALE
+  // displacements) of both parent elements
+  for (int i = 0; i < piel; ++i)
+    for (int j = 0; j < nsd_; ++j)
+      if (face_geometry.pxyze(j, i) != pxyze_(j, i)) return false;
+
+  for (int i = 0; i < niel; ++i)
+    for (int j = 0; j < nsd_; ++j)
+      if (face_geometry.nxyze(j, i) != nxyze_(j, i)) return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | reset cached face geometry data for the current parent elements      |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
+void Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
+    ndistype>::initialize_face_geometry_data(FaceGeometryData& face_geometry, int master_eid,
+    int slave_eid, bool use2ndderiv, Inpar::FLUID::EosElementLength eos_element_length)
+{
+  face_geometry.master_eid = master_eid;
+  face_geometry.slave_eid = slave_eid;
+  face_geometry.use2ndderiv = use2ndderiv;
+  face_geometry.eos_element_length = eos_element_length;
+  face_geometry.pxyze = pxyze_;
+  face_geometry.nxyze = nxyze_;
+  face_geometry.p_hk = p_hk_;
+
+  face_geometry.fac.resize(numgp_);
+  face_geometry.n.resize(numgp_);
+  face_geometry.funct.resize(numgp_);
+  face_geometry.pfunct.resize(numgp_);
+  face_geometry.nfunct.resize(numgp_);
+  face_geometry.pderxy.resize(numgp_);
+  face_geometry.nderxy.resize(numgp_);
+  face_geometry.pderxy2.resize(use2ndderiv ? numgp_ : 0);
+  face_geometry.nderxy2.resize(use2ndderiv ? numgp_ : 0);
+}
+
+/*----------------------------------------------------------------------*
+ | store face geometry data at integr. point                            |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
+void Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
+    ndistype>::store_face_geometry_at_int_point(FaceGeometryData& face_geometry,
+    unsigned int iquad, double fac) const
+{
+  face_geometry.fac[iquad] = fac;
+  face_geometry.n[iquad] = n_;
+  face_geometry.funct[iquad] = funct_;
+  face_geometry.pfunct[iquad] = pfunct_;
+  face_geometry.nfunct[iquad] = nfunct_;
+  face_geometry.pderxy[iquad] = pderxy_;
+  face_geometry.nderxy[iquad] = nderxy_;
+
+  if (face_geometry.use2ndderiv)
+  {
+    face_geometry.pderxy2[iquad] = pderxy2_;
+    face_geometry.nderxy2[iquad] = nderxy2_;
+  }
+}
+
+/*----------------------------------------------------------------------*
+ | restore face geometry data at integr. point                          |
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Core::FE::CellType pdistype, Core::FE::CellType ndistype>
+double Discret::Elements::FluidInternalSurfaceStab<distype, pdistype,
+    ndistype>::restore_face_geometry_at_int_point(const FaceGeometryData& face_geometry,
+    unsigned int iquad)
+{
+  n_ = face_geometry.n[iquad];
+  funct_ = face_geometry.funct[iquad];
+  pfunct_ = face_geometry.pfunct[iquad];
+  nfunct_ = face_geometry.nfunct[iquad];
+  pderxy_ = face_geometry.pderxy[iquad];
+  nderxy_ = face_geometry.nderxy[iquad];
+
+  if (face_geometry.use2ndderiv)
+  {
+    pderxy2_ = face_geometry.pderxy2[iquad];
+    nderxy2_ = face_geometry.nderxy2[iquad];
+  }
+  else
+  {
+    pderxy2_.clear();
+    nderxy2_.clear();
+  }
+
+  return face_geometry.fac[iquad];
+}
+
 /*----------------------------------------------------------------------*
  | evaluate shape functions and derivatives at integr. point            |
  |                                                          schott 02/13|
@@ -17,6 +17,11 @@
 #include "4C_fluid_ele_parameter_timint.hpp"
 #include "4C_utils_singleton_owner.hpp"
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Discret
@@ -86,6 +91,25 @@ namespace Discret
 
       */
       static FluidIntFaceStab* impl(Discret::Elements::FluidIntFace* surfele);
+
+      /*!
+        \brief Clear the cached face geometry data of a discretization
+
+        The cached data of all implementations is invalidated. This has to be called whenever the
+        internal faces of the discretization are rebuilt or its nodes are moved, see parameter
+        CACHE_FACE_GEOMETRY.
+
+        \param discretization (in): discretization the internal faces belong to
+      */
+      static void clear_face_geometry_cache(const Core::FE::Discretization& discretization);
+
+     protected:
+      //! number of times the face geometry cache of a discretization has been cleared
+      static int face_geometry_cache_generation(const std::string& discretization_name);
+
+     private:
+      //! number of times the face geometry cache has been cleared (key: discretization name)
+      static std::map<std::string, int> face_geometry_cache_generations_;
     };
 
 
@@ -225,6 +249,61 @@ namespace Discret
           std::vector<double>& myngridv                    ///< slave grid velocity (ALE)
       );
 
+      //! geometry data of a face and its parent elements at all Gauss points of the face
+      struct FaceGeometryData
+      {
+        //! master parent element
+        int master_eid = -1;
+        //! slave parent element
+        int slave_eid = -1;
+        //! are 2nd order derivatives stored?
+        bool use2ndderiv = false;
+        //! definition of element length
+        Inpar::FLUID::EosElementLength eos_element_length = Inpar::FLUID::EOS_he_surf_diameter;
+
+        //! node coordinates of master and slave element the data has been evaluated for
+        Core::LinAlg::Matrix<nsd_, piel> pxyze;
+        Core::LinAlg::Matrix<nsd_, niel> nxyze;
+
+        //! element length of the patch
+        double p_hk = 0.0;
+
+        //! integration factors, normal vectors and shape functions (and their derivatives w.r.t.
+        //! the global coordinates) of face, master and slave element at the Gauss points
+        std::vector<double> fac;
+        std::vector<Core::LinAlg::Matrix<nsd_, 1>> n;
+        std::vector<Core::LinAlg::Matrix<iel, 1>> funct;
+        std::vector<Core::LinAlg::Matrix<piel, 1>> pfunct;
+        std::vector<Core::LinAlg::Matrix<niel, 1>> nfunct;
+        std::vector<Core::LinAlg::Matrix<nsd_, piel>> pderxy;
+        std::vector<Core::LinAlg::Matrix<nsd_, niel>> nderxy;
+        std::vector<Core::LinAlg::Matrix<numderiv2_p, piel>> pderxy2;
+        std::vector<Core::LinAlg::Matrix<numderiv2_n, niel>> nderxy2;
+      };
+
+      //! transform the face's Gaussian points to local coordinates of both parent elements
+      void compute_parent_gauss_point_coordinates(
+          Discret::Elements::FluidIntFace* intface  ///< internal face element
+      );
+
+      //! check whether the cached geometry data of a face is valid for the current node positions
+      //! of the parent elements
+      bool is_face_geometry_data_valid(const FaceGeometryData& face_geometry, int master_eid,
+          int slave_eid, bool use2ndderiv,
+          Inpar::FLUID::EosElementLength eos_element_length) const;
+
+      //! reset the cached geometry data of a face for the current parent elements
+      void initialize_face_geometry_data(FaceGeometryData& face_geometry, int master_eid,
+          int slave_eid, bool use2ndderiv, Inpar::FLUID::EosElementLength eos_element_length);
+
+      //! store geometry data evaluated at integr. point in the cache
+      void store_face_geometry_at_int_point(
+          FaceGeometryData& face_geometry, unsigned int iquad, double fac) const;
+
+      //! restore geometry data at integr. point from the cache and return the integration factor
+      double restore_face_geometry_at_int_point(
+          const FaceGeometryData& face_geometry, unsigned int iquad);
+
       //! evaluate shape functions and derivatives at integr. point
       double eval_shape_func_and_derivs_at_int_point(const double wquad,  ///< Gaussian weight
           const Core::LinAlg::Matrix<facensd_, 1>&
@@ -1096,6 +1175,18 @@ namespace Discret
       Core::LinAlg::Matrix<nsd_, 1> p_xi_gp_;
       Core::LinAlg::Matrix<nsd_, 1> n_xi_gp_;
 
+      //! cached geometry data of all evaluated faces of a discretization
+      struct FaceGeometryCache
+      {
+        //! generation the data belongs to, see FluidIntFaceStab::clear_face_geometry_cache()
+        int generation = 0;
+        //! geometry data of the faces (key: face id)
+        std::unordered_map<int, FaceGeometryData> faces;
+      };
+
+      //! cached face geometry data (key: discretization name)
+      std::map<std::string, FaceGeometryCache> face_geometry_cache_;
+
       // element, side, line connectivity
       // ---------------------------------------------------
       //! numbering of master's surfaces/lines w.r.t parent element
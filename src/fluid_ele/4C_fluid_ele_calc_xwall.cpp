@@ -474,6 +474,20 @@ void Discret::Elements::FluidEleCalcXWall<distype, enrtype>::
   return;
 }
 
+/*-----------------------------------------------------------------------------*
+ | Calculate shape functions at integration point of a rule                    |
+ *-----------------------------------------------------------------------------*/
+template <Core::FE::CellType distype, Discret::Elements::Fluid::EnrichmentType enrtype>
+void Discret::Elements::FluidEleCalcXWall<distype, enrtype>::
+    eval_shape_func_and_derivs_at_int_point(
+        const Core::FE::GaussIntegration& intpoints,            // integration rule
+        const Core::FE::GaussIntegration::const_iterator& iquad  // actual integration point
+    )
+{
+  // the enriched shape functions depend on the element, no tabulation
+  eval_shape_func_and_derivs_at_int_point(iquad.point(), iquad.weight());
+}
+
 /*-----------------------------------------------------------------------------*
  | Calculate shape functions at integration point                   bk 06/2014 |
  *-----------------------------------------------------------------------------*/
@@ -123,6 +123,12 @@ namespace Discret
           double gpweight          ///< actual integration point (weight)
           ) override;
 
+      //! brief evaluate shape functions and their derivatives at integration point of a rule
+      void eval_shape_func_and_derivs_at_int_point(
+          const Core::FE::GaussIntegration& intpoints,            ///< integration rule
+          const Core::FE::GaussIntegration::const_iterator& iquad  ///< actual integration point
+          ) override;
+
       //! brief evaluate shape functions and their derivatives at integration point
       virtual void eval_std_shape_func_and_derivs_at_int_point(
           const double* gpcoords,  ///< actual integration point (coords)
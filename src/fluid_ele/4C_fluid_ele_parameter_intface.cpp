@@ -47,6 +47,7 @@ Discret::Elements::FluidEleParameterIntFace::FluidEleParameterIntFace()
       EOS_whichtau_(Inpar::FLUID::EOS_tau_burman_fernandez),
       EOS_element_length_(Inpar::FLUID::EOS_he_max_dist_to_opp_surf),
       presKrylov2Dz_(false),
+      cache_face_geometry_(false),
       ghost_penalty_visc_fac_(0.0),
       ghost_penalty_trans_fac_(0.0),
       ghost_penalty_visc_(false),
@@ -137,6 +138,9 @@ void Discret::Elements::FluidEleParameterIntFace::set_face_general_fluid_paramet
   // determined via Krylov-projection
   presKrylov2Dz_ = stablist_edgebased.get<bool>("PRES_KRYLOV_2Dz");
 
+  // reuse face geometry data as long as the geometry of the face's parent elements is unchanged
+  cache_face_geometry_ = stablist_edgebased.get<bool>("CACHE_FACE_GEOMETRY");
+
   // check for reasonable combinations of non-edgebased fluid stabilizations with edge-based
   // stabilizations
   if (stabtype_ != Inpar::FLUID::stabtype_edgebased)
@@ -156,6 +156,10 @@ namespace Discret
       //! level is determined via Krylov-projection
       bool pres_krylov_2dz() const { return presKrylov2Dz_; };
 
+      //! Flag to reuse face geometry data at the Gauss points as long as the geometry of the
+      //! face's parent elements does not change
+      bool cache_face_geometry() const { return cache_face_geometry_; };
+
       //! get the viscous ghost-penalty stabilization flag
       bool is_general_ghost_penalty_visc() { return ghost_penalty_visc_; };
 
@@ -267,6 +271,8 @@ namespace Discret
       //! is determined via Krylov-projection
       bool presKrylov2Dz_;
 
+      //! flag to reuse face geometry data at the Gauss points
+      bool cache_face_geometry_;
 
       /*----------------------------------------------------*/
       //! @name general XFEM ghost penalty stabilization parameters (not individually set for each
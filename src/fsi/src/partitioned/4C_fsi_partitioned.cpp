@@ -20,6 +20,7 @@
 #include "4C_fsi_debugwriter.hpp"
 #include "4C_fsi_nox_aitken.hpp"
 #include "4C_fsi_nox_fixpoint.hpp"
+#include "4C_fsi_nox_iqnils.hpp"
 #include "4C_fsi_nox_jacobian.hpp"
 #include "4C_fsi_nox_linearsystem_gcr.hpp"
 #include "4C_fsi_nox_mpe.hpp"
@@ -337,6 +338,27 @@ void FSI::Partitioned::set_default_parameters(
       lineSearchParams.sublist("Full Step").set("Full Step", 1.0);
       break;
     }
+    case fsi_iter_stagg_IQN_ILS:
+    {
+      // interface quasi-Newton with inverse least-squares Jacobian approximation
+      set_method("ITERATIVE STAGGERED SCHEME WITH INTERFACE QUASI-NEWTON (IQN-ILS)");
+
+      nlParams.set("Jacobian", "None");
+      dirParams.set("Method", "User Defined");
+
+      Teuchos::RCP<::NOX::Direction::UserDefinedFactory> factory =
+          Teuchos::make_rcp<NOX::FSI::InterfaceQuasiNewtonFactory>();
+      dirParams.set("User Defined Direction Factory", factory);
+
+      Teuchos::ParameterList& iqnParams = dirParams.sublist("IQN-ILS");
+      iqnParams.set("omega", fsipart.get<double>("RELAX"));
+      iqnParams.set("reuse", fsipart.get<int>("IQN_REUSE"));
+      iqnParams.set("filter tolerance", fsipart.get<double>("IQN_FILTER_TOL"));
+
+      lineSearchParams.set("Method", "Full Step");
+      lineSearchParams.sublist("Full Step").set("Full Step", 1.0);
+      break;
+    }
     case fsi_basic_sequ_stagg:
     {
       // sequential coupling (no iteration!)
@@ -0,0 +1,184 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fsi_nox_iqnils.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+
+#include <NOX_Abstract_Group.H>
+#include <NOX_GlobalData.H>
+#include <Teuchos_ParameterList.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+NOX::FSI::InterfaceQuasiNewton::InterfaceQuasiNewton(
+    const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params)
+    : utils_(utils)
+{
+  Teuchos::ParameterList& iqnparams = params.sublist("IQN-ILS");
+  omega_ = iqnparams.get("omega", 1.0);
+  reuse_ = iqnparams.get("reuse", 0);
+  filtertol_ = iqnparams.get("filter tolerance", 1e-8);
+}
+
+
+
+bool NOX::FSI::InterfaceQuasiNewton::reset(
+    const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params)
+{
+  // A reset happens at the beginning of a new time step. Move the columns of
+  // the last time step to the history and forget the oldest ones.
+  if (not v_.empty() and reuse_ > 0)
+  {
+    vold_.push_front(v_);
+    wold_.push_front(w_);
+  }
+  while (static_cast<int>(vold_.size()) > reuse_)
+  {
+    vold_.pop_back();
+    wold_.pop_back();
+  }
+
+  v_.clear();
+  w_.clear();
+  rold_ = Teuchos::null;
+  xtildeold_ = Teuchos::null;
+
+  utils_ = gd->getUtils();
+  return true;
+}
+
+
+bool NOX::FSI::InterfaceQuasiNewton::compute(
+    ::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group, const ::NOX::Solver::Generic& solver)
+{
+  ::NOX::Abstract::Group::ReturnType status;
+
+  // Compute F at current solution
+  status = group.computeF();
+  if (status != ::NOX::Abstract::Group::Ok) throw_error("compute", "Unable to compute F");
+
+  // residual r = S(F(x)) - x and output of the fixed-point operator
+  const ::NOX::Abstract::Vector& x = group.getX();
+  const ::NOX::Abstract::Vector& r = group.getF();
+
+  Teuchos::RCP<::NOX::Abstract::Vector> xtilde = x.clone(::NOX::DeepCopy);
+  xtilde->update(1., r, 1.);
+
+  // new columns from the differences to the previous coupling iteration
+  if (rold_ != Teuchos::null)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> dr = r.clone(::NOX::DeepCopy);
+    dr->update(-1., *rold_, 1.);
+    Teuchos::RCP<::NOX::Abstract::Vector> dxtilde = xtilde->clone(::NOX::DeepCopy);
+    dxtilde->update(-1., *xtildeold_, 1.);
+
+    v_.push_back(dr);
+    w_.push_back(dxtilde);
+  }
+  rold_ = r.clone(::NOX::DeepCopy);
+  xtildeold_ = xtilde;
+
+  // collect all columns, newest first
+  std::vector<const ::NOX::Abstract::Vector*> vcols;
+  std::vector<const ::NOX::Abstract::Vector*> wcols;
+  for (int i = static_cast<int>(v_.size()) - 1; i >= 0; --i)
+  {
+    vcols.push_back(v_[i].get());
+    wcols.push_back(w_[i].get());
+  }
+  for (std::size_t step = 0; step < vold_.size(); ++step)
+  {
+    for (int i = static_cast<int>(vold_[step].size()) - 1; i >= 0; --i)
+    {
+      vcols.push_back(vold_[step][i].get());
+      wcols.push_back(wold_[step][i].get());
+    }
+  }
+
+  const int numcols = static_cast<int>(vcols.size());
+
+  // economy QR decomposition of V by modified Gram-Schmidt, columns that are
+  // (almost) linearly dependent on newer columns are skipped
+  std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> q;
+  std::vector<int> kept;
+  Core::LinAlg::SerialDenseMatrix rmat(numcols, numcols, true);
+  Core::LinAlg::SerialDenseVector rcol(numcols, true);
+
+  for (int j = 0; j < numcols; ++j)
+  {
+    Teuchos::RCP<::NOX::Abstract::Vector> y = vcols[j]->clone(::NOX::DeepCopy);
+    const double vnorm = y->norm();
+    if (vnorm == 0.) continue;
+
+    const int m = static_cast<int>(q.size());
+    for (int i = 0; i < m; ++i)
+    {
+      rcol(i) = y->innerProduct(*q[i]);
+      y->update(-rcol(i), *q[i], 1.);
+    }
+    const double rjj = y->norm();
+
+    // QR1 filter
+    if (rjj <= filtertol_ * vnorm) continue;
+
+    for (int i = 0; i < m; ++i) rmat(i, m) = rcol(i);
+    rmat(m, m) = rjj;
+    y->scale(1. / rjj);
+    q.push_back(y);
+    kept.push_back(j);
+  }
+
+  const int numkept = static_cast<int>(kept.size());
+
+  if (utils_->isPrintType(::NOX::Utils::InnerIteration))
+  {
+    utils_->out() << "IQN-ILS:  columns=" << numcols << "  used=" << numkept
+                  << "  |r|=" << utils_->sciformat(r.norm()) << std::endl;
+  }
+
+  // plain relaxed fixed-point step if there is no information yet
+  if (numkept == 0)
+  {
+    dir.update(omega_, r, 0.);
+    return true;
+  }
+
+  // solve R c = -Q^T r by back substitution
+  Core::LinAlg::SerialDenseVector c(numkept, true);
+  for (int i = numkept - 1; i >= 0; --i)
+  {
+    double ci = -r.innerProduct(*q[i]);
+    for (int j = i + 1; j < numkept; ++j) ci -= rmat(i, j) * c(j);
+    c(i) = ci / rmat(i, i);
+  }
+
+  // quasi-Newton update x_new = xtilde + W c, i.e. direction r + W c
+  dir.update(1., r, 0.);
+  for (int i = 0; i < numkept; ++i) dir.update(c(i), *wcols[kept[i]], 1.);
+
+  return true;
+}
+
+
+bool NOX::FSI::InterfaceQuasiNewton::compute(::NOX::Abstract::Vector& dir,
+    ::NOX::Abstract::Group& group, const ::NOX::Solver::LineSearchBased& solver)
+{
+  return ::NOX::Direction::Generic::compute(dir, group, solver);
+}
+
+
+void NOX::FSI::InterfaceQuasiNewton::throw_error(
+    const std::string& functionName, const std::string& errorMsg)
+{
+  if (utils_->isPrintType(::NOX::Utils::Error))
+    utils_->err() << "InterfaceQuasiNewton::" << functionName << " - " << errorMsg << std::endl;
+  throw "NOX Error";
+}
+
+FOUR_C_NAMESPACE_CLOSE
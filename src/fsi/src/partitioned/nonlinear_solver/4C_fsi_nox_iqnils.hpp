@@ -0,0 +1,154 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FSI_NOX_IQNILS_HPP
+#define FOUR_C_FSI_NOX_IQNILS_HPP
+
+#include "4C_config.hpp"
+
+#include <NOX_Abstract_Vector.H>
+#include <NOX_Direction_Generic.H>  // base class
+#include <NOX_Direction_UserDefinedFactory.H>
+#include <NOX_GlobalData.H>
+#include <NOX_Utils.H>
+#include <Teuchos_RCP.hpp>
+
+#include <deque>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace NOX
+{
+  namespace FSI
+  {
+    //! %Interface quasi-Newton direction with inverse least-squares Jacobian (IQN-ILS).
+    /*!
+
+      The partitioned FSI problem is the fixed-point problem \f$ \tilde x = S(F(x)) \f$
+      with the residual \f$ r = \tilde x - x \f$ provided by the group. The
+      inverse of the Jacobian of the residual is approximated from the
+      differences of the residuals \f$ V = [\Delta r_i] \f$ and of the fixed-point
+      operator outputs \f$ W = [\Delta \tilde x_i] \f$ of previous coupling
+      iterations. The new iterate is
+
+      \f[
+        x_{k+1} = \tilde x_k + W c, \quad c = \arg\min_c \| V c + r_k \|,
+      \f]
+
+      i.e. the direction is \f$ r_k + W c \f$ and has to be used with a full step.
+
+      The columns of the previous time steps are kept and reused in the
+      following time steps. The least-squares problem is solved by a QR
+      decomposition of V (modified Gram-Schmidt, newest columns first).
+      Columns that are (almost) linearly dependent on newer columns are
+      skipped (QR1 filter). Without any columns, i.e. in the first coupling
+      iteration of the first time step, a relaxed fixed-point step is done.
+
+      A new time step is detected when the direction is reset, which happens
+      whenever a new nonlinear solver is built.
+
+    <h2>Parameters</h2>
+
+      - "omega" - relaxation parameter of fixed-point steps without columns
+                  (defaults to 1.0)
+
+      - "reuse" - number of previous time steps whose columns are reused
+                  (defaults to 0)
+
+      - "filter tolerance" - relative tolerance of the QR1 filter
+                             (defaults to 1e-8)
+
+    <h2>References</h2>
+
+    J. Degroote, K.-J. Bathe, J. Vierendeels: Performance of a new partitioned
+    procedure versus a monolithic procedure in fluid-structure interaction.
+    Computers & Structures 87(11-12): 793-801, 2009.
+    doi:10.1016/j.compstruc.2008.11.013
+    */
+    class InterfaceQuasiNewton : public ::NOX::Direction::Generic
+    {
+     public:
+      //! Constructor
+      InterfaceQuasiNewton(const Teuchos::RCP<::NOX::Utils>& utils, Teuchos::ParameterList& params);
+
+
+      // derived
+      bool reset(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& grp,
+          const ::NOX::Solver::Generic& solver) override;
+
+      // derived
+      bool compute(::NOX::Abstract::Vector& dir, ::NOX::Abstract::Group& group,
+          const ::NOX::Solver::LineSearchBased& solver) override;
+
+     private:
+      //! Print error message and throw error
+      void throw_error(const std::string& functionName, const std::string& errorMsg);
+
+      //! Printing Utils
+      Teuchos::RCP<::NOX::Utils> utils_;
+
+      //! relaxation parameter of fixed-point steps
+      double omega_;
+
+      //! number of previous time steps to reuse
+      int reuse_;
+
+      //! relative tolerance of the QR1 filter
+      double filtertol_;
+
+      //! residual of the previous coupling iteration in the current time step
+      Teuchos::RCP<::NOX::Abstract::Vector> rold_;
+
+      //! fixed-point operator output of the previous coupling iteration in the current time step
+      Teuchos::RCP<::NOX::Abstract::Vector> xtildeold_;
+
+      //! residual differences of the current time step
+      std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> v_;
+
+      //! fixed-point operator output differences of the current time step
+      std::vector<Teuchos::RCP<::NOX::Abstract::Vector>> w_;
+
+      //! residual differences of previous time steps (newest time step first)
+      std::deque<std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>> vold_;
+
+      //! fixed-point operator output differences of previous time steps (newest time step first)
+      std::deque<std::vector<Teuchos::RCP<::NOX::Abstract::Vector>>> wold_;
+    };
+
+    /// simple factory that creates the IQN-ILS direction object
+    /*!
+      The direction object is kept over all time steps such that the
+      information of previous time steps is available.
+     */
+    class InterfaceQuasiNewtonFactory : public ::NOX::Direction::UserDefinedFactory
+    {
+     public:
+      Teuchos::RCP<::NOX::Direction::Generic> buildDirection(
+          const Teuchos::RCP<::NOX::GlobalData>& gd, Teuchos::ParameterList& params) const override
+      {
+        if (iqn_ == Teuchos::null)
+          iqn_ = Teuchos::make_rcp<InterfaceQuasiNewton>(gd->getUtils(), params);
+        else
+          iqn_->reset(gd, params);
+        return iqn_;
+      }
+
+     private:
+      mutable Teuchos::RCP<InterfaceQuasiNewton> iqn_;
+    };
+
+  }  // namespace FSI
+}  // namespace NOX
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -40,7 +40,11 @@
 
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -1500,7 +1504,12 @@ void Global::read_micro_fields(Global::Problem& problem, const std::filesystem::
 
   std::set<int> my_multimat_IDs;
 
+  // number of owned elements with micro material, i.e. the number of micro problems solved by the
+  // supporting procs of this proc
+  int nummicroele = 0;
+
   // take care also of ghosted elements! -> ElementColMap!
+  // only the owned elements evaluate their micro materials and count for the load
   for (int i = 0; i < macro_dis->element_col_map()->NumMyElements(); ++i)
   {
     Core::Elements::Element* actele = macro_dis->l_col_element(i);
@@ -1524,6 +1533,7 @@ void Global::read_micro_fields(Global::Problem& problem, const std::filesystem::
     {
       Core::Mat::PAR::Parameter* actparams = actmat->parameter();
       my_multimat_IDs.insert(actparams->id());
+      if (macro_dis->element_row_map()->MyGID(actele->id())) ++nummicroele;
     }
   }
 
@@ -1548,6 +1558,17 @@ void Global::read_micro_fields(Global::Problem& problem, const std::filesystem::
   foundmyranks.resize(Core::Communication::num_mpi_ranks(lcomm), -1);
   Core::Communication::gather_all(&foundmicromatmyrank, foundmyranks.data(), 1, lcomm);
 
+  // the supporting procs are distributed according to the number of micro problems of each macro
+  // proc that needs support
+  {
+    std::vector<int> allnummicroele(Core::Communication::num_mpi_ranks(lcomm), 0);
+    Core::Communication::gather_all(&nummicroele, allnummicroele.data(), 1, lcomm);
+    std::vector<int> microweights;
+    for (std::size_t rank = 0; rank < foundmyranks.size(); ++rank)
+      if (foundmyranks[rank] != -1) microweights.push_back(allnummicroele[rank]);
+    Core::Communication::broadcast(microweights.data(), nummicromat, 0, gcomm);
+  }
+
   // determine color of macro procs with any contribution to micro material, only important for
   // procs with micro material color starts with 0 and is incremented for each group
   int color = -1;
@@ -1743,6 +1764,50 @@ void Global::read_micro_fields(Global::Problem& problem, const std::filesystem::
 }
 
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<int> Global::supporting_group_layout(
+    const std::vector<int>& microweights, int numsupportprocs)
+{
+  const int numgroups = static_cast<int>(microweights.size());
+  std::vector<int> layout(numgroups, 0);
+
+  // not enough supporting procs for all groups: the first groups get one proc each
+  if (numsupportprocs <= numgroups)
+  {
+    for (int k = 0; k < numsupportprocs; ++k) layout[k] = 1;
+    return layout;
+  }
+
+  // every group gets one proc, the remaining procs are distributed proportional to the weights
+  std::fill(layout.begin(), layout.end(), 1);
+  const int numremainingprocs = numsupportprocs - numgroups;
+
+  double sumweights = 0.0;
+  for (const int weight : microweights) sumweights += std::max(weight, 0);
+
+  std::vector<std::pair<double, int>> remainders(numgroups);
+  int assigned = numgroups;
+  for (int k = 0; k < numgroups; ++k)
+  {
+    // equal shares if no macro proc owns elements with micro material
+    const double share = (sumweights > 0.0)
+                             ? numremainingprocs * std::max(microweights[k], 0) / sumweights
+                             : static_cast<double>(numremainingprocs) / numgroups;
+    const int procs = static_cast<int>(std::floor(share));
+    layout[k] += procs;
+    remainders[k] = {share - procs, k};
+    assigned += procs;
+  }
+
+  // remaining procs go to the groups with the largest remainders, ties to the first groups
+  std::stable_sort(remainders.begin(), remainders.end(),
+      [](const auto& a, const auto& b) { return a.first > b.first; });
+  for (int k = 0; assigned < numsupportprocs; ++k, ++assigned) ++layout[remainders[k].second];
+
+  return layout;
+}
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void Global::read_microfields_np_support(Global::Problem& problem)
@@ -1756,16 +1821,15 @@ void Global::read_microfields_np_support(Global::Problem& problem)
 
   // prepare the supporting procs for a splitting of gcomm
 
-  // groups should be equally sized
-  // in a first step every macro proc that needs support gets procpergroup supporting procs
-  int procpergroup = int(floor((Core::Communication::num_mpi_ranks(lcomm)) / nummicromat));
-  std::vector<int> supgrouplayout(nummicromat, procpergroup);
-  // remaining procs are added to the groups in the beginning
-  int remainingProcs = Core::Communication::num_mpi_ranks(lcomm) - procpergroup * nummicromat;
-  for (int k = 0; k < remainingProcs; ++k)
-  {
-    supgrouplayout[k]++;
-  }
+  // receive the number of micro problems of the macro procs that need support
+  std::vector<int> microweights(nummicromat, 0);
+  Core::Communication::broadcast(microweights.data(), nummicromat, 0, gcomm);
+
+  // every group gets one supporting proc, the remaining procs are distributed proportional to the
+  // number of micro problems of the macro procs, such that macro procs with many micro problems get
+  // more supporting procs
+  std::vector<int> supgrouplayout =
+      supporting_group_layout(microweights, Core::Communication::num_mpi_ranks(lcomm));
 
   // secondly: colors are distributed
   // color starts with 0 and is incremented for each group
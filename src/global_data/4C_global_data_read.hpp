@@ -14,6 +14,7 @@
 #include "4C_io_input_file.hpp"
 
 #include <filesystem>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -34,6 +35,19 @@ namespace Global
   /// set up supporting processors for micro-scale discretizations
   void read_microfields_np_support(Global::Problem& problem);
 
+  /**
+   * Distribute @p numsupportprocs supporting procs to the macro procs with micro materials. Every
+   * macro proc gets one supporting proc, the remaining procs are distributed proportional to the
+   * number of owned elements with micro material @p microweights (largest remainder method). With
+   * equal weights, all groups have the same size up to one proc. If there are fewer supporting
+   * procs than macro procs, the first macro procs get one supporting proc each.
+   *
+   * @note The layout is fixed at setup. It balances the number of micro problems per group, not
+   * the varying cost of the individual micro problems during the simulation.
+   */
+  [[nodiscard]] std::vector<int> supporting_group_layout(
+      const std::vector<int>& microweights, int numsupportprocs);
+
   /// read global parameters
   void read_parameter(Global::Problem& problem, Core::IO::InputFile& input);
 
@@ -0,0 +1,63 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_global_data_read.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(SupportingGroupLayout, EqualWeights)
+  {
+    // remaining procs go to the first groups
+    EXPECT_EQ(Global::supporting_group_layout({4, 4}, 3), (std::vector<int>{2, 1}));
+    EXPECT_EQ(Global::supporting_group_layout({6, 6, 6}, 7), (std::vector<int>{3, 2, 2}));
+  }
+
+  TEST(SupportingGroupLayout, ProportionalToWeights)
+  {
+    EXPECT_EQ(Global::supporting_group_layout({6, 2}, 4), (std::vector<int>{3, 1}));
+    EXPECT_EQ(Global::supporting_group_layout({3, 1, 2}, 9), (std::vector<int>{4, 2, 3}));
+
+    // one proc per group, the remaining five procs have the shares 0.625, 1.25, 3.125
+    EXPECT_EQ(Global::supporting_group_layout({1, 2, 5}, 8), (std::vector<int>{2, 2, 4}));
+  }
+
+  TEST(SupportingGroupLayout, EveryGroupGetsOneProc)
+  {
+    EXPECT_EQ(Global::supporting_group_layout({1, 100}, 3), (std::vector<int>{1, 2}));
+
+    // a macro proc with only ghosted micro elements gets one proc
+    EXPECT_EQ(Global::supporting_group_layout({0, 7}, 8), (std::vector<int>{1, 7}));
+    EXPECT_EQ(Global::supporting_group_layout({0, 0}, 5), (std::vector<int>{3, 2}));
+  }
+
+  TEST(SupportingGroupLayout, FewerProcsThanGroups)
+  {
+    EXPECT_EQ(Global::supporting_group_layout({3, 5, 2}, 2), (std::vector<int>{1, 1, 0}));
+  }
+
+  TEST(SupportingGroupLayout, AllProcsAreAssigned)
+  {
+    const std::vector<int> weights = {5, 17, 1, 9, 3};
+    for (int numsupportprocs = 5; numsupportprocs < 40; ++numsupportprocs)
+    {
+      const std::vector<int> layout = Global::supporting_group_layout(weights, numsupportprocs);
+      int sum = 0;
+      for (const int procs : layout)
+      {
+        EXPECT_GE(procs, 1);
+        sum += procs;
+      }
+      EXPECT_EQ(sum, numsupportprocs);
+    }
+  }
+}  // namespace
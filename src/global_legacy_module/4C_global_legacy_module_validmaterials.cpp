@@ -1586,6 +1586,15 @@ std::shared_ptr<std::vector<std::shared_ptr<Mat::MaterialDefinition>>> Global::v
         entry<int>("MICRODIS_NUM", {.description = "Number of microscale discretization"}));
     m->add_component(
         entry<double>("INITVOL", {.description = "Initial volume of RVE", .default_value = 0.0}));
+    m->add_component(entry<double>("SURROGATE_TOL",
+        {.description = "Relative tolerance of the estimated stress error for which the response "
+                        "of previous micro simulations is extrapolated instead of running a micro "
+                        "simulation (0: no extrapolation). Only admissible for micro structures "
+                        "without history variables.",
+            .default_value = 0.0}));
+    m->add_component(entry<int>("SURROGATE_MAX_SAMPLES",
+        {.description = "Maximum number of stored micro responses used for extrapolation",
+            .default_value = 10000}));
 
     Mat::append_material_definition(matlist, m);
   }
@@ -42,9 +42,26 @@ namespace Inpar
 
       // data format for written numeric data
       Core::Utils::string_to_integral_parameter<Core::IO::OutputDataFormat>("OUTPUT_DATA_FORMAT",
-          "binary", "data format for written numeric data", tuple<std::string>("binary", "ascii"),
-          tuple<Core::IO::OutputDataFormat>(
-              Core::IO::OutputDataFormat::binary, Core::IO::OutputDataFormat::ascii),
+          "binary",
+          "data format for written numeric data: binary (inline, base64 encoded), binary_appended "
+          "(raw binary data appended to the end of the files) or ascii",
+          tuple<std::string>("binary", "binary_appended", "ascii"),
+          tuple<Core::IO::OutputDataFormat>(Core::IO::OutputDataFormat::binary,
+              Core::IO::OutputDataFormat::binary_appended, Core::IO::OutputDataFormat::ascii),
+          sublist_IO_VTK_structure);
+
+      // compression of appended binary data
+      Core::Utils::string_to_integral_parameter<Core::IO::OutputCompression>(
+          "OUTPUT_DATA_COMPRESSION", "zlib",
+          "compression of the data blocks written with OUTPUT_DATA_FORMAT binary_appended",
+          tuple<std::string>("zlib", "none"),
+          tuple<Core::IO::OutputCompression>(
+              Core::IO::OutputCompression::zlib, Core::IO::OutputCompression::none),
+          sublist_IO_VTK_structure);
+
+      Core::Utils::int_parameter("OUTPUT_DATA_COMPRESSION_LEVEL", 1,
+          "zlib compression level (1: fastest, 9: best compression) of the data blocks written "
+          "with OUTPUT_DATA_FORMAT binary_appended",
           sublist_IO_VTK_structure);
 
       // specify the maximum digits in the number of time steps that shall be written
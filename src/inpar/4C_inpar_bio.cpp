@@ -279,6 +279,11 @@ void Inpar::ReducedLung::set_valid_parameters(std::map<std::string, Core::IO::In
   Core::Utils::int_parameter("LINEAR_SOLVER", -1,
       "number of linear solver used for reduced dim arterial dynamics", redawdyn);
 
+  Core::Utils::bool_parameter("TREE_SOLVER", "no",
+      "Solve the tree-structured system of reduced lung problems by leaf-to-root elimination "
+      "instead of the linear solver given by LINEAR_SOLVER",
+      redawdyn);
+
   Core::Utils::bool_parameter(
       "SOLVESCATRA", "no", "Flag to (de)activate solving scalar transport in blood", redawdyn);
 
@@ -39,10 +39,13 @@ void Inpar::Cardiovascular0D::set_valid_parameters(std::map<std::string, Core::I
   Core::Utils::int_parameter("LINEAR_COUPLED_SOLVER", -1,
       "number of linear solver used for cardiovascular 0D-structural problems", cardvasc0dstruct);
 
-  Core::Utils::string_to_integral_parameter<Cardvasc0DSolveAlgo>("SOLALGORITHM", "direct", "",
-      tuple<std::string>("block", "direct"),
+  Core::Utils::string_to_integral_parameter<Cardvasc0DSolveAlgo>("SOLALGORITHM", "direct",
+      "direct: solve the monolithic system, block: block preconditioned iterative solve, schur: "
+      "solve the structural block for the coupling columns and eliminate the 0D dofs exactly",
+      tuple<std::string>("block", "direct", "schur"),
       tuple<Cardvasc0DSolveAlgo>(Inpar::Cardiovascular0D::cardvasc0dsolve_block,
-          Inpar::Cardiovascular0D::cardvasc0dsolve_direct),
+          Inpar::Cardiovascular0D::cardvasc0dsolve_direct,
+          Inpar::Cardiovascular0D::cardvasc0dsolve_schur),
       cardvasc0dstruct);
 
   Core::Utils::double_parameter("T_PERIOD", -1.0, "periodic time", cardvasc0dstruct);
@@ -518,6 +521,16 @@ void Inpar::Cardiovascular0D::set_valid_parameters(std::map<std::string, Core::I
 
   Core::Utils::string_parameter(
       "POD_MATRIX", "none", "filename of file containing projection matrix", mor);
+  Core::Utils::string_parameter("ECSW_WEIGHTS", "none",
+      "filename of file containing the sampled elements and weights for hyper-reduction", mor);
+  Core::Utils::bool_parameter("POD_SNAPSHOTS", false,
+      "compute a POD basis in-situ from the displacement increments of all time steps", mor);
+  Core::Utils::int_parameter(
+      "POD_SNAPSHOT_RANK", 100, "maximum number of basis vectors of the in-situ POD basis", mor);
+  Core::Utils::int_parameter(
+      "POD_SNAPSHOT_BLOCK", 10, "number of snapshots per update of the in-situ POD basis", mor);
+  Core::Utils::double_parameter("POD_SNAPSHOT_TOL", 1.0e-10,
+      "relative tolerance for the truncation of the in-situ POD basis", mor);
 
   mor.move_into_collection(list);
 }
@@ -31,6 +31,7 @@ namespace Inpar
     {
       cardvasc0dsolve_direct,  ///< build monolithic 0D cardiovascular-structural system
       cardvasc0dsolve_block,   ///< use block preconditioner for iterative solve
+      cardvasc0dsolve_schur,   ///< eliminate 0D dofs exactly by a Schur complement
     };
 
     enum Cardvasc0DAtriumModel
@@ -614,6 +614,14 @@ void Inpar::FLUID::set_valid_parameters(std::map<std::string, Core::IO::InputSpe
           EOS_he_vol_eq_diameter),
       fdyn_edge_based_stab);
 
+  //! reuse face geometry data (parent element shape functions and derivatives at the face's Gauss
+  //! points, normal vectors and element lengths) as long as the geometry is unchanged
+  Core::Utils::bool_parameter("CACHE_FACE_GEOMETRY", "No",
+      "Store the geometry data at the Gauss points of each face and reuse it in subsequent "
+      "evaluations as long as the node positions of the parent elements do not change, i.e., for "
+      "all evaluations on a non-moving mesh. Trades memory for assembly time.",
+      fdyn_edge_based_stab);
+
   fdyn_edge_based_stab.move_into_collection(list);
 
   /*----------------------------------------------------------------------*/
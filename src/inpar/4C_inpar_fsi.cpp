@@ -20,8 +20,8 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
 
   Core::Utils::SectionSpecs fsidyn{"FSI DYNAMIC"};
 
-  Teuchos::Tuple<std::string, 21> name;
-  Teuchos::Tuple<FsiCoupling, 21> label;
+  Teuchos::Tuple<std::string, 22> name;
+  Teuchos::Tuple<FsiCoupling, 22> label;
 
   name[0] = "basic_sequ_stagg";
   label[0] = fsi_basic_sequ_stagg;
@@ -65,6 +65,8 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
   label[19] = fsi_iter_sliding_monolithicstructuresplit;
   name[20] = "iter_mortar_monolithicfluidsplit_saddlepoint";
   label[20] = fsi_iter_mortar_monolithicfluidsplit_saddlepoint;
+  name[21] = "iter_stagg_IQN_ILS";
+  label[21] = fsi_iter_stagg_IQN_ILS;
 
 
   Core::Utils::string_to_integral_parameter<FsiCoupling>("COUPALGO", "iter_stagg_AITKEN_rel_param",
@@ -383,6 +385,13 @@ void Inpar::FSI::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>
 
   Core::Utils::int_parameter("ITEMAX", 100, "Maximum number of iterations over fields", fsipart);
 
+  Core::Utils::int_parameter("IQN_REUSE", 0,
+      "Number of previous time steps whose information is reused by the IQN-ILS solver", fsipart);
+
+  Core::Utils::double_parameter("IQN_FILTER_TOL", 1e-8,
+      "Relative tolerance for filtering (almost) linearly dependent columns in the IQN-ILS solver",
+      fsipart);
+
   Core::Utils::double_parameter("MAXOMEGA", 0.0,
       "largest omega allowed for Aitken relaxation (0.0 means no constraint)", fsipart);
 
@@ -57,7 +57,8 @@ typedef enum FsiCoupling
   fsi_iter_fluidfluid_monolithicfluidsplit_nonox,
   fsi_iter_sliding_monolithicfluidsplit,
   fsi_iter_sliding_monolithicstructuresplit,
-  fsi_iter_mortar_monolithicfluidsplit_saddlepoint
+  fsi_iter_mortar_monolithicfluidsplit_saddlepoint,
+  fsi_iter_stagg_IQN_ILS /*!< interface quasi-Newton with inverse least-squares Jacobian */
 } FSI_COUPLING;
 
 namespace Inpar
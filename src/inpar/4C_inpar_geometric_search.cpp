@@ -7,6 +7,7 @@
 
 #include "4C_inpar_geometric_search.hpp"
 
+#include "4C_fem_geometric_search_bvh.hpp"
 #include "4C_utils_parameter_list.hpp"
 
 FOUR_C_NAMESPACE_OPEN
@@ -28,6 +29,25 @@ void Inpar::GeometricSearch::set_valid_parameters(std::map<std::string, Core::IO
   Core::Utils::bool_parameter("WRITE_GEOMETRIC_SEARCH_VISUALIZATION", "no",
       "If visualization output for the geometric search should be written", boundingvolumestrategy);
 
+  Core::Utils::double_parameter("TREE_REFIT_MARGIN", 0.1,
+      "Bounding volumes in a persistent search tree are enlarged by this factor times their "
+      "diagonal. Bounding volumes moving within this margin only require a refit of the tree.",
+      boundingvolumestrategy);
+
+  Core::Utils::double_parameter("TREE_MAX_VOLUME_RATIO", 4.0,
+      "A persistent search tree is rebuilt once the volume of its boxes exceeds this factor times "
+      "the volume of the boxes of a rebuilt tree.",
+      boundingvolumestrategy);
+
+  Core::Utils::string_to_integral_parameter<Core::GeometricSearch::SearchExecutionSpace>(
+      "EXECUTION_SPACE", "kokkos_default",
+      "Kokkos execution space used to build and query the search tree",
+      Teuchos::tuple<std::string>("kokkos_default", "openmp"),
+      Teuchos::tuple<Core::GeometricSearch::SearchExecutionSpace>(
+          Core::GeometricSearch::SearchExecutionSpace::kokkos_default,
+          Core::GeometricSearch::SearchExecutionSpace::openmp),
+      boundingvolumestrategy);
+
   boundingvolumestrategy.move_into_collection(list);
 }
 
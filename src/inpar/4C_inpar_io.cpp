@@ -165,6 +165,20 @@ void Inpar::IO::set_valid_parameters(std::map<std::string, Core::IO::InputSpec>&
       io_every_iter);
 
   io_every_iter.move_into_collection(list);
+
+  /*----------------------------------------------------------------------*/
+  Core::Utils::SectionSpecs io_profiling{io, "PROFILING"};
+
+  Core::Utils::bool_parameter("TRACE", "No",
+      "Record hierarchical timings, counters and the memory usage of every time step and write "
+      "a trace per processor in the Chrome trace event format",
+      io_profiling);
+
+  Core::Utils::int_parameter("MAX_DEPTH", -1,
+      "Maximum nesting depth of recorded regions. If equal -1, all regions are recorded.",
+      io_profiling);
+
+  io_profiling.move_into_collection(list);
 }
 
 FOUR_C_NAMESPACE_CLOSE
@@ -55,6 +55,12 @@ void Inpar::PARTICLE::set_valid_parameters(std::map<std::string, Core::IO::Input
   Core::Utils::int_parameter("NUMSTEP", 100, "maximum number of steps", particledyn);
   Core::Utils::double_parameter("MAXTIME", 1.0, "maximum time", particledyn);
 
+  // multiple time stepping
+  Core::Utils::int_parameter("RESPA_SUBSTEPS", 1,
+      "number of sub-steps of particle interactions sub-cycled with multiple time stepping "
+      "(r-RESPA), no sub-cycling for one sub-step",
+      particledyn);
+
   // gravity acceleration control
   Core::Utils::string_parameter(
       "GRAVITY_ACCELERATION", "0.0 0.0 0.0", "acceleration due to gravity", particledyn);
@@ -65,6 +71,12 @@ void Inpar::PARTICLE::set_valid_parameters(std::map<std::string, Core::IO::Input
   Core::Utils::double_parameter("VISCOUS_DAMPING", -1.0,
       "apply viscous damping force to determine static equilibrium solutions", particledyn);
 
+  // evaluate particle pair interactions on the threads of each processor
+  Core::Utils::bool_parameter("PARALLEL_PAIR_EVALUATION", "no",
+      "evaluate particle pair interactions in parallel on the threads of each processor (with "
+      "deterministic results independent of the number of threads)",
+      particledyn);
+
   // transfer particles to new bins every time step
   Core::Utils::bool_parameter(
       "TRANSFER_EVERY", "no", "transfer particles to new bins every time step", particledyn);
@@ -436,6 +448,14 @@ void Inpar::PARTICLE::set_valid_parameters(std::map<std::string, Core::IO::Input
   Core::Utils::bool_parameter("WRITE_PARTICLE_WALL_INTERACTION", "no",
       "write particle-wall interaction output", particledyndem);
 
+  // sub-cycled interactions of multiple time stepping
+  Core::Utils::bool_parameter("RESPA_SUBCYCLE_CONTACT", "yes",
+      "sub-cycle particle contact with multiple time stepping", particledyndem);
+  Core::Utils::bool_parameter("RESPA_SUBCYCLE_WALL_CONTACT", "no",
+      "sub-cycle particle-wall contact with multiple time stepping", particledyndem);
+  Core::Utils::bool_parameter("RESPA_SUBCYCLE_ADHESION", "no",
+      "sub-cycle particle and particle-wall adhesion with multiple time stepping", particledyndem);
+
   // type of normal contact law
   Core::Utils::string_to_integral_parameter<NormalContact>("NORMALCONTACTLAW", "NormalLinearSpring",
       "normal contact law for particles",
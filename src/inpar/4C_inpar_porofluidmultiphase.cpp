@@ -215,6 +215,14 @@ void Inpar::POROFLUIDMULTIPHASE::set_valid_parameters(
       "Flag if artery elements are evaluated in reference or current configuration",
       porofluidmultiphasemshtdyn);
 
+  // tolerance for reusing the projection of the Gauss points in current configuration
+  Core::Utils::double_parameter("PROJECTION_CACHE_TOL", 0.0,
+      "Relative change of the nodal positions of the 2D/3D element (w.r.t. its size) and of the "
+      "segment lengths (w.r.t. the artery element length) below which the projection of the Gauss "
+      "points in current configuration of the last evaluation is reused; 0 reuses it only for "
+      "unchanged deformation",
+      porofluidmultiphasemshtdyn);
+
   // Flag if 1D-3D coupling should be evaluated on lateral (cylinder) surface of embedded artery
   // elements
   Core::Utils::bool_parameter("LATERAL_SURFACE_COUPLING", "no",
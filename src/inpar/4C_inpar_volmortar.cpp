@@ -64,6 +64,16 @@ void Inpar::VolMortar::set_valid_parameters(std::map<std::string, Core::IO::Inpu
           Coupling::VolMortar::dualquad_quad_mod),
       volmortar);
 
+  Core::Utils::string_to_integral_parameter<Coupling::VolMortar::SearchAlgorithm>(
+      "SEARCH_ALGORITHM", "Octree",
+      "Search for colliding elements: octree per element or one query of a bounding volume "
+      "hierarchy, which also restricts the ghosting to the coupling candidates (requires ArborX)",
+      tuple<std::string>("Octree", "octree", "BoundingVolumeHierarchy", "bvh"),
+      tuple<Coupling::VolMortar::SearchAlgorithm>(Coupling::VolMortar::search_octree,
+          Coupling::VolMortar::search_octree, Coupling::VolMortar::search_bvh,
+          Coupling::VolMortar::search_bvh),
+      volmortar);
+
   Core::Utils::bool_parameter(
       "MESH_INIT", "No", "If chosen, mesh initialization procedure is performed", volmortar);
 
@@ -12,6 +12,8 @@
 #include "4C_mat_par_bundle.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <iostream>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -27,8 +29,19 @@ Mat::PAR::MicroMaterial::MicroMaterial(const Core::Mat::PAR::Parameter::Data& ma
     : Parameter(matdata),
       microfile_((matdata.parameters.get<std::string>("MICROFILE"))),
       microdisnum_(matdata.parameters.get<int>("MICRODIS_NUM")),
-      initvol_(matdata.parameters.get<double>("INITVOL"))
+      initvol_(matdata.parameters.get<double>("INITVOL")),
+      surrogate_tol_(matdata.parameters.get<double>("SURROGATE_TOL")),
+      surrogate_max_samples_(matdata.parameters.get<int>("SURROGATE_MAX_SAMPLES")),
+      response_cache_(surrogate_tol_ > 0.0 ? std::make_shared<MicroMaterialResponseCache>(
+                                                 surrogate_tol_, surrogate_max_samples_)
+                                           : nullptr)
+{
+}
+
+
+void Mat::PAR::MicroMaterial::print_response_cache_statistics(MPI_Comm comm) const
 {
+  if (response_cache_ != nullptr) response_cache_->print_statistics(std::cout, comm);
 }
 
 
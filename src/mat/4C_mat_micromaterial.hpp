@@ -12,9 +12,12 @@
 #include "4C_config.hpp"
 
 #include "4C_comm_parobjectfactory.hpp"
+#include "4C_mat_micromaterial_response_cache.hpp"
 #include "4C_mat_so3_material.hpp"
 #include "4C_material_parameter_base.hpp"
 
+#include <mpi.h>
+
 #include <memory>
 
 FOUR_C_NAMESPACE_OPEN
@@ -33,6 +36,9 @@ namespace Mat
       /// standard constructor
       MicroMaterial(const Core::Mat::PAR::Parameter::Data& matdata);
 
+      /// print the statistics of the response cache of all processors of @p comm (collective)
+      void print_response_cache_statistics(MPI_Comm comm) const;
+
       /// @name material parameters
       //@{
 
@@ -42,9 +48,16 @@ namespace Mat
       const int microdisnum_;
       ///
       const double initvol_;
+      /// relative tolerance of extrapolated responses (0: always run the micro simulation)
+      const double surrogate_tol_;
+      /// maximum number of responses stored for extrapolation
+      const int surrogate_max_samples_;
 
       //@}
 
+      /// responses of all micro simulations with these parameters on this processor
+      const std::shared_ptr<MicroMaterialResponseCache> response_cache_;
+
       /// create material instance of matching type with my parameters
       std::shared_ptr<Core::Mat::Material> create_material() override;
 
@@ -19,6 +19,67 @@
 FOUR_C_NAMESPACE_OPEN
 
 
+namespace
+{
+  /*!
+   * \brief Throw if the micro problem contains materials whose response depends on more than the
+   * current strain
+   *
+   * The response cache of the micro material is indexed by the strain only. Hence, only purely
+   * (hyper-)elastic micro materials are admissible as soon as responses are extrapolated.
+   */
+  void check_micro_materials_without_history(const int microdisnum)
+  {
+    for (const auto& [id, mat] : Global::Problem::instance(microdisnum)->materials()->map())
+    {
+      switch (mat->type())
+      {
+        case Core::Materials::m_stvenant:
+        case Core::Materials::m_elasthyper:
+        case Core::Materials::mes_coup1pow:
+        case Core::Materials::mes_coup2pow:
+        case Core::Materials::mes_coup3pow:
+        case Core::Materials::mes_coup13apow:
+        case Core::Materials::mes_coupanisoexpo:
+        case Core::Materials::mes_coupanisoexposhear:
+        case Core::Materials::mes_coupanisoexpotwocoup:
+        case Core::Materials::mes_coupanisoneohooke:
+        case Core::Materials::mes_coupanisopow:
+        case Core::Materials::mes_couptransverselyisotropic:
+        case Core::Materials::mes_coupblatzko:
+        case Core::Materials::mes_coupexppol:
+        case Core::Materials::mes_couplogmixneohooke:
+        case Core::Materials::mes_couplogneohooke:
+        case Core::Materials::mes_coupmooneyrivlin:
+        case Core::Materials::mes_coupneohooke:
+        case Core::Materials::mes_coupSVK:
+        case Core::Materials::mes_coupsimopister:
+        case Core::Materials::mes_coupvarga:
+        case Core::Materials::mes_iso1pow:
+        case Core::Materials::mes_iso2pow:
+        case Core::Materials::mes_isoanisoexpo:
+        case Core::Materials::mes_isoexpopow:
+        case Core::Materials::mes_isomooneyrivlin:
+        case Core::Materials::mes_isoneohooke:
+        case Core::Materials::mes_isoogden:
+        case Core::Materials::mes_isovarga:
+        case Core::Materials::mes_isoyeoh:
+        case Core::Materials::mes_vologden:
+        case Core::Materials::mes_volpenalty:
+        case Core::Materials::mes_volsussmanbathe:
+        case Core::Materials::mes_volpow:
+        case Core::Materials::mes_structuraltensorstratgy:
+          break;
+        default:
+          FOUR_C_THROW(
+              "Material %d of micro discretization %d might have history variables, which are not "
+              "taken into account by the extrapolation of micro responses. Set SURROGATE_TOL to 0.",
+              id, microdisnum);
+      }
+    }
+  }
+}  // namespace
+
 
 // This function has to be separated from the remainder of the
 // MicroMaterial class. MicroMaterialGP is NOT a member of
@@ -81,6 +142,24 @@ void Mat::MicroMaterial::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
     defgrd_enh->multiply_nn(R, U_enh);
   }
 
+  // the response of previous micro simulations is only extrapolated for Gauss points whose micro
+  // simulation has been set up already
+  MicroMaterialResponseCache* response_cache = params_->response_cache_.get();
+  Core::LinAlg::Matrix<6, 1> glstrain_enh;
+  if (response_cache != nullptr)
+  {
+    Core::LinAlg::Matrix<3, 3> cauchygreen;
+    cauchygreen.multiply_tn(*defgrd_enh, *defgrd_enh);
+    for (int i = 0; i < 3; ++i) glstrain_enh(i) = 0.5 * (cauchygreen(i, i) - 1.0);
+    glstrain_enh(3) = cauchygreen(0, 1);
+    glstrain_enh(4) = cauchygreen(1, 2);
+    glstrain_enh(5) = cauchygreen(0, 2);
+
+    // the supporting procs are not involved if the response is extrapolated
+    if (matgp_.find(gp) != matgp_.end() and response_cache->lookup(glstrain_enh, *stress, *cmat))
+      return;
+  }
+
   // activate microscale material
 
   int microdisnum = micro_dis_num();
@@ -134,6 +213,9 @@ void Mat::MicroMaterial::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
   // standard evaluation of the micro material
   if (matgp_.find(gp) == matgp_.end())
   {
+    if (response_cache != nullptr and matgp_.empty())
+      check_micro_materials_without_history(microdisnum);
+
     matgp_[gp] = std::make_shared<MicroMaterialGP>(gp, eleGID, eleowner, microdisnum, V0);
 
     /// save density of this micromaterial
@@ -152,6 +234,8 @@ void Mat::MicroMaterial::evaluate(const Core::LinAlg::Matrix<3, 3>* defgrd,
   // is required)
   actmicromatgp->perform_micro_simulation(defgrd_enh, stress, cmat);
 
+  if (response_cache != nullptr) response_cache->insert(glstrain_enh, *stress, *cmat);
+
   // reactivate macroscale material
   Global::Problem::instance()->materials()->reset_read_from_problem();
 }
@@ -187,6 +271,9 @@ void Mat::MicroMaterial::evaluate(Core::LinAlg::Matrix<3, 3>* defgrd,
 
   if (matgp_.find(gp) == matgp_.end())
   {
+    if (response_cache != nullptr and matgp_.empty())
+      check_micro_materials_without_history(microdisnum);
+
     matgp_[gp] = std::make_shared<MicroMaterialGP>(gp, ele_ID, eleowner, microdisnum, V0);
   }
 
@@ -320,6 +407,9 @@ void Mat::MicroMaterial::read_restart(const int gp, const int eleID, const bool
 
   if (matgp_.find(gp) == matgp_.end())
   {
+    if (response_cache != nullptr and matgp_.empty())
+      check_micro_materials_without_history(microdisnum);
+
     matgp_[gp] = std::make_shared<MicroMaterialGP>(gp, eleID, eleowner, microdisnum, V0);
   }
 
@@ -334,6 +424,9 @@ void Mat::MicroMaterial::read_restart(
 {
   if (matgp_.find(gp) == matgp_.end())
   {
+    if (response_cache != nullptr and matgp_.empty())
+      check_micro_materials_without_history(microdisnum);
+
     matgp_[gp] = std::make_shared<MicroMaterialGP>(gp, eleID, eleowner, microdisnum, V0);
   }
 
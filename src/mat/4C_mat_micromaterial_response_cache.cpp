@@ -0,0 +1,227 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_mat_micromaterial_response_cache.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  //! @p error relative to @p reference, zero errors are exact even for a zero reference
+  double relative(double error, double reference)
+  {
+    if (error == 0.0) return 0.0;
+    if (reference == 0.0) return std::numeric_limits<double>::infinity();
+    return error / reference;
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Mat::MicroMaterialResponseCache::MicroMaterialResponseCache(double tolerance, int max_samples)
+    : tolerance_(tolerance), max_samples_(max_samples)
+{
+  if (tolerance_ < 0.0) FOUR_C_THROW("Tolerance of the response cache must not be negative.");
+  if (max_samples_ < 0)
+    FOUR_C_THROW("Number of samples of the response cache must not be negative.");
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Mat::MicroMaterialResponseCache::lookup(const Core::LinAlg::Matrix<6, 1>& glstrain,
+    Core::LinAlg::Matrix<6, 1>& stress, Core::LinAlg::Matrix<6, 6>& cmat)
+{
+  ++statistics_.lookups;
+
+  double distance_squared = 0.0;
+  const int index = nearest(make_key(glstrain), distance_squared);
+  if (index < 0) return false;
+
+  const Sample& sample = samples_[index];
+
+  // error estimate of the first order extrapolation, exact for the strain of the sample
+  double error = 0.0;
+  if (distance_squared > 0.0)
+  {
+    if (not std::isfinite(sample.curvature)) return false;
+
+    error = relative(0.5 * sample.curvature * distance_squared,
+        sample.stress.norm2() + sample.cmat.norm2() * std::sqrt(distance_squared));
+    if (not(error <= tolerance_)) return false;
+  }
+
+  stress = extrapolate(sample, glstrain);
+  cmat = sample.cmat;
+
+  ++statistics_.hits;
+  statistics_.sum_estimated_error += error;
+  statistics_.max_estimated_error = std::max(statistics_.max_estimated_error, error);
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mat::MicroMaterialResponseCache::insert(const Core::LinAlg::Matrix<6, 1>& glstrain,
+    const Core::LinAlg::Matrix<6, 1>& stress, const Core::LinAlg::Matrix<6, 6>& cmat)
+{
+  const Key key = make_key(glstrain);
+
+  // compare the computed response with the extrapolation of the nearest sample to measure the
+  // curvature of the response between both strains
+  double curvature = std::numeric_limits<double>::infinity();
+  double distance_squared = 0.0;
+  const int index = nearest(key, distance_squared);
+  if (index >= 0)
+  {
+    // the response to this strain is already known
+    if (distance_squared == 0.0) return;
+
+    Sample& neighbor = samples_[index];
+    const double distance = std::sqrt(distance_squared);
+
+    Core::LinAlg::Matrix<6, 1> stress_error(stress);
+    stress_error.update(-1.0, extrapolate(neighbor, glstrain), 1.0);
+    Core::LinAlg::Matrix<6, 6> cmat_error(cmat);
+    cmat_error.update(-1.0, neighbor.cmat, 1.0);
+
+    const double error = stress_error.norm2();
+    curvature = std::max(2.0 * error / distance_squared, cmat_error.norm2() / distance);
+    neighbor.curvature = std::isfinite(neighbor.curvature)
+                             ? std::max(neighbor.curvature, curvature)
+                             : curvature;
+
+    const double relative_error =
+        relative(error, neighbor.stress.norm2() + neighbor.cmat.norm2() * distance);
+    ++statistics_.validations;
+    statistics_.sum_validated_error += relative_error;
+    statistics_.max_validated_error = std::max(statistics_.max_validated_error, relative_error);
+  }
+
+  if (num_samples() >= max_samples_) return;
+
+  // insert the new sample as leaf of the k-d tree
+  const int new_index = num_samples();
+  if (new_index > 0)
+  {
+    int node = 0;
+    for (int depth = 0;; ++depth)
+    {
+      const int dim = depth % 6;
+      int& child = key[dim] < samples_[node].key[dim] ? samples_[node].left : samples_[node].right;
+      if (child < 0)
+      {
+        child = new_index;
+        break;
+      }
+      node = child;
+    }
+  }
+  samples_.emplace_back(Sample{key, glstrain, stress, cmat, curvature});
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mat::MicroMaterialResponseCache::print_statistics(std::ostream& os, MPI_Comm comm) const
+{
+  std::array<int, 4> counts = {
+      statistics_.lookups, statistics_.hits, statistics_.validations, num_samples()};
+  std::array<double, 2> sums = {statistics_.sum_estimated_error, statistics_.sum_validated_error};
+  std::array<double, 2> maxima = {
+      statistics_.max_estimated_error, statistics_.max_validated_error};
+
+  std::array<int, 4> global_counts;
+  std::array<double, 2> global_sums;
+  std::array<double, 2> global_maxima;
+  Core::Communication::sum_all(counts.data(), global_counts.data(), 4, comm);
+  Core::Communication::sum_all(sums.data(), global_sums.data(), 2, comm);
+  Core::Communication::max_all(maxima.data(), global_maxima.data(), 2, comm);
+
+  const auto [lookups, hits, validations, samples] = global_counts;
+  if (Core::Communication::my_mpi_rank(comm) != 0 or lookups == 0) return;
+
+  const auto mean = [](double sum, int num) { return num > 0 ? sum / num : 0.0; };
+
+  os << "Micro material response cache (" << Core::Communication::num_mpi_ranks(comm)
+     << " processors): " << lookups << " lookups, " << hits << " hits (" << std::fixed
+     << std::setprecision(1) << 100.0 * mean(hits, lookups) << " %), " << samples << " samples\n"
+     << std::scientific << std::setprecision(3)
+     << "  estimated relative error of extrapolations: mean " << mean(global_sums[0], hits)
+     << ", max " << global_maxima[0] << "\n"
+     << "  relative error of " << validations
+     << " extrapolations checked against micro simulations: mean "
+     << mean(global_sums[1], validations) << ", max " << global_maxima[1] << std::endl;
+  os << std::defaultfloat;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Mat::MicroMaterialResponseCache::Key Mat::MicroMaterialResponseCache::make_key(
+    const Core::LinAlg::Matrix<6, 1>& glstrain)
+{
+  // the engineering shear strains appear twice in the tensor norm with half of their value
+  const double shear_scale = 1.0 / std::sqrt(2.0);
+  return {glstrain(0), glstrain(1), glstrain(2), shear_scale * glstrain(3),
+      shear_scale * glstrain(4), shear_scale * glstrain(5)};
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Mat::MicroMaterialResponseCache::nearest(const Key& key, double& distance_squared) const
+{
+  int best = -1;
+  distance_squared = std::numeric_limits<double>::infinity();
+  if (not samples_.empty()) nearest(key, 0, 0, best, distance_squared);
+  return best;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mat::MicroMaterialResponseCache::nearest(
+    const Key& key, int node, int depth, int& best, double& best_distance) const
+{
+  if (node < 0) return;
+
+  const Sample& sample = samples_[node];
+  double distance = 0.0;
+  for (int i = 0; i < 6; ++i) distance += (key[i] - sample.key[i]) * (key[i] - sample.key[i]);
+  if (distance < best_distance)
+  {
+    best_distance = distance;
+    best = node;
+  }
+
+  const int dim = depth % 6;
+  const double offset = key[dim] - sample.key[dim];
+  nearest(key, offset < 0.0 ? sample.left : sample.right, depth + 1, best, best_distance);
+
+  // the other half space can only contain a nearer sample if the splitting plane is nearer
+  if (offset * offset < best_distance)
+    nearest(key, offset < 0.0 ? sample.right : sample.left, depth + 1, best, best_distance);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::LinAlg::Matrix<6, 1> Mat::MicroMaterialResponseCache::extrapolate(
+    const Sample& sample, const Core::LinAlg::Matrix<6, 1>& glstrain)
+{
+  Core::LinAlg::Matrix<6, 1> increment(glstrain);
+  increment.update(-1.0, sample.glstrain, 1.0);
+
+  Core::LinAlg::Matrix<6, 1> stress(sample.stress);
+  stress.multiply_nn(1.0, sample.cmat, increment, 1.0);
+  return stress;
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,156 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_MAT_MICROMATERIAL_RESPONSE_CACHE_HPP
+#define FOUR_C_MAT_MICROMATERIAL_RESPONSE_CACHE_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_fixedsizematrix.hpp"
+
+#include <mpi.h>
+
+#include <array>
+#include <ostream>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Mat
+{
+  /*!
+   * \brief Cache of homogenized responses of a micro material
+   *
+   * The cache stores the homogenized second Piola-Kirchhoff stress and material tangent of
+   * previous micro simulations together with the Green-Lagrange strain they were computed for.
+   * The samples are indexed by a k-d tree over the strain. For a new strain, the response of the
+   * nearest sample is extrapolated to first order,
+   *
+   *   S(E) = S_0 + C_0 : (E - E_0),   C(E) = C_0,
+   *
+   * and accepted if the estimated error of the extrapolated stress is below the tolerance. The
+   * error is estimated with the curvature of the response around the sample,
+   *
+   *   |S(E) - S_0 - C_0 : (E - E_0)| <= 1/2 kappa |E - E_0|^2,
+   *
+   * where kappa is measured from the deviation of neighboring samples from their first order
+   * extrapolations. Samples without a neighbor have an unknown curvature and are not used for
+   * extrapolation.
+   *
+   * \note The response is assumed to depend on the current strain only, i.e. the cache is
+   * restricted to elastic micro structures. History variables of the micro scale are not taken
+   * into account, hence the micro material throws for micro problems with materials that might
+   * have history variables.
+   */
+  class MicroMaterialResponseCache
+  {
+   public:
+    //! statistics of the cache
+    struct Statistics
+    {
+      //! number of calls of lookup()
+      int lookups = 0;
+
+      //! number of extrapolated responses
+      int hits = 0;
+
+      //! sum and maximum of the estimated relative errors of all extrapolated responses
+      double sum_estimated_error = 0.0;
+      double max_estimated_error = 0.0;
+
+      //! number of computed responses compared to the extrapolation of their nearest sample
+      int validations = 0;
+
+      //! sum and maximum of the relative errors of these extrapolations
+      double sum_validated_error = 0.0;
+      double max_validated_error = 0.0;
+    };
+
+    /*!
+     * \brief Constructor
+     *
+     * \param tolerance    relative tolerance of the estimated stress error of an extrapolation
+     * \param max_samples  maximum number of stored samples
+     */
+    MicroMaterialResponseCache(double tolerance, int max_samples);
+
+    /*!
+     * \brief Extrapolate the response to the Green-Lagrange strain @p glstrain
+     *
+     * \return whether the estimated error is within the tolerance, only in this case @p stress and
+     * @p cmat are set
+     */
+    bool lookup(const Core::LinAlg::Matrix<6, 1>& glstrain, Core::LinAlg::Matrix<6, 1>& stress,
+        Core::LinAlg::Matrix<6, 6>& cmat);
+
+    //! Add the computed response to the Green-Lagrange strain @p glstrain
+    void insert(const Core::LinAlg::Matrix<6, 1>& glstrain,
+        const Core::LinAlg::Matrix<6, 1>& stress, const Core::LinAlg::Matrix<6, 6>& cmat);
+
+    //! Number of stored samples
+    [[nodiscard]] int num_samples() const { return static_cast<int>(samples_.size()); }
+
+    //! Statistics of all lookups and insertions
+    [[nodiscard]] const Statistics& statistics() const { return statistics_; }
+
+    /*!
+     * \brief Print the statistics of the caches of all processors of @p comm on the first one
+     *
+     * Collective call, nothing is printed if there was no lookup on any processor.
+     */
+    void print_statistics(std::ostream& os, MPI_Comm comm) const;
+
+   private:
+    //! strain in coordinates with the tensor norm as Euclidean norm
+    using Key = std::array<double, 6>;
+
+    //! one computed response, node of the k-d tree
+    struct Sample
+    {
+      Key key;
+      Core::LinAlg::Matrix<6, 1> glstrain;
+      Core::LinAlg::Matrix<6, 1> stress;
+      Core::LinAlg::Matrix<6, 6> cmat;
+
+      //! estimated curvature of the response around the sample (infinite if unknown)
+      double curvature;
+
+      //! children in the k-d tree
+      int left = -1;
+      int right = -1;
+    };
+
+    //! Coordinates of the Green-Lagrange strain (Voigt notation with engineering shear strains)
+    static Key make_key(const Core::LinAlg::Matrix<6, 1>& glstrain);
+
+    //! Index of the sample nearest to @p key (-1 if there is none) and its squared distance
+    int nearest(const Key& key, double& distance_squared) const;
+
+    //! Recursive nearest neighbor search in the subtree of sample @p node
+    void nearest(const Key& key, int node, int depth, int& best, double& best_distance) const;
+
+    //! First order extrapolation of the stress of @p sample to @p glstrain
+    static Core::LinAlg::Matrix<6, 1> extrapolate(
+        const Sample& sample, const Core::LinAlg::Matrix<6, 1>& glstrain);
+
+    //! relative tolerance of the estimated stress error
+    const double tolerance_;
+
+    //! maximum number of stored samples
+    const int max_samples_;
+
+    //! all samples, samples_[0] is the root of the k-d tree
+    std::vector<Sample> samples_;
+
+    //! statistics
+    Statistics statistics_;
+  };
+}  // namespace Mat
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -33,6 +33,7 @@
 #include "4C_rebalance_binning_based.hpp"
 #include "4C_rebalance_graph_based.hpp"
 #include "4C_utils_parameter_list.hpp"
+#include "4C_utils_profiling.hpp"
 
 #include <Epetra_Map.h>
 #include <Teuchos_Time.hpp>
@@ -2414,6 +2415,9 @@ void Mortar::Interface::evaluate_sts(
     const Epetra_Map& selecolmap, const std::shared_ptr<Mortar::ParamsInterface>& mparams_ptr)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Mortar::Interface::EvaluateSTS");
+  FOUR_C_PROFILE_REGION("Mortar::Interface::evaluate_sts");
+
+  int numpairs = 0;
 
   // loop over all slave col elements
   for (int i = 0; i < selecolmap.NumMyElements(); ++i)
@@ -2446,8 +2450,11 @@ void Mortar::Interface::evaluate_sts(
     }
 
     // concrete coupling evaluation routine
+    numpairs += static_cast<int>(melements.size());
     mortar_coupling(selement, melements, mparams_ptr);
   }
+
+  Core::Utils::Profiling::add_counter("contact pairs", numpairs);
 }
 
 
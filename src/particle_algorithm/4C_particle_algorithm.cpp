@@ -46,6 +46,7 @@ PARTICLEALGORITHM::ParticleAlgorithm::ParticleAlgorithm(
       params_(params),
       numparticlesafterlastloadbalance_(0),
       transferevery_(params_.get<bool>("TRANSFER_EVERY")),
+      numsubsteps_(params_.get<int>("RESPA_SUBSTEPS")),
       writeresultsevery_(params.get<int>("RESULTSEVERY")),
       writerestartevery_(params.get<int>("RESTARTEVERY")),
       writeresultsthisstep_(true),
@@ -81,6 +82,9 @@ void PARTICLEALGORITHM::ParticleAlgorithm::init(
   // init viscous damping handler
   init_viscous_damping();
 
+  // check the setup of multiple time stepping
+  check_multiple_time_stepping();
+
   // set initial particles to vector of particles to be distributed
   particlestodistribute_ = initialparticles;
 
@@ -240,6 +244,13 @@ void PARTICLEALGORITHM::ParticleAlgorithm::pre_evaluate_time_step()
 
 void PARTICLEALGORITHM::ParticleAlgorithm::integrate_time_step()
 {
+  // multiple time stepping with sub-cycled particle interactions
+  if (numsubsteps_ > 1)
+  {
+    integrate_time_step_with_sub_cycling();
+    return;
+  }
+
   // time integration scheme specific pre-interaction routine
   particletimint_->pre_interaction_routine();
 
@@ -661,11 +672,33 @@ void PARTICLEALGORITHM::ParticleAlgorithm::setup_initial_states()
     // evaluate time step
     evaluate_time_step();
 
+    // evaluate sub-cycled particle interactions
+    if (numsubsteps_ > 1) particleinteraction_->evaluate_sub_cycled_interactions();
+
     // post evaluate time step
     post_evaluate_time_step();
   }
 }
 
+void PARTICLEALGORITHM::ParticleAlgorithm::check_multiple_time_stepping() const
+{
+  // safety check
+  if (numsubsteps_ < 1)
+    FOUR_C_THROW("number of sub-steps of multiple time stepping has to be positive!");
+
+  if (numsubsteps_ == 1) return;
+
+  // safety check
+  if (Teuchos::getIntegralValue<Inpar::PARTICLE::DynamicType>(params_, "DYNAMICTYPE") !=
+      Inpar::PARTICLE::dyna_velocityverlet)
+    FOUR_C_THROW(
+        "multiple time stepping only implemented for velocity Verlet time integration scheme!");
+
+  // safety check
+  if (not particleinteraction_ or not particleinteraction_->have_sub_cycled_interactions())
+    FOUR_C_THROW("multiple time stepping without sub-cycled particle interactions!");
+}
+
 void PARTICLEALGORITHM::ParticleAlgorithm::update_connectivity()
 {
   TEUCHOS_FUNC_TIME_MONITOR("PARTICLEALGORITHM::ParticleAlgorithm::update_connectivity");
@@ -967,6 +1000,45 @@ void PARTICLEALGORITHM::ParticleAlgorithm::evaluate_time_step()
   if (particlerigidbody_ and particleinteraction_) particlerigidbody_->compute_accelerations();
 }
 
+void PARTICLEALGORITHM::ParticleAlgorithm::integrate_time_step_with_sub_cycling()
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "PARTICLEALGORITHM::ParticleAlgorithm::integrate_time_step_with_sub_cycling");
+
+  // time integration scheme specific routine before sub-cycling
+  particletimint_->pre_sub_cycling_routine();
+
+  // inner time step size
+  const double substepdt = dt() / numsubsteps_;
+
+  // iterate over sub-steps
+  for (int substep = 1; substep <= numsubsteps_; ++substep)
+  {
+    // set current time of sub-step
+    const double substeptime = time() - (numsubsteps_ - substep) * substepdt;
+    particletimint_->set_current_time(substeptime);
+    particleinteraction_->set_current_time(substeptime);
+
+    // time integration scheme specific pre-interaction routine
+    particletimint_->pre_interaction_routine();
+
+    // update connectivity
+    update_connectivity();
+
+    // evaluate sub-cycled particle interactions
+    particleinteraction_->evaluate_sub_cycled_interactions();
+
+    // time integration scheme specific post-interaction routine
+    particletimint_->post_interaction_routine();
+  }
+
+  // evaluate time step
+  evaluate_time_step();
+
+  // time integration scheme specific routine after sub-cycling
+  particletimint_->post_sub_cycling_routine();
+}
+
 void PARTICLEALGORITHM::ParticleAlgorithm::set_gravity_acceleration()
 {
   std::vector<double> scaled_gravity(3);
@@ -306,6 +306,9 @@ namespace PARTICLEALGORITHM
      */
     void setup_initial_states();
 
+    //! check the setup of multiple time stepping
+    void check_multiple_time_stepping() const;
+
     //! @}
 
     /*!
@@ -424,6 +427,16 @@ namespace PARTICLEALGORITHM
      */
     void evaluate_time_step();
 
+    /*!
+     * \brief integrate time step with multiple time stepping (r-RESPA)
+     *
+     * The particle interactions sub-cycled in multiple time stepping (e.g., stiff short-range
+     * contact) are integrated in sub-steps with the inner time step size. All other
+     * contributions (e.g., gravity, long-range or smooth interactions, viscous damping) are
+     * evaluated once at the end of the time step and integrated with the outer time step size.
+     */
+    void integrate_time_step_with_sub_cycling();
+
     /*!
      * \brief set gravity acceleration
      *
@@ -470,6 +483,9 @@ namespace PARTICLEALGORITHM
     //! transfer particles to new bins every time step
     bool transferevery_;
 
+    //! number of sub-steps of multiple time stepping
+    const int numsubsteps_;
+
     //! write results interval
     const int writeresultsevery_;
 
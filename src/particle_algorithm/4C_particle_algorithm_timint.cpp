@@ -121,6 +121,16 @@ void PARTICLEALGORITHM::TimInt::set_initial_states()
 
 void PARTICLEALGORITHM::TimInt::set_current_time(const double currenttime) { time_ = currenttime; }
 
+void PARTICLEALGORITHM::TimInt::pre_sub_cycling_routine()
+{
+  FOUR_C_THROW("multiple time stepping not implemented for this time integration scheme!");
+}
+
+void PARTICLEALGORITHM::TimInt::post_sub_cycling_routine()
+{
+  FOUR_C_THROW("multiple time stepping not implemented for this time integration scheme!");
+}
+
 void PARTICLEALGORITHM::TimInt::init_dirichlet_boundary_condition()
 {
   // create dirichlet boundary condition handler
@@ -329,9 +339,54 @@ void PARTICLEALGORITHM::TimIntSemiImplicitEuler::post_interaction_routine()
 }
 
 PARTICLEALGORITHM::TimIntVelocityVerlet::TimIntVelocityVerlet(const Teuchos::ParameterList& params)
-    : PARTICLEALGORITHM::TimInt(params), dthalf_(0.5 * dt_)
+    : PARTICLEALGORITHM::TimInt(params),
+      dthalf_(0.5 * dt_),
+      subcycling_(params_.get<int>("RESPA_SUBSTEPS") > 1),
+      outerdthalf_(0.5 * dt_),
+      accstate_(subcycling_ ? PARTICLEENGINE::SubCycledAcceleration : PARTICLEENGINE::Acceleration),
+      angaccstate_(subcycling_ ? PARTICLEENGINE::SubCycledAngularAcceleration
+                               : PARTICLEENGINE::AngularAcceleration)
 {
-  // empty constructor
+  // sub-cycled interactions are integrated with the inner time step size
+  if (subcycling_)
+  {
+    dt_ /= params_.get<int>("RESPA_SUBSTEPS");
+    dthalf_ = 0.5 * dt_;
+  }
+}
+
+void PARTICLEALGORITHM::TimIntVelocityVerlet::setup(
+    const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface,
+    const std::shared_ptr<ParticleRigidBody::RigidBodyHandlerInterface> particlerigidbodyinterface)
+{
+  // call base class setup
+  PARTICLEALGORITHM::TimInt::setup(particleengineinterface, particlerigidbodyinterface);
+
+  if (not subcycling_) return;
+
+  // safety check: rigid bodies are not sub-cycled, since the forces and torques summed up from
+  // the rigid particles are not split into sub-cycled and outer contributions
+  if (particlerigidbodyinterface_)
+    FOUR_C_THROW("multiple time stepping not implemented yet for rigid body motion!");
+
+  // get particle container bundle
+  PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle =
+      particleengineinterface_->get_particle_container_bundle();
+
+  // iterate over particle types
+  for (auto& particleType : typestointegrate_)
+  {
+    // get container of owned particles of current particle type
+    PARTICLEENGINE::ParticleContainer* container =
+        particlecontainerbundle->get_specific_container(particleType, PARTICLEENGINE::Owned);
+
+    // safety check
+    if (container->have_stored_state(PARTICLEENGINE::ModifiedVelocity) or
+        container->have_stored_state(PARTICLEENGINE::ModifiedAcceleration))
+      FOUR_C_THROW(
+          "modified velocity and acceleration states not implemented yet for multiple time "
+          "stepping!");
+  }
 }
 
 void PARTICLEALGORITHM::TimIntVelocityVerlet::set_initial_states()
@@ -375,21 +430,20 @@ void PARTICLEALGORITHM::TimIntVelocityVerlet::pre_interaction_routine()
         particlecontainerbundle->get_specific_container(particleType, PARTICLEENGINE::Owned);
 
     // update velocity of all particles
-    container->update_state(1.0, PARTICLEENGINE::Velocity, dthalf_, PARTICLEENGINE::Acceleration);
+    container->update_state(1.0, PARTICLEENGINE::Velocity, dthalf_, accstate_);
 
     // clear acceleration of all particles
-    container->clear_state(PARTICLEENGINE::Acceleration);
+    container->clear_state(accstate_);
 
     // angular velocity and acceleration states
     if (container->have_stored_state(PARTICLEENGINE::AngularVelocity) and
-        container->have_stored_state(PARTICLEENGINE::AngularAcceleration))
+        container->have_stored_state(angaccstate_))
     {
       // update angular velocity of all particles
-      container->update_state(
-          1.0, PARTICLEENGINE::AngularVelocity, dthalf_, PARTICLEENGINE::AngularAcceleration);
+      container->update_state(1.0, PARTICLEENGINE::AngularVelocity, dthalf_, angaccstate_);
 
       // clear angular acceleration of all particles
-      container->clear_state(PARTICLEENGINE::AngularAcceleration);
+      container->clear_state(angaccstate_);
     }
 
     // modified velocity and acceleration states
@@ -455,15 +509,14 @@ void PARTICLEALGORITHM::TimIntVelocityVerlet::post_interaction_routine()
         particlecontainerbundle->get_specific_container(particleType, PARTICLEENGINE::Owned);
 
     // update velocity of all particles
-    container->update_state(1.0, PARTICLEENGINE::Velocity, dthalf_, PARTICLEENGINE::Acceleration);
+    container->update_state(1.0, PARTICLEENGINE::Velocity, dthalf_, accstate_);
 
     // angular velocity and acceleration states
     if (container->have_stored_state(PARTICLEENGINE::AngularVelocity) and
-        container->have_stored_state(PARTICLEENGINE::AngularAcceleration))
+        container->have_stored_state(angaccstate_))
     {
       // update angular velocity of all particles
-      container->update_state(
-          1.0, PARTICLEENGINE::AngularVelocity, dthalf_, PARTICLEENGINE::AngularAcceleration);
+      container->update_state(1.0, PARTICLEENGINE::AngularVelocity, dthalf_, angaccstate_);
     }
   }
 
@@ -475,4 +528,78 @@ void PARTICLEALGORITHM::TimIntVelocityVerlet::post_interaction_routine()
     dirichletboundarycondition_->evaluate_dirichlet_boundary_condition(time_, false, true, false);
 }
 
+void PARTICLEALGORITHM::TimIntVelocityVerlet::pre_sub_cycling_routine()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("PARTICLEALGORITHM::TimIntVelocityVerlet::pre_sub_cycling_routine");
+
+  // get particle container bundle
+  PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle =
+      particleengineinterface_->get_particle_container_bundle();
+
+  // iterate over particle types
+  for (auto& particleType : typestointegrate_)
+  {
+    // get container of owned particles of current particle type
+    PARTICLEENGINE::ParticleContainer* container =
+        particlecontainerbundle->get_specific_container(particleType, PARTICLEENGINE::Owned);
+
+    // update velocity of all particles
+    container->update_state(
+        1.0, PARTICLEENGINE::Velocity, outerdthalf_, PARTICLEENGINE::Acceleration);
+
+    // clear acceleration of all particles
+    container->clear_state(PARTICLEENGINE::Acceleration);
+
+    // angular velocity and acceleration states
+    if (container->have_stored_state(PARTICLEENGINE::AngularVelocity) and
+        container->have_stored_state(PARTICLEENGINE::AngularAcceleration))
+    {
+      // update angular velocity of all particles
+      container->update_state(
+          1.0, PARTICLEENGINE::AngularVelocity, outerdthalf_, PARTICLEENGINE::AngularAcceleration);
+
+      // clear angular acceleration of all particles
+      container->clear_state(PARTICLEENGINE::AngularAcceleration);
+    }
+  }
+}
+
+void PARTICLEALGORITHM::TimIntVelocityVerlet::post_sub_cycling_routine()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("PARTICLEALGORITHM::TimIntVelocityVerlet::post_sub_cycling_routine");
+
+  // get particle container bundle
+  PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle =
+      particleengineinterface_->get_particle_container_bundle();
+
+  // iterate over particle types
+  for (auto& particleType : typestointegrate_)
+  {
+    // get container of owned particles of current particle type
+    PARTICLEENGINE::ParticleContainer* container =
+        particlecontainerbundle->get_specific_container(particleType, PARTICLEENGINE::Owned);
+
+    // update velocity of all particles
+    container->update_state(
+        1.0, PARTICLEENGINE::Velocity, outerdthalf_, PARTICLEENGINE::Acceleration);
+
+    // angular velocity and acceleration states
+    if (container->have_stored_state(PARTICLEENGINE::AngularVelocity) and
+        container->have_stored_state(PARTICLEENGINE::AngularAcceleration))
+    {
+      // update angular velocity of all particles
+      container->update_state(
+          1.0, PARTICLEENGINE::AngularVelocity, outerdthalf_, PARTICLEENGINE::AngularAcceleration);
+    }
+  }
+
+  // evaluate dirichlet boundary condition overwritten by the outer half kick
+  if (dirichletboundarycondition_)
+    dirichletboundarycondition_->evaluate_dirichlet_boundary_condition(time_, false, true, false);
+
+  // evaluate temperature boundary condition
+  if (temperatureboundarycondition_)
+    temperatureboundarycondition_->evaluate_temperature_boundary_condition(time_);
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -127,6 +127,17 @@ namespace PARTICLEALGORITHM
      */
     virtual void post_interaction_routine() = 0;
 
+    /*!
+     * \brief time integration scheme specific routine before sub-cycling in multiple time stepping
+     *
+     * \note The pre- and post-interaction routines integrate a sub-step of the interactions
+     *       sub-cycled in multiple time stepping.
+     */
+    virtual void pre_sub_cycling_routine();
+
+    //! time integration scheme specific routine after sub-cycling in multiple time stepping
+    virtual void post_sub_cycling_routine();
+
    private:
     /*!
      * \brief init dirichlet boundary condition handler
@@ -235,6 +246,11 @@ namespace PARTICLEALGORITHM
    * \$f x_{n+1}   = x_{n}     + dt   * v_{n+1/2} \$f
    * \$f v_{n+1}   = v_{n+1/2} + dt/2 * a_{n+1}   \$f with \$f a_{n+1} = a( r_{n+1}, v_{n+1/2} ) \$f
    *
+   * With multiple time stepping (r-RESPA) the accelerations of the sub-cycled interactions are
+   * integrated with the above scheme in sub-steps of the inner time step size, which are
+   * enclosed by half kicks of the velocity with the accelerations of all other interactions
+   * over the outer time step size.
+   *
    * \author Sebastian Fuchs \date 05/2018
    */
   class TimIntVelocityVerlet : public TimInt
@@ -249,6 +265,12 @@ namespace PARTICLEALGORITHM
      */
     TimIntVelocityVerlet(const Teuchos::ParameterList& params);
 
+    //! time integration scheme specific initialization routine
+    void setup(
+        const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface,
+        const std::shared_ptr<ParticleRigidBody::RigidBodyHandlerInterface>
+            particlerigidbodyinterface) override;
+
     /*!
      * \brief time integration scheme specific initialization routine
      *
@@ -270,9 +292,27 @@ namespace PARTICLEALGORITHM
      */
     void post_interaction_routine() override;
 
+    //! time integration scheme specific routine before sub-cycling in multiple time stepping
+    void pre_sub_cycling_routine() override;
+
+    //! time integration scheme specific routine after sub-cycling in multiple time stepping
+    void post_sub_cycling_routine() override;
+
    private:
     //! half time step size
     double dthalf_;
+
+    //! sub-cycling of interactions in multiple time stepping
+    const bool subcycling_;
+
+    //! half outer time step size of multiple time stepping
+    const double outerdthalf_;
+
+    //! acceleration state integrated in the pre- and post-interaction routine
+    const PARTICLEENGINE::StateEnum accstate_;
+
+    //! angular acceleration state integrated in the pre- and post-interaction routine
+    const PARTICLEENGINE::StateEnum angaccstate_;
   };
 
 }  // namespace PARTICLEALGORITHM
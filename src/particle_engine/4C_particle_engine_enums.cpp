@@ -45,6 +45,7 @@ int PARTICLEENGINE::enum_to_state_dim(const enum ParticleState& state)
     case LastTransferPosition:
     case ModifiedVelocity:
     case ModifiedAcceleration:
+    case SubCycledAcceleration:
     case ReferencePosition:
     case RelativePosition:
     case RelativePositionBodyFrame:
@@ -55,6 +56,7 @@ int PARTICLEENGINE::enum_to_state_dim(const enum ParticleState& state)
     case temperature_gradient:
     case AngularVelocity:
     case AngularAcceleration:
+    case SubCycledAngularAcceleration:
     case Force:
     case Moment:
     case LastIterPosition:
@@ -148,6 +150,12 @@ std::string PARTICLEENGINE::enum_to_state_name(const enum ParticleState& state)
     case ModifiedAcceleration:
       name = "modified acceleration";
       break;
+    case SubCycledAcceleration:
+      name = "sub-cycled acceleration";
+      break;
+    case SubCycledAngularAcceleration:
+      name = "sub-cycled angular acceleration";
+      break;
     case BoundaryPressure:
       name = "boundary pressure";
       break;
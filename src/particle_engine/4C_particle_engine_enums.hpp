@@ -40,8 +40,9 @@ namespace PARTICLEENGINE
     LastTransferPosition,  //!< position after last particle transfer
     /*---------------------------------------------------------------------------*/
     // particle states for advanced time integration schemes
-    ModifiedVelocity,      //!< modified velocity
-    ModifiedAcceleration,  //!< modified acceleration
+    ModifiedVelocity,       //!< modified velocity
+    ModifiedAcceleration,   //!< modified acceleration
+    SubCycledAcceleration,  //!< acceleration of interactions sub-cycled in multiple time stepping
     /*---------------------------------------------------------------------------*/
     // particle states for boundary conditions
     ReferencePosition,  //!< reference position
@@ -74,10 +75,11 @@ namespace PARTICLEENGINE
     temperature_gradient,  //!< temperature gradient
     /*---------------------------------------------------------------------------*/
     // particle states for DEM interaction
-    AngularVelocity,      //!< angular velocity
-    AngularAcceleration,  //!< angular acceleration
-    Force,                //!< force
-    Moment,               //!< moment
+    AngularVelocity,               //!< angular velocity
+    AngularAcceleration,           //!< angular acceleration
+    SubCycledAngularAcceleration,  //!< angular acceleration of sub-cycled interactions
+    Force,                         //!< force
+    Moment,                        //!< moment
     /*---------------------------------------------------------------------------*/
     // particle states for two way coupled partitioned PASI
     LastIterPosition,              //!< position after last converged iteration
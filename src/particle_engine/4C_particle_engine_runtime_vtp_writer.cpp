@@ -35,6 +35,7 @@ void PARTICLEENGINE::ParticleRuntimeVtpWriter::init(
   blackliststates_.insert(TemperatureDot);
   blackliststates_.insert({LastTransferPosition, ReferencePosition});
   blackliststates_.insert({ModifiedVelocity, ModifiedAcceleration});
+  blackliststates_.insert({SubCycledAcceleration, SubCycledAngularAcceleration});
   blackliststates_.insert({InterfaceNormal, Curvature, WallColorfield, WallInterfaceNormal});
   blackliststates_.insert({LastIterPosition, LastIterVelocity, LastIterAcceleration,
       LastIterAngularVelocity, LastIterAngularAcceleration, LastIterModifiedAcceleration,
@@ -110,6 +110,16 @@ void ParticleInteraction::ParticleInteractionBase::set_current_time(const double
   time_ = currenttime;
 }
 
+bool ParticleInteraction::ParticleInteractionBase::have_sub_cycled_interactions() const
+{
+  return false;
+}
+
+void ParticleInteraction::ParticleInteractionBase::evaluate_sub_cycled_interactions()
+{
+  FOUR_C_THROW("no particle interactions sub-cycled in multiple time stepping!");
+}
+
 void ParticleInteraction::ParticleInteractionBase::set_current_step_size(
     const double currentstepsize)
 {
@@ -91,9 +91,15 @@ namespace ParticleInteraction
     //! pre evaluate time step
     virtual void pre_evaluate_time_step() = 0;
 
-    //! evaluate particle interactions
+    //! evaluate particle interactions (except those sub-cycled in multiple time stepping)
     virtual void evaluate_interactions() = 0;
 
+    //! have particle interactions sub-cycled in multiple time stepping
+    virtual bool have_sub_cycled_interactions() const;
+
+    //! evaluate particle interactions sub-cycled in multiple time stepping
+    virtual void evaluate_sub_cycled_interactions();
+
     //! post evaluate time step
     virtual void post_evaluate_time_step(
         std::vector<PARTICLEENGINE::ParticleTypeToType>& particlesfromphasetophase) = 0;
@@ -32,7 +32,12 @@ ParticleInteraction::ParticleInteractionDEM::ParticleInteractionDEM(
     MPI_Comm comm, const Teuchos::ParameterList& params)
     : ParticleInteraction::ParticleInteractionBase(comm, params),
       params_dem_(params.sublist("DEM")),
-      writeparticleenergy_(params_dem_.get<bool>("WRITE_PARTICLE_ENERGY"))
+      writeparticleenergy_(params_dem_.get<bool>("WRITE_PARTICLE_ENERGY")),
+      numsubsteps_(params.get<int>("RESPA_SUBSTEPS")),
+      subcyclecontact_(numsubsteps_ > 1 and params_dem_.get<bool>("RESPA_SUBCYCLE_CONTACT")),
+      subcyclewallcontact_(
+          numsubsteps_ > 1 and params_dem_.get<bool>("RESPA_SUBCYCLE_WALL_CONTACT")),
+      subcycleadhesion_(numsubsteps_ > 1 and params_dem_.get<bool>("RESPA_SUBCYCLE_ADHESION"))
 {
   // empty constructor
 }
@@ -117,6 +122,24 @@ void ParticleInteraction::ParticleInteractionDEM::insert_particle_states_of_part
 
   // states for contact evaluation scheme
   contact_->insert_particle_states_of_particle_types(particlestatestotypes);
+
+  // states for sub-cycled interactions of multiple time stepping, which are written to and read
+  // from restart with all other particle states as the first sub-step after a restart starts
+  // with the sub-cycled accelerations of the last sub-step
+  if (have_sub_cycled_interactions())
+  {
+    // iterate over particle types
+    for (auto& typeIt : particlestatestotypes)
+    {
+      // set of particle states for current particle type
+      std::set<PARTICLEENGINE::StateEnum>& particlestates = typeIt.second;
+
+      particlestates.insert(PARTICLEENGINE::SubCycledAcceleration);
+
+      if (particlestates.count(PARTICLEENGINE::AngularAcceleration))
+        particlestates.insert(PARTICLEENGINE::SubCycledAngularAcceleration);
+    }
+  }
 }
 
 void ParticleInteraction::ParticleInteractionDEM::set_initial_states()
@@ -140,30 +163,22 @@ void ParticleInteraction::ParticleInteractionDEM::evaluate_interactions()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::ParticleInteractionDEM::evaluate_interactions");
 
-  // clear force and moment states of particles
-  clear_force_and_moment_states();
-
-  // evaluate neighbor pairs
-  neighborpairs_->evaluate_neighbor_pairs();
-
-  // evaluate adhesion neighbor pairs
-  if (adhesion_)
-    neighborpairs_->evaluate_neighbor_pairs_adhesion(adhesion_->get_adhesion_distance());
-
-  // check critical time step
-  contact_->check_critical_time_step();
-
-  // add contact contribution to force and moment field
-  contact_->add_force_and_moment_contribution();
+  // evaluate particle interactions not sub-cycled in multiple time stepping
+  evaluate_specific_interactions(false);
+}
 
-  // add adhesion contribution to force field
-  if (adhesion_) adhesion_->add_force_contribution();
+bool ParticleInteraction::ParticleInteractionDEM::have_sub_cycled_interactions() const
+{
+  return subcyclecontact_ or subcyclewallcontact_ or (subcycleadhesion_ and adhesion_);
+}
 
-  // compute acceleration from force and moment
-  compute_acceleration();
+void ParticleInteraction::ParticleInteractionDEM::evaluate_sub_cycled_interactions()
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "ParticleInteraction::ParticleInteractionDEM::evaluate_sub_cycled_interactions");
 
-  // update history pairs
-  historypairs_->update_history_pairs();
+  // evaluate particle interactions sub-cycled in multiple time stepping
+  evaluate_specific_interactions(true);
 }
 
 void ParticleInteraction::ParticleInteractionDEM::post_evaluate_time_step(
@@ -212,7 +227,7 @@ void ParticleInteraction::ParticleInteractionDEM::set_current_step_size(
 void ParticleInteraction::ParticleInteractionDEM::init_neighbor_pair_handler()
 {
   // create neighbor pair handler
-  neighborpairs_ = std::make_shared<ParticleInteraction::DEMNeighborPairs>();
+  neighborpairs_ = std::make_shared<ParticleInteraction::DEMNeighborPairs>(params_);
 
   // init neighbor pair handler
   neighborpairs_->init();
@@ -477,6 +492,57 @@ void ParticleInteraction::ParticleInteractionDEM::set_initial_inertia()
   }
 }
 
+void ParticleInteraction::ParticleInteractionDEM::evaluate_specific_interactions(
+    const bool subcycled)
+{
+  // determine particle interactions to evaluate
+  const bool evaluatecontact = (subcyclecontact_ == subcycled);
+  const bool evaluatewallcontact = (subcyclewallcontact_ == subcycled);
+  const bool evaluateadhesion = adhesion_ and (subcycleadhesion_ == subcycled);
+
+  // clear force and moment states of particles
+  clear_force_and_moment_states();
+
+  // evaluate neighbor pairs
+  neighborpairs_->evaluate_neighbor_pairs();
+
+  // evaluate adhesion neighbor pairs
+  if (evaluateadhesion)
+    neighborpairs_->evaluate_neighbor_pairs_adhesion(adhesion_->get_adhesion_distance());
+
+  // set step size of contact evaluation
+  contact_->set_current_step_size(subcycled ? dt_ / numsubsteps_ : dt_);
+
+  if (evaluatecontact)
+  {
+    // check critical time step
+    contact_->check_critical_time_step();
+
+    // add particle contact contribution to force and moment field
+    contact_->add_particle_contact_contribution();
+  }
+
+  // factor of forces assembled to the wall (the wall is loaded with the mean force over all
+  // sub-steps)
+  const double wallforcefac = subcycled ? 1.0 / numsubsteps_ : 1.0;
+
+  // add particle-wall contact contribution to force and moment field
+  if (evaluatewallcontact) contact_->add_particle_wall_contact_contribution(wallforcefac);
+
+  // add adhesion contribution to force field
+  if (evaluateadhesion) adhesion_->add_force_contribution(wallforcefac);
+
+  // compute acceleration from force and moment
+  if (subcycled)
+    compute_acceleration(
+        PARTICLEENGINE::SubCycledAcceleration, PARTICLEENGINE::SubCycledAngularAcceleration);
+  else
+    compute_acceleration(PARTICLEENGINE::Acceleration, PARTICLEENGINE::AngularAcceleration);
+
+  // update history pairs
+  historypairs_->update_history_pairs(evaluatecontact, evaluatewallcontact, evaluateadhesion);
+}
+
 void ParticleInteraction::ParticleInteractionDEM::clear_force_and_moment_states() const
 {
   // iterate over particle types
@@ -495,7 +561,8 @@ void ParticleInteraction::ParticleInteractionDEM::clear_force_and_moment_states(
   }
 }
 
-void ParticleInteraction::ParticleInteractionDEM::compute_acceleration() const
+void ParticleInteraction::ParticleInteractionDEM::compute_acceleration(
+    PARTICLEENGINE::StateEnum accstate, PARTICLEENGINE::StateEnum angaccstate) const
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::ParticleInteractionDEM::compute_acceleration");
 
@@ -513,15 +580,15 @@ void ParticleInteraction::ParticleInteractionDEM::compute_acceleration() const
     if (particlestored <= 0) continue;
 
     // get particle state dimension
-    const int statedim = container->get_state_dim(PARTICLEENGINE::Acceleration);
+    const int statedim = container->get_state_dim(accstate);
 
     // get pointer to particle states
     const double* radius = container->get_ptr_to_state(PARTICLEENGINE::Radius, 0);
     const double* mass = container->get_ptr_to_state(PARTICLEENGINE::Mass, 0);
     const double* force = container->get_ptr_to_state(PARTICLEENGINE::Force, 0);
     const double* moment = container->cond_get_ptr_to_state(PARTICLEENGINE::Moment, 0);
-    double* acc = container->get_ptr_to_state(PARTICLEENGINE::Acceleration, 0);
-    double* angacc = container->cond_get_ptr_to_state(PARTICLEENGINE::AngularAcceleration, 0);
+    double* acc = container->get_ptr_to_state(accstate, 0);
+    double* angacc = container->cond_get_ptr_to_state(angaccstate, 0);
 
     // compute acceleration
     for (int i = 0; i < particlestored; ++i)
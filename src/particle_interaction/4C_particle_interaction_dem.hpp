@@ -81,9 +81,15 @@ namespace ParticleInteraction
     //! pre evaluate time step
     void pre_evaluate_time_step() override;
 
-    //! evaluate particle interactions
+    //! evaluate particle interactions (except those sub-cycled in multiple time stepping)
     void evaluate_interactions() override;
 
+    //! have particle interactions sub-cycled in multiple time stepping
+    bool have_sub_cycled_interactions() const override;
+
+    //! evaluate particle interactions sub-cycled in multiple time stepping
+    void evaluate_sub_cycled_interactions() override;
+
     //! post evaluate time step
     void post_evaluate_time_step(
         std::vector<PARTICLEENGINE::ParticleTypeToType>& particlesfromphasetophase) override;
@@ -125,11 +131,24 @@ namespace ParticleInteraction
     //! set initial inertia
     void set_initial_inertia();
 
+    /*!
+     * \brief evaluate particle interactions either sub-cycled in multiple time stepping or not
+     *
+     * \param[in] subcycled evaluate sub-cycled particle interactions
+     */
+    void evaluate_specific_interactions(const bool subcycled);
+
     //! clear force and moment states of particles
     void clear_force_and_moment_states() const;
 
-    //! compute acceleration from force and moment
-    void compute_acceleration() const;
+    /*!
+     * \brief compute acceleration from force and moment
+     *
+     * \param[in] accstate    acceleration state to add contribution to
+     * \param[in] angaccstate angular acceleration state to add contribution to
+     */
+    void compute_acceleration(
+        PARTICLEENGINE::StateEnum accstate, PARTICLEENGINE::StateEnum angaccstate) const;
 
     //! evaluate particle energy
     void evaluate_particle_energy() const;
@@ -158,6 +177,18 @@ namespace ParticleInteraction
 
     //! write particle energy output
     const bool writeparticleenergy_;
+
+    //! number of sub-steps of multiple time stepping
+    const int numsubsteps_;
+
+    //! sub-cycle particle contact in multiple time stepping
+    const bool subcyclecontact_;
+
+    //! sub-cycle particle-wall contact in multiple time stepping
+    const bool subcyclewallcontact_;
+
+    //! sub-cycle particle and particle-wall adhesion in multiple time stepping
+    const bool subcycleadhesion_;
   };
 
 }  // namespace ParticleInteraction
@@ -90,13 +90,13 @@ void ParticleInteraction::DEMAdhesion::setup(
   if (adhesion_distance_ < 0.0) FOUR_C_THROW("negative adhesion distance!");
 }
 
-void ParticleInteraction::DEMAdhesion::add_force_contribution()
+void ParticleInteraction::DEMAdhesion::add_force_contribution(const double wallforcefac)
 {
   // evaluate particle adhesion contribution
   evaluate_particle_adhesion();
 
   // evaluate particle-wall adhesion contribution
-  if (particlewallinterface_) evaluate_particle_wall_adhesion();
+  if (particlewallinterface_) evaluate_particle_wall_adhesion(wallforcefac);
 }
 
 void ParticleInteraction::DEMAdhesion::init_adhesion_law_handler()
@@ -280,7 +280,7 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_adhesion()
   }
 }
 
-void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion()
+void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion(const double wallforcefac)
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion");
 
@@ -464,7 +464,7 @@ void ParticleInteraction::DEMAdhesion::evaluate_particle_wall_adhesion()
       std::vector<double> nodal_force(numnodes * 3);
       for (int node = 0; node < numnodes; ++node)
         for (int dim = 0; dim < 3; ++dim)
-          nodal_force[node * 3 + dim] = funct[node] * walladhesionforce[dim];
+          nodal_force[node * 3 + dim] = wallforcefac * funct[node] * walladhesionforce[dim];
 
       // assemble nodal forces
       const int err = walldatastate->get_force_col()->SumIntoGlobalValues(
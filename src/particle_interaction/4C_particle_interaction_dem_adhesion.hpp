@@ -79,8 +79,12 @@ namespace ParticleInteraction
     //! get adhesion distance
     inline double get_adhesion_distance() const { return adhesion_distance_; };
 
-    //! add adhesion contribution to force field
-    void add_force_contribution();
+    /*!
+     * \brief add adhesion contribution to force field
+     *
+     * \param[in] wallforcefac factor of adhesion forces assembled to the wall
+     */
+    void add_force_contribution(const double wallforcefac);
 
    private:
     //! init adhesion law handler
@@ -96,7 +100,7 @@ namespace ParticleInteraction
     void evaluate_particle_adhesion();
 
     //! evaluate particle-wall adhesion contribution
-    void evaluate_particle_wall_adhesion();
+    void evaluate_particle_wall_adhesion(const double wallforcefac);
 
     //! discrete element method specific parameter list
     const Teuchos::ParameterList& params_dem_;
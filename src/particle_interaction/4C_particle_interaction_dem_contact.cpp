@@ -187,13 +187,17 @@ void ParticleInteraction::DEMContact::check_critical_time_step() const
                    << "!" << Core::IO::endl;
 }
 
-void ParticleInteraction::DEMContact::add_force_and_moment_contribution()
+void ParticleInteraction::DEMContact::add_particle_contact_contribution()
 {
   // evaluate particle contact contribution
   evaluate_particle_contact();
+}
 
+void ParticleInteraction::DEMContact::add_particle_wall_contact_contribution(
+    const double wallforcefac)
+{
   // evaluate particle-wall contact contribution
-  if (particlewallinterface_) evaluate_particle_wall_contact();
+  if (particlewallinterface_) evaluate_particle_wall_contact(wallforcefac);
 }
 
 void ParticleInteraction::DEMContact::evaluate_elastic_potential_energy(
@@ -377,8 +381,8 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
   // rolling contact friction coefficient
   const double mu_rolling = contactrolling_ ? params_dem_.get<double>("FRICT_COEFF_ROLL") : 0.0;
 
-  // iterate over particle pairs
-  for (const auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
+  // evaluate particle pair
+  const auto evaluate_particle_pair = [&](const DEMParticlePair& particlepair)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -568,10 +572,20 @@ void ParticleInteraction::DEMContact::evaluate_particle_contact()
       Utils::vec_add(moment_i, rollingcontactmoment);
       if (status_j == PARTICLEENGINE::Owned) Utils::vec_sub(moment_j, rollingcontactmoment);
     }
+  };
+
+  // the tangential and rolling contact histories are inserted into maps shared by all particle
+  // pairs, hence only normal contact is evaluated on the threads of this processor
+  if (contacttangential_ or contactrolling_)
+  {
+    for (const auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
+      evaluate_particle_pair(particlepair);
   }
+  else
+    neighborpairs_->for_each_particle_pair(evaluate_particle_pair);
 }
 
-void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
+void ParticleInteraction::DEMContact::evaluate_particle_wall_contact(const double wallforcefac)
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::DEMContact::evaluate_particle_wall_contact");
 
@@ -826,7 +840,7 @@ void ParticleInteraction::DEMContact::evaluate_particle_wall_contact()
       std::vector<double> nodal_force(numnodes * 3);
       for (int node = 0; node < numnodes; ++node)
         for (int dim = 0; dim < 3; ++dim)
-          nodal_force[node * 3 + dim] = funct[node] * wallcontactforce[dim];
+          nodal_force[node * 3 + dim] = wallforcefac * funct[node] * wallcontactforce[dim];
 
       // assemble nodal forces
       const int err = walldatastate->get_force_col()->SumIntoGlobalValues(
@@ -92,8 +92,15 @@ namespace ParticleInteraction
     //! check critical time step (on this processor)
     void check_critical_time_step() const;
 
-    //! add contact contribution to force and moment field
-    void add_force_and_moment_contribution();
+    //! add particle contact contribution to force and moment field
+    void add_particle_contact_contribution();
+
+    /*!
+     * \brief add particle-wall contact contribution to force and moment field
+     *
+     * \param[in] wallforcefac factor of contact forces assembled to the wall
+     */
+    void add_particle_wall_contact_contribution(const double wallforcefac);
 
     //! evaluate elastic potential energy contribution
     void evaluate_elastic_potential_energy(double& elasticpotentialenergy) const;
@@ -118,7 +125,7 @@ namespace ParticleInteraction
     void evaluate_particle_contact();
 
     //! evaluate particle-wall contact contribution
-    void evaluate_particle_wall_contact();
+    void evaluate_particle_wall_contact(const double wallforcefac);
 
     //! evaluate particle elastic potential energy contribution
     void evaluate_particle_elastic_potential_energy(double& elasticpotentialenergy) const;
@@ -223,27 +223,28 @@ void ParticleInteraction::DEMHistoryPairs::communicate_history_pairs()
   communicate_specific_history_pairs(particletargets, particlewalladhesionhistorydata_);
 }
 
-void ParticleInteraction::DEMHistoryPairs::update_history_pairs()
+void ParticleInteraction::DEMHistoryPairs::update_history_pairs(
+    const bool contact, const bool wallcontact, const bool adhesion)
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::DEMHistoryPairs::UpdateHistoryPairs");
 
   // erase untouched history pairs
-  if (not particletangentialhistorydata_.empty())
+  if (contact and not particletangentialhistorydata_.empty())
     erase_untouched_history_pairs(particletangentialhistorydata_);
 
-  if (not particlewalltangentialhistorydata_.empty())
+  if (wallcontact and not particlewalltangentialhistorydata_.empty())
     erase_untouched_history_pairs(particlewalltangentialhistorydata_);
 
-  if (not particlerollinghistorydata_.empty())
+  if (contact and not particlerollinghistorydata_.empty())
     erase_untouched_history_pairs(particlerollinghistorydata_);
 
-  if (not particlewallrollinghistorydata_.empty())
+  if (wallcontact and not particlewallrollinghistorydata_.empty())
     erase_untouched_history_pairs(particlewallrollinghistorydata_);
 
-  if (not particleadhesionhistorydata_.empty())
+  if (adhesion and not particleadhesionhistorydata_.empty())
     erase_untouched_history_pairs(particleadhesionhistorydata_);
 
-  if (not particlewalladhesionhistorydata_.empty())
+  if (adhesion and not particlewalladhesionhistorydata_.empty())
     erase_untouched_history_pairs(particlewalladhesionhistorydata_);
 }
 
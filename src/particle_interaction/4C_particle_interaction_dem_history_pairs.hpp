@@ -122,8 +122,17 @@ namespace ParticleInteraction
     //! communicate history pairs
     void communicate_history_pairs();
 
-    //! update history pairs
-    void update_history_pairs();
+    /*!
+     * \brief update history pairs
+     *
+     * Only history pairs of evaluated interactions are updated, such that the history of
+     * interactions sub-cycled in multiple time stepping persists in between their evaluations.
+     *
+     * \param[in] contact    update history pairs of particle contact
+     * \param[in] wallcontact update history pairs of particle-wall contact
+     * \param[in] adhesion   update history pairs of particle and particle-wall adhesion
+     */
+    void update_history_pairs(const bool contact, const bool wallcontact, const bool adhesion);
 
    private:
     //! communicate specific history pairs
@@ -23,7 +23,8 @@ FOUR_C_NAMESPACE_OPEN
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs()
+ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs(const Teuchos::ParameterList& params)
+    : particlepairloop_(params.get<bool>("PARALLEL_PAIR_EVALUATION"))
 {
   // empty constructor
 }
@@ -73,6 +74,9 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs()
   // clear particle pair data
   particlepairdata_.clear();
 
+  // clear colorings of particle pairs
+  particlepairloop_.reset();
+
   // iterate over potential particle neighbors
   for (const auto& potentialneighbors :
       particleengineinterface_->get_potential_particle_neighbors())
@@ -16,6 +16,9 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_dem_neighbor_pair_struct.hpp"
+#include "4C_particle_interaction_pair_loop.hpp"
+
+#include <Teuchos_ParameterList.hpp>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -51,7 +54,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit DEMNeighborPairs();
+    explicit DEMNeighborPairs(const Teuchos::ParameterList& params);
 
     //! init neighbor pair handler
     void init();
@@ -67,6 +70,18 @@ namespace ParticleInteraction
       return particlepairdata_;
     };
 
+    /*!
+     * \brief evaluate @p function for all particle pairs
+     *
+     * The particle pairs are evaluated on the threads of this processor if enabled, see
+     * ParticlePairLoop for the requirements on @p function.
+     */
+    template <typename Function>
+    void for_each_particle_pair(Function&& function)
+    {
+      particlepairloop_.for_each(particlepairdata_, function);
+    }
+
     //! get reference to particle-wall pair data
     inline const DEMParticleWallPairData& get_ref_to_particle_wall_pair_data() const
     {
@@ -107,6 +122,9 @@ namespace ParticleInteraction
     //! particle pair data with evaluated quantities
     DEMParticlePairData particlepairdata_;
 
+    //! loop over particle pairs
+    ParticlePairLoop particlepairloop_;
+
     //! particle-wall pair data with evaluated quantities
     DEMParticleWallPairData particlewallpairdata_;
 
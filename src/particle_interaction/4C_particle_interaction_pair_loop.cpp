@@ -0,0 +1,91 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_particle_interaction_pair_loop.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <unordered_map>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | definitions                                                               |
+ *---------------------------------------------------------------------------*/
+ParticleInteraction::ParticlePairLoop::Coloring ParticleInteraction::ParticlePairLoop::color(
+    const std::vector<int>& pairindices,
+    const std::vector<std::pair<std::uint64_t, std::uint64_t>>& particlekeys)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::ParticlePairLoop::color");
+
+  const int numpairs = static_cast<int>(pairindices.size());
+
+  // number the particles of all pairs consecutively
+  std::unordered_map<std::uint64_t, int> particleids;
+  particleids.reserve(2 * numpairs);
+  std::vector<std::pair<int, int>> pairparticles(numpairs);
+  for (int k = 0; k < numpairs; ++k)
+  {
+    pairparticles[k].first =
+        particleids.emplace(particlekeys[k].first, particleids.size()).first->second;
+    pairparticles[k].second =
+        particleids.emplace(particlekeys[k].second, particleids.size()).first->second;
+  }
+
+  // colors used by each particle as bit mask
+  constexpr int bitsperword = 64;
+  std::vector<std::vector<std::uint64_t>> usedcolors(particleids.size());
+
+  // assign the smallest color not yet used by both particles to each pair
+  std::vector<int> paircolor(numpairs);
+  int numcolors = 0;
+  for (int k = 0; k < numpairs; ++k)
+  {
+    std::vector<std::uint64_t>& used_i = usedcolors[pairparticles[k].first];
+    std::vector<std::uint64_t>& used_j = usedcolors[pairparticles[k].second];
+
+    int color = 0;
+    for (std::size_t word = 0;; ++word)
+    {
+      const std::uint64_t used = (word < used_i.size() ? used_i[word] : 0) |
+                                 (word < used_j.size() ? used_j[word] : 0);
+      if (~used != 0)
+      {
+        color = static_cast<int>(word) * bitsperword + std::countr_one(used);
+        break;
+      }
+    }
+
+    const std::size_t word = color / bitsperword;
+    const std::uint64_t bit = std::uint64_t{1} << (color % bitsperword);
+    for (std::vector<std::uint64_t>* used : {&used_i, &used_j})
+    {
+      if (used->size() <= word) used->resize(word + 1, 0);
+      (*used)[word] |= bit;
+    }
+
+    paircolor[k] = color;
+    numcolors = std::max(numcolors, color + 1);
+  }
+
+  // sort the pair indices by color keeping their order within each color
+  Coloring coloring;
+  coloring.key = pairindices;
+  coloring.offsets.assign(numcolors + 1, 0);
+  for (int k = 0; k < numpairs; ++k) ++coloring.offsets[paircolor[k] + 1];
+  std::partial_sum(coloring.offsets.begin(), coloring.offsets.end(), coloring.offsets.begin());
+
+  coloring.pairindices.resize(numpairs);
+  std::vector<int> fill(coloring.offsets.begin(), coloring.offsets.end() - 1);
+  for (int k = 0; k < numpairs; ++k) coloring.pairindices[fill[paircolor[k]]++] = pairindices[k];
+
+  return coloring;
+}
+
+FOUR_C_NAMESPACE_CLOSE
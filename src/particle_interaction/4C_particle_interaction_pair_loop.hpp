@@ -0,0 +1,175 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_PAIR_LOOP_HPP
+#define FOUR_C_PARTICLE_INTERACTION_PAIR_LOOP_HPP
+
+/*---------------------------------------------------------------------------*
+ | headers                                                                   |
+ *---------------------------------------------------------------------------*/
+#include "4C_config.hpp"
+
+#include "4C_particle_engine_typedefs.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | class declarations                                                        |
+ *---------------------------------------------------------------------------*/
+namespace ParticleInteraction
+{
+  /*!
+   * \brief Loop over particle pairs evaluated on the threads of a process
+   *
+   * Particle pair interactions are evaluated once per pair and add their contributions to the
+   * states of both particles. To evaluate the pairs concurrently without atomic operations, the
+   * pairs are colored greedily in the order of the pair indices such that no two pairs of the
+   * same color share a particle. The colors are evaluated one after another, the pairs of one
+   * color in parallel in the default host execution space of Kokkos.
+   *
+   * Every particle receives at most one contribution per color, i.e., the order of the
+   * contributions to a particle only depends on the coloring and the results are independent of
+   * the number of threads. In serial mode, the pairs are evaluated in the order of the pair
+   * indices.
+   *
+   * The colorings of all evaluated sets of pair indices are kept until reset() is called, which
+   * has to be done whenever the pair data is rebuilt.
+   *
+   * \note Evaluated functions may only write to the states of the two particles of a pair.
+   */
+  class ParticlePairLoop final
+  {
+   public:
+    //! constructor
+    explicit ParticlePairLoop(bool parallel) : parallel_(parallel) {}
+
+    //! whether pairs are evaluated in parallel
+    [[nodiscard]] bool parallel() const { return parallel_; }
+
+    //! invalidate all colorings after the pair data changed
+    void reset() { colorings_.clear(); }
+
+    //! evaluate @p function for all pairs of @p pairdata
+    template <typename PairData, typename Function>
+    void for_each(const PairData& pairdata, Function&& function)
+    {
+      if (not parallel_)
+      {
+        for (const auto& pair : pairdata) function(pair);
+        return;
+      }
+
+      std::vector<int> pairindices(pairdata.size());
+      std::iota(pairindices.begin(), pairindices.end(), 0);
+      for_each(pairdata, pairindices, function);
+    }
+
+    //! evaluate @p function for the pairs of @p pairdata with indices @p pairindices
+    template <typename PairData, typename Function>
+    void for_each(
+        const PairData& pairdata, const std::vector<int>& pairindices, Function&& function)
+    {
+      if (not parallel_)
+      {
+        for (const int pairindex : pairindices) function(pairdata[pairindex]);
+        return;
+      }
+
+      const Coloring& coloring = get_coloring(pairdata, pairindices);
+
+      std::exception_ptr exception;
+      std::mutex exception_mutex;
+
+      for (std::size_t color = 0; color + 1 < coloring.offsets.size(); ++color)
+      {
+        Kokkos::parallel_for("ParticleInteraction::ParticlePairLoop::for_each",
+            Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+                coloring.offsets[color], coloring.offsets[color + 1]),
+            [&](const int k)
+            {
+              // exceptions must not leave the parallel region
+              try
+              {
+                function(pairdata[coloring.pairindices[k]]);
+              }
+              catch (...)
+              {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (not exception) exception = std::current_exception();
+              }
+            });
+
+        if (exception) std::rethrow_exception(exception);
+      }
+    }
+
+   private:
+    //! pair indices sorted by color
+    struct Coloring
+    {
+      //! pair indices the coloring was computed for
+      std::vector<int> key;
+
+      //! offsets of the colors into pairindices
+      std::vector<int> offsets;
+
+      //! pair indices of all colors
+      std::vector<int> pairindices;
+    };
+
+    //! unique key of a particle
+    static std::uint64_t particle_key(const PARTICLEENGINE::LocalIndexTuple& tuple)
+    {
+      return (static_cast<std::uint64_t>(std::get<0>(tuple)) << 40) |
+             (static_cast<std::uint64_t>(std::get<1>(tuple)) << 32) |
+             static_cast<std::uint32_t>(std::get<2>(tuple));
+    }
+
+    //! get (and compute if necessary) the coloring of the pairs with indices @p pairindices
+    template <typename PairData>
+    const Coloring& get_coloring(const PairData& pairdata, const std::vector<int>& pairindices)
+    {
+      for (const Coloring& coloring : colorings_)
+        if (coloring.key == pairindices) return coloring;
+
+      std::vector<std::pair<std::uint64_t, std::uint64_t>> particlekeys;
+      particlekeys.reserve(pairindices.size());
+      for (const int pairindex : pairindices)
+      {
+        particlekeys.emplace_back(particle_key(pairdata[pairindex].tuple_i_),
+            particle_key(pairdata[pairindex].tuple_j_));
+      }
+
+      colorings_.emplace_back(color(pairindices, particlekeys));
+      return colorings_.back();
+    }
+
+    //! greedy coloring of the pairs with indices @p pairindices and keys of both particles
+    static Coloring color(const std::vector<int>& pairindices,
+        const std::vector<std::pair<std::uint64_t, std::uint64_t>>& particlekeys);
+
+    //! whether pairs are evaluated in parallel
+    const bool parallel_;
+
+    //! colorings of all evaluated sets of pair indices
+    std::vector<Coloring> colorings_;
+  };
+}  // namespace ParticleInteraction
+
+/*---------------------------------------------------------------------------*/
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
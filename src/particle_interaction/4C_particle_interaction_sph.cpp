@@ -483,7 +483,7 @@ void ParticleInteraction::ParticleInteractionSPH::init_equation_of_state_bundle(
 void ParticleInteraction::ParticleInteractionSPH::init_neighbor_pair_handler()
 {
   // create neighbor pair handler
-  neighborpairs_ = std::make_shared<ParticleInteraction::SPHNeighborPairs>();
+  neighborpairs_ = std::make_shared<ParticleInteraction::SPHNeighborPairs>(params_);
 
   // init neighbor pair handler
   neighborpairs_->init();
@@ -248,12 +248,9 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution()
   neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(
       allfluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -400,7 +397,10 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution()
           particlepair.dWdrji_, dens_ij, h_ij, c_ij, particlepair.absdist_, particlepair.e_ij_,
           acc_i, acc_j);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution() const
@@ -413,12 +413,9 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
   neighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
       intfluidtypes_, boundarytypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -580,7 +577,10 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
 
     // add contribution to neighboring boundary particle j
     if (force_j) Utils::vec_add_scale(force_j, -mass_i[0], acc_ij);
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_wall_contribution() const
@@ -23,7 +23,8 @@ FOUR_C_NAMESPACE_OPEN
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs()
+ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs(const Teuchos::ParameterList& params)
+    : particlepairloop_(params.get<bool>("PARALLEL_PAIR_EVALUATION"))
 {
   // empty constructor
 }
@@ -121,6 +122,9 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
   // clear particle pair data
   particlepairdata_.clear();
 
+  // clear colorings of particle pairs
+  particlepairloop_.reset();
+
   // clear index of particle pairs for each type
   for (const auto& type_i : particlecontainerbundle_->get_particle_types())
     for (const auto& type_j : particlecontainerbundle_->get_particle_types())
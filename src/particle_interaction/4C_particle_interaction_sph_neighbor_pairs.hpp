@@ -15,8 +15,11 @@
 
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
+#include "4C_particle_interaction_pair_loop.hpp"
 #include "4C_particle_interaction_sph_neighbor_pair_struct.hpp"
 
+#include <Teuchos_ParameterList.hpp>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -58,7 +61,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit SPHNeighborPairs();
+    explicit SPHNeighborPairs(const Teuchos::ParameterList& params);
 
     //! init neighbor pair handler
     void init();
@@ -81,6 +84,25 @@ namespace ParticleInteraction
       return particlewallpairdata_;
     };
 
+    /*!
+     * \brief evaluate @p function for all particle pairs
+     *
+     * The particle pairs are evaluated on the threads of this processor if enabled, see
+     * ParticlePairLoop for the requirements on @p function.
+     */
+    template <typename Function>
+    void for_each_particle_pair(Function&& function)
+    {
+      particlepairloop_.for_each(particlepairdata_, function);
+    }
+
+    //! evaluate @p function for the particle pairs with indices @p relindices
+    template <typename Function>
+    void for_each_particle_pair(const std::vector<int>& relindices, Function&& function)
+    {
+      particlepairloop_.for_each(particlepairdata_, relindices, function);
+    }
+
     //! get relevant particle pair indices for disjoint combination of particle types
     void get_relevant_particle_pair_indices_for_disjoint_combination(
         const std::set<PARTICLEENGINE::TypeEnum>& types_a,
@@ -107,6 +129,9 @@ namespace ParticleInteraction
     //! particle pair data with evaluated quantities
     SPHParticlePairData particlepairdata_;
 
+    //! loop over particle pairs
+    ParticlePairLoop particlepairloop_;
+
     //! particle-wall pair data with evaluated quantities
     SPHParticleWallPairData particlewallpairdata_;
 
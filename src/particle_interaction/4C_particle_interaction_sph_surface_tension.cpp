@@ -291,12 +291,9 @@ void ParticleInteraction::SPHSurfaceTension::compute_colorfield_gradient() const
   std::vector<int> relindices;
   neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(fluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -309,7 +306,7 @@ void ParticleInteraction::SPHSurfaceTension::compute_colorfield_gradient() const
     std::tie(type_j, status_j, particle_j) = particlepair.tuple_j_;
 
     // no evaluation for particles of same type
-    if (type_i == type_j) continue;
+    if (type_i == type_j) return;
 
     // get corresponding particle containers
     PARTICLEENGINE::ParticleContainer* container_i =
@@ -340,7 +337,10 @@ void ParticleInteraction::SPHSurfaceTension::compute_colorfield_gradient() const
     if (status_j == PARTICLEENGINE::Owned)
       Utils::vec_add_scale(
           cfg_j, -dens_j[0] / V_j * fac * particlepair.dWdrji_, particlepair.e_ij_);
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 
   // iterate over fluid particle types
   for (const auto& type_i : fluidtypes_)
@@ -417,12 +417,9 @@ void ParticleInteraction::SPHSurfaceTension::compute_wall_colorfield_and_wall_in
   neighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
       boundarytypes_, fluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -517,7 +514,10 @@ void ParticleInteraction::SPHSurfaceTension::compute_wall_colorfield_and_wall_in
       wallcf_j[0] += tempfac * fac * particlepair.Wji_;
       Utils::vec_add_scale(wallifn_j, -tempfac * fac * particlepair.dWdrji_, particlepair.e_ij_);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 
   // iterate over fluid particle types
   for (const auto& type_i : fluidtypes_)
@@ -678,12 +678,9 @@ void ParticleInteraction::SPHSurfaceTension::compute_curvature() const
   std::vector<int> relindices;
   neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(fluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -718,7 +715,7 @@ void ParticleInteraction::SPHSurfaceTension::compute_curvature() const
         container_j->cond_get_ptr_to_state(PARTICLEENGINE::Temperature, particle_j);
 
     // evaluation only for non-zero interface normals
-    if (not(Utils::vec_norm_two(ifn_i) > 0.0) or not(Utils::vec_norm_two(ifn_j) > 0.0)) continue;
+    if (not(Utils::vec_norm_two(ifn_i) > 0.0) or not(Utils::vec_norm_two(ifn_j) > 0.0)) return;
 
     // change sign of interface normal for different particle types
     double signfac = (type_i == type_j) ? 1.0 : -1.0;
@@ -760,7 +757,10 @@ void ParticleInteraction::SPHSurfaceTension::compute_curvature() const
           signfac * tempfac * V_i * nij_eij * particlepair.dWdrji_;
       sumj_Vj_Wij[type_j][particle_j] += tempfac * V_i * particlepair.Wji_;
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 
   // iterate over fluid particle types
   for (const auto& type_i : fluidtypes_)
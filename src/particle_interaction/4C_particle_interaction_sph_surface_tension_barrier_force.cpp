@@ -102,12 +102,9 @@ void ParticleInteraction::SPHBarrierForce::compute_barrier_force_particle_contri
   std::vector<int> relindices;
   neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(fluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -173,7 +170,10 @@ void ParticleInteraction::SPHBarrierForce::compute_barrier_force_particle_contri
       if (status_j == PARTICLEENGINE::Owned)
         Utils::vec_add_scale(acc_j, fac / mass_j[0], particlepair.e_ij_);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHBarrierForce::compute_barrier_force_particle_boundary_contribution()
@@ -184,12 +184,9 @@ void ParticleInteraction::SPHBarrierForce::compute_barrier_force_particle_bounda
   neighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
       fluidtypes_, boundarytypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -268,7 +265,10 @@ void ParticleInteraction::SPHBarrierForce::compute_barrier_force_particle_bounda
       // sum contribution of neighboring particle j
       if (acc_i) Utils::vec_add_scale(acc_i, -fac / mass_i[0], e_ij);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 FOUR_C_NAMESPACE_CLOSE
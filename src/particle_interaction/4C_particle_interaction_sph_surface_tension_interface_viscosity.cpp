@@ -135,12 +135,9 @@ void ParticleInteraction::SPHInterfaceViscosity::compute_interface_viscosity_par
   std::vector<int> relindices;
   neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(fluidtypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -226,7 +223,10 @@ void ParticleInteraction::SPHInterfaceViscosity::compute_interface_viscosity_par
           particlepair.dWdrij_, particlepair.dWdrji_, dens_ij, h_ij, c_ij, particlepair.absdist_,
           particlepair.e_ij_, acc_i, acc_j);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHInterfaceViscosity::
@@ -237,12 +237,9 @@ void ParticleInteraction::SPHInterfaceViscosity::
   neighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
       fluidtypes_, boundarytypes_, relindices);
 
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate relevant particle pair
+  const auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -338,7 +335,10 @@ void ParticleInteraction::SPHInterfaceViscosity::
       artificialviscosity_->artificial_viscosity(vel_i, vel_j, mass_i, mass_j, artvisc_i, 0.0,
           dWdrij, 0.0, dens_ij, h_i, c_i, absdist, e_ij, acc_i, nullptr);
     }
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair(relindices, evaluate_particle_pair);
 }
 
 FOUR_C_NAMESPACE_CLOSE
@@ -22,6 +22,8 @@
 #include "4C_utils_fad.hpp"
 #include "4C_utils_function.hpp"
 
+#include <algorithm>
+#include <cmath>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -66,6 +68,8 @@ PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distyp
       curr_segment_length_(0.0),
       constant_part_evaluated_(false),
       coupling_element_type_(""),
+      projection_cache_tol_(0.0),
+      ele2sizeref_(0.0),
       artdiam_funct_(nullptr),
       porosityname_("porosity"),
       artpressname_("p_art"),
@@ -99,6 +103,10 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
 
   evaluate_in_ref_config_ = fluidcouplingparams.get<bool>("EVALUATE_IN_REF_CONFIG");
 
+  projection_cache_tol_ = fluidcouplingparams.get<double>("PROJECTION_CACHE_TOL");
+  if (projection_cache_tol_ < 0.0)
+    FOUR_C_THROW("PROJECTION_CACHE_TOL must not be negative, got %f", projection_cache_tol_);
+
   evaluate_on_lateral_surface_ = fluidcouplingparams.get<bool>("LATERAL_SURFACE_COUPLING");
 
   coupling_element_type_ = couplingtype;
@@ -272,6 +280,15 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
   // element
   ele2pos_.update(1.0, ele2posref_, 0.0);
 
+  // reference size of continuous discretization element for the tolerance of the projection cache
+  for (unsigned int inode = 1; inode < numnodescont_; ++inode)
+  {
+    double dist_squared = 0.0;
+    for (unsigned int idim = 0; idim < numdim_; ++idim)
+      dist_squared += std::pow(ele2posref_(idim, inode) - ele2posref_(idim, 0), 2);
+    ele2sizeref_ = std::max(ele2sizeref_, std::sqrt(dist_squared));
+  }
+
   // get penalty parameter
   pp_ = penalty;
 
@@ -919,9 +936,10 @@ double PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art,
       myXi.assign(n_gp_, std::vector<double>(numdim_, double{}));
       // recompute eta and xi --> see note in this function
       recompute_eta_and_xi_in_deformed_configuration(segmentlengths, myEta, myXi, etaA, etaB);
+      update_projection_cache(myEta, myXi);
       // actual evaluate
-      evaluate_gpts(myEta, myXi, segmentlengths, forcevec1, forcevec2, stiffmat11, stiffmat12,
-          stiffmat21, stiffmat22);
+      evaluate_gpts(
+          segmentlengths, forcevec1, forcevec2, stiffmat11, stiffmat12, stiffmat21, stiffmat22);
 
       // case where diameter is constant
       integrated_diam = arterydiamref_ * segmentlengths[segmentid_];
@@ -934,8 +952,9 @@ double PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art,
       myXi.assign(n_gp_, std::vector<double>(numdim_, double{}));
       // recompute eta and xi --> see note in this function
       recompute_eta_and_xi_in_deformed_configuration(segmentlengths, myEta, myXi, etaA, etaB);
+      update_projection_cache(myEta, myXi);
       // actual evaluate
-      evaluate_dm_kappa(myEta, myXi, segmentlengths, D_ele, M_ele, Kappa_ele);
+      evaluate_dm_kappa(segmentlengths, D_ele, M_ele, Kappa_ele);
 
       // case where diameter is constant
       integrated_diam = arterydiamref_ * segmentlengths[segmentid_];
@@ -946,6 +965,7 @@ double PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art,
       // define eta and xi
       myEta = eta_;
       myXi = xi_;
+      update_projection_cache(myEta, myXi);
       // actual evaluate
       evaluate_ntp(eta_, xi_, forcevec1, forcevec2, stiffmat11, stiffmat12, stiffmat21, stiffmat22);
       integrated_diam = arterydiamref_ * segmentlengths[0];
@@ -958,11 +978,11 @@ double PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art,
 
   // evaluate the function coupling (with possibly varying diameter)
   if (funct_coupl_active_)
-    evaluate_function_coupling(myEta, myXi, segmentlengths, forcevec1, forcevec2, stiffmat11,
-        stiffmat12, stiffmat21, stiffmat22, integrated_diam);
+    evaluate_function_coupling(segmentlengths, forcevec1, forcevec2, stiffmat11, stiffmat12,
+        stiffmat21, stiffmat22, integrated_diam);
 
   // evaluate derivative of 1D shape function times solid velocity
-  evaluated_nds_solid_vel(myEta, myXi, segmentlengths, *forcevec1, etaA, etaB);
+  evaluated_nds_solid_vel(segmentlengths, *forcevec1, etaA, etaB);
 
   return integrated_diam;
 }
@@ -1180,6 +1200,18 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
     // current length of artery
     arteryelelength_ = std::accumulate(segmentlengths.begin(), segmentlengths.end(), 0.0);
 
+    // reuse the projection of the last evaluation if the deformation did not change (much)
+    if (cached_projection_within_tolerance(segmentlengths))
+    {
+      myEta = projection_cache_.eta;
+      for (int i_gp = 0; i_gp < n_gp_; i_gp++)
+        for (unsigned int idim = 0; idim < numdim_; idim++)
+          myXi[i_gp][idim] = projection_cache_.xi[i_gp](idim);
+      etaA = projection_cache_.eta_a;
+      etaB = projection_cache_.eta_b;
+      return;
+    }
+
     // length of segments [0, 1, ..., this_seg-1]
     double length_so_far = 0.0;
     for (int iseg = 0; iseg < segmentid_; iseg++) length_so_far += segmentlengths[iseg];
@@ -1245,18 +1277,89 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
       // save the converged value
       eta_s_[i_gp] = eta_s.val();
     }  // GP loop
+
+    // remember the state the projection belongs to
+    projection_cache_.ele2pos.update(1.0, ele2pos_, 0.0);
+    projection_cache_.segmentlengths = segmentlengths;
+    projection_cache_.eta_a = etaA;
+    projection_cache_.eta_b = etaB;
+    projection_cache_.deformed_projection_valid = true;
   }  // !evaluate_in_ref_config_
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
+bool PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
+    dim>::cached_projection_within_tolerance(const std::vector<double>& segmentlengths) const
+{
+  const ProjectionCache& cache = projection_cache_;
+  if (!cache.deformed_projection_valid or cache.segmentlengths.size() != segmentlengths.size())
+    return false;
+
+  // nodal positions of the 2D/3D element relative to its size
+  const double pos_tol = projection_cache_tol_ * ele2sizeref_;
+  for (unsigned int inode = 0; inode < numnodescont_; ++inode)
+    for (unsigned int idim = 0; idim < numdim_; ++idim)
+      if (std::abs(ele2pos_(idim, inode) - cache.ele2pos(idim, inode)) > pos_tol) return false;
+
+  // segment lengths relative to the length of the artery element
+  const double length_tol = projection_cache_tol_ * arteryelelengthref_;
+  for (unsigned int iseg = 0; iseg < segmentlengths.size(); ++iseg)
+    if (std::abs(segmentlengths[iseg] - cache.segmentlengths[iseg]) > length_tol) return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
 void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
-    dim>::evaluate_gpts(const std::vector<double>& eta, const std::vector<std::vector<double>>& xi,
-    const std::vector<double>& segmentlengths, Core::LinAlg::SerialDenseVector* forcevec1,
-    Core::LinAlg::SerialDenseVector* forcevec2, Core::LinAlg::SerialDenseMatrix* stiffmat11,
-    Core::LinAlg::SerialDenseMatrix* stiffmat12, Core::LinAlg::SerialDenseMatrix* stiffmat21,
-    Core::LinAlg::SerialDenseMatrix* stiffmat22)
+    dim>::update_projection_cache(const std::vector<double>& eta,
+    const std::vector<std::vector<double>>& xi)
+{
+  ProjectionCache& cache = projection_cache_;
+  const std::size_t num_gp = eta.size();
+
+  const auto xi_unchanged = [&]()
+  {
+    for (std::size_t i_gp = 0; i_gp < num_gp; ++i_gp)
+      for (unsigned int idim = 0; idim < numdim_; ++idim)
+        if (cache.xi[i_gp](idim) != xi[i_gp][idim]) return false;
+    return true;
+  };
+  if (!cache.N1.empty() and cache.eta == eta and xi_unchanged()) return;
+
+  cache.eta = eta;
+  cache.xi.resize(num_gp);
+  for (std::size_t i_gp = 0; i_gp < num_gp; ++i_gp)
+    for (unsigned int idim = 0; idim < numdim_; ++idim) cache.xi[i_gp](idim) = xi[i_gp][idim];
+  cache.N1.resize(num_gp);
+  cache.N1_eta.resize(num_gp);
+  cache.N2.resize(num_gp);
+  cache.N2_xi.resize(num_gp);
+  cache.inv_j0.resize(num_gp);
+  cache.det_j0.resize(num_gp);
+
+  for (std::size_t i_gp = 0; i_gp < num_gp; ++i_gp)
+  {
+    get_1d_shape_functions<double>(cache.N1[i_gp], cache.N1_eta[i_gp], eta[i_gp]);
+    get_2d_3d_shape_functions<double>(cache.N2[i_gp], cache.N2_xi[i_gp], xi[i_gp]);
+
+    // dX/dxi and its inverse in reference configuration
+    cache.inv_j0[i_gp].multiply_nt(cache.N2_xi[i_gp], ele2posref_);
+    cache.det_j0[i_gp] = cache.inv_j0[i_gp].invert();
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
+void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
+    dim>::evaluate_gpts(const std::vector<double>& segmentlengths,
+    Core::LinAlg::SerialDenseVector* forcevec1, Core::LinAlg::SerialDenseVector* forcevec2,
+    Core::LinAlg::SerialDenseMatrix* stiffmat11, Core::LinAlg::SerialDenseMatrix* stiffmat12,
+    Core::LinAlg::SerialDenseMatrix* stiffmat21, Core::LinAlg::SerialDenseMatrix* stiffmat22)
 {
   if (numcoupleddofs_ > 0)
   {
@@ -1271,13 +1374,6 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
     // we only have to this once if evaluated in reference configuration
     if (!constant_part_evaluated_ or !evaluate_in_ref_config_)
     {
-      // Vectors for shape functions and their derivatives
-      static Core::LinAlg::Matrix<1, numnodesart_> N1(true);      // = N1
-      static Core::LinAlg::Matrix<1, numnodesart_> N1_eta(true);  // = N1,eta
-
-      static Core::LinAlg::Matrix<1, numnodescont_> N2(true);           // = N2
-      static Core::LinAlg::Matrix<numdim_, numnodescont_> N2_xi(true);  // = N2,xi1
-
       gpts_ntp_stiffmat11_.shape(dim1_, dim1_);
       gpts_ntp_stiffmat12_.shape(dim1_, dim2_);
       gpts_ntp_stiffmat21_.shape(dim2_, dim1_);
@@ -1289,16 +1385,10 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
       {
         // Get constant values from projection
         const double w_gp = wgp_[i_gp];
-        const double myeta = eta[i_gp];
         const double jac = curr_seg_length / 2.0;
-        const std::vector<double> myxi = xi[i_gp];
 
-        // Update shape functions and their derivatives for 1D and 2D/3D element
-        get_1d_shape_functions<double>(N1, N1_eta, myeta);
-        get_2d_3d_shape_functions<double>(N2, N2_xi, myxi);
-
-        // evaluate
-        evaluate_gpts_stiff(w_gp, N1, N2, jac, pp_);
+        // evaluate with cached shape functions for 1D and 2D/3D element
+        evaluate_gpts_stiff(w_gp, projection_cache_.N1[i_gp], projection_cache_.N2[i_gp], jac, pp_);
       }
     }  //! constant_part_evaluated_ or !evaluate_in_ref_config_
 
@@ -1372,8 +1462,7 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
  *----------------------------------------------------------------------*/
 template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
 void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
-    dim>::evaluate_dm_kappa(const std::vector<double>& eta,
-    const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    dim>::evaluate_dm_kappa(const std::vector<double>& segmentlengths,
     Core::LinAlg::SerialDenseMatrix* D_ele, Core::LinAlg::SerialDenseMatrix* M_ele,
     Core::LinAlg::SerialDenseVector* Kappa_ele)
 {
@@ -1392,13 +1481,6 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
     // we only have to this once if evaluated in reference configuration
     if (!constant_part_evaluated_ or !evaluate_in_ref_config_)
     {
-      // Vectors for shape functions and their derivatives
-      static Core::LinAlg::Matrix<1, numnodesart_> N1(true);      // = N1
-      static Core::LinAlg::Matrix<1, numnodesart_> N1_eta(true);  // = N1,eta
-
-      static Core::LinAlg::Matrix<1, numnodescont_> N2(true);           // = N2
-      static Core::LinAlg::Matrix<numdim_, numnodescont_> N2_xi(true);  // = N2,xi1
-
       d_.shape(dim1_, dim1_);
       m_.shape(dim1_, dim2_);
       kappa_.size(dim1_);
@@ -1409,15 +1491,10 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
       {
         // Get constant values from projection
         const double w_gp = wgp_[i_gp];
-        const double myeta = eta[i_gp];
         const double jac = curr_seg_length / 2.0;
-        const std::vector<double> myxi = xi[i_gp];
-
-        // Update shape functions and their derivatives for 1D and 2D/3D element
-        get_1d_shape_functions<double>(N1, N1_eta, myeta);
-        get_2d_3d_shape_functions<double>(N2, N2_xi, myxi);
 
-        evaluate_dm_kappa(w_gp, N1, N2, jac);
+        // evaluate with cached shape functions for 1D and 2D/3D element
+        evaluate_dm_kappa(w_gp, projection_cache_.N1[i_gp], projection_cache_.N2[i_gp], jac);
       }
     }  //! constant_part_evaluated_ or !evaluate_in_ref_config_
 
@@ -1429,25 +1506,16 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
  *----------------------------------------------------------------------*/
 template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
 void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
-    dim>::evaluate_function_coupling(const std::vector<double>& eta,
-    const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    dim>::evaluate_function_coupling(const std::vector<double>& segmentlengths,
     Core::LinAlg::SerialDenseVector* forcevec1, Core::LinAlg::SerialDenseVector* forcevec2,
     Core::LinAlg::SerialDenseMatrix* stiffmat11, Core::LinAlg::SerialDenseMatrix* stiffmat12,
     Core::LinAlg::SerialDenseMatrix* stiffmat21, Core::LinAlg::SerialDenseMatrix* stiffmat22,
     double& integrated_diam)
 {
-  // Vectors for shape functions and their derivatives
-  static Core::LinAlg::Matrix<1, numnodesart_> N1(true);      // = N1
-  static Core::LinAlg::Matrix<1, numnodesart_> N1_eta(true);  // = N1,eta
-
-  static Core::LinAlg::Matrix<1, numnodescont_> N2(true);            // = N2
   static Core::LinAlg::Matrix<numnodescont_, 1> N2_transpose(true);  // = N2^T
-
-  static Core::LinAlg::Matrix<numdim_, numnodescont_> N2_xi(true);  // = N2,xi1
-  static Core::LinAlg::Matrix<numdim_, numnodescont_> derxy(true);  // = N2,xi1
+  static Core::LinAlg::Matrix<numdim_, numnodescont_> derxy(true);   // = N2,xi1
 
   static Core::LinAlg::Matrix<numdim_, numdim_> xjm;
-  static Core::LinAlg::Matrix<numdim_, numdim_> xjm0;
   static Core::LinAlg::Matrix<numdim_, numdim_> xji;
 
   const double curr_seg_length = segmentlengths[segmentid_];
@@ -1465,22 +1533,20 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
   {
     // Get constant values from projection
     const double w_gp = wgp_[i_gp];
-    const double myeta = eta[i_gp];
-    const std::vector<double> myxi = xi[i_gp];
 
     const double jac = curr_seg_length / 2.0;
 
-    // Update shape functions and their derivatives for 1D and 2D/3D element
-    get_1d_shape_functions<double>(N1, N1_eta, myeta);
-    get_2d_3d_shape_functions<double>(N2, N2_xi, myxi);
+    // cached shape functions and their derivatives for 1D and 2D/3D element
+    const Core::LinAlg::Matrix<1, numnodesart_>& N1 = projection_cache_.N1[i_gp];
+    const Core::LinAlg::Matrix<1, numnodescont_>& N2 = projection_cache_.N2[i_gp];
+    const Core::LinAlg::Matrix<numdim_, numnodescont_>& N2_xi = projection_cache_.N2_xi[i_gp];
     N2_transpose.update_t(N2);
 
     xjm.multiply_nt(N2_xi, ele2pos_);
-    xjm0.multiply_nt(N2_xi, ele2posref_);
 
     const double det = xji.invert(xjm);
-    // inverse of transposed jacobian "ds/dX"
-    const double det0 = xjm0.determinant();
+    // determinant of jacobian "dX/ds" in reference configuration
+    const double det0 = projection_cache_.det_j0[i_gp];
 
     derxy.multiply(xji, N2_xi);
 
@@ -1503,28 +1569,17 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
  *---------------------------------------------------------------------------------*/
 template <Core::FE::CellType distype_art, Core::FE::CellType distype_cont, int dim>
 void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, distype_cont,
-    dim>::evaluated_nds_solid_vel(const std::vector<double>& eta,
-    const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    dim>::evaluated_nds_solid_vel(const std::vector<double>& segmentlengths,
     Core::LinAlg::SerialDenseVector& forcevec1, const double& etaA, const double& etaB)
 {
   if (evaluate_in_ref_config_ || coupltype_ == type_scatra ||
       couplmethod_ == Inpar::ArteryNetwork::ArteryPoroMultiphaseScatraCouplingMethod::ntp)
     return;
 
-  // Vectors for shape functions and their derivatives
-  static Core::LinAlg::Matrix<1, numnodesart_> N1(true);      // = N1
-  static Core::LinAlg::Matrix<1, numnodesart_> N1_eta(true);  // = N1,eta
-
-  static Core::LinAlg::Matrix<1, numnodescont_> N2(true);            // = N2
-  static Core::LinAlg::Matrix<numdim_, numnodescont_> N2_xi(true);   // = N2,xi1
+  // Vectors for shape function derivatives
   static Core::LinAlg::Matrix<numdim_, numnodescont_> N2_XYZ(true);  // = N2,X
   static Core::LinAlg::Matrix<numdim_, numdim_> defgrad(true);       // = dx/dX = F
 
-  static Core::LinAlg::Matrix<numdim_, numdim_> xjm;
-  static Core::LinAlg::Matrix<numdim_, numdim_> xjm0;
-  static Core::LinAlg::Matrix<numdim_, numdim_> invJ;
-  static Core::LinAlg::Matrix<numdim_, numdim_> xji;
-
   static Core::LinAlg::Matrix<numdim_, 1> lambda_t;  // direction in current conf.
 
   // Evaluate $-\int_a^b d N^(1)/ds*pi*R^2 * lambda_t*v_s ds$
@@ -1535,21 +1590,15 @@ void PoroMultiPhaseScaTra::PoroMultiPhaseScatraArteryCouplingPair<distype_art, d
   {
     // Get constant values from projection
     const double w_gp = wgp_[i_gp];
-    const double myeta = eta[i_gp];
-    const std::vector<double> myxi = xi[i_gp];
-
-    // Update shape functions and their derivatives for 1D and 2D/3D element
-    get_1d_shape_functions<double>(N1, N1_eta, myeta);
-    get_2d_3d_shape_functions<double>(N2, N2_xi, myxi);
 
-    xjm.multiply_nt(N2_xi, ele2pos_);
-    xji.invert(xjm);
+    // cached shape functions and their derivatives for 1D and 2D/3D element
+    const Core::LinAlg::Matrix<1, numnodesart_>& N1_eta = projection_cache_.N1_eta[i_gp];
+    const Core::LinAlg::Matrix<1, numnodescont_>& N2 = projection_cache_.N2[i_gp];
+    const Core::LinAlg::Matrix<numdim_, numnodescont_>& N2_xi = projection_cache_.N2_xi[i_gp];
 
-    // dX/dpsi
-    xjm0.multiply_nt(N2_xi, ele2posref_);
     // dpsi/dX
     // note: cannot use invJ_ here -> defined at original Gauss points
-    invJ.invert(xjm0);
+    const Core::LinAlg::Matrix<numdim_, numdim_>& invJ = projection_cache_.inv_j0[i_gp];
     // dN/dX = dN/dxi * dxi/dX = dN/dxi * (dX/dxi)^-1
     N2_XYZ.multiply(invJ, N2_xi);
     // dx/dX = x * N_XYZ^T
@@ -276,6 +276,14 @@ namespace PoroMultiPhaseScaTra
         std::vector<double>& myEta, std::vector<std::vector<double>>& myXi, double& etaA,
         double& etaB);
 
+    //! whether the projection in deformed configuration of the cache can be reused for the
+    //! current positions of the 2D/3D element and the current segment lengths
+    bool cached_projection_within_tolerance(const std::vector<double>& segmentlengths) const;
+
+    //! update the shape functions of the projection cache to the Gauss points @p eta and @p xi
+    void update_projection_cache(
+        const std::vector<double>& eta, const std::vector<std::vector<double>>& xi);
+
     /**
      * \brief create segment [eta_a, eta_b]
      *
@@ -326,9 +334,9 @@ namespace PoroMultiPhaseScaTra
         const Core::LinAlg::Matrix<1, numnodescont_, T>& N2,
         const Core::LinAlg::Matrix<numdim_, numnodescont_, T>& N2_xi);
 
-    //! evaluate the function coupling (return integral of diameter of the segment)
-    void evaluate_function_coupling(const std::vector<double>& eta,
-        const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    //! evaluate the function coupling at the Gauss points of the projection cache (return integral
+    //! of diameter of the segment)
+    void evaluate_function_coupling(const std::vector<double>& segmentlengths,
         Core::LinAlg::SerialDenseVector* forcevec1, Core::LinAlg::SerialDenseVector* forcevec2,
         Core::LinAlg::SerialDenseMatrix* stiffmat11, Core::LinAlg::SerialDenseMatrix* stiffmat12,
         Core::LinAlg::SerialDenseMatrix* stiffmat21, Core::LinAlg::SerialDenseMatrix* stiffmat22,
@@ -336,15 +344,13 @@ namespace PoroMultiPhaseScaTra
 
     /**
      * evaluate derivative of 1D shape function times solid velocity (only porofluid has this term)
-     * @param[in] eta: GP coordinates in artery element parameter space
-     * @param[in] xi: GP coordinates in porofluid element parameter space
+     * at the Gauss points of the projection cache
      * @param[in] segmentlengths: length of all segments of this artery element
      * @param[in] forcevec1: rhs-vector to assemble into
      * @param[in] etaA: beginning of segment in artery element parameter space
      * @param[in] etaB: end of segment in artery element parameter space
      */
-    void evaluated_nds_solid_vel(const std::vector<double>& eta,
-        const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    void evaluated_nds_solid_vel(const std::vector<double>& segmentlengths,
         Core::LinAlg::SerialDenseVector& forcevec1, const double& etaA, const double& etaB);
 
     //! evaluate stiffness for GPTS case
@@ -359,12 +365,11 @@ namespace PoroMultiPhaseScaTra
     void evaluate_dm_kappa(const double& w_gp, const Core::LinAlg::Matrix<1, numnodesart_>& N1,
         const Core::LinAlg::Matrix<1, numnodescont_>& N2, const double& jacobi);
 
-    //! evaluate GPTS
-    void evaluate_gpts(const std::vector<double>& eta, const std::vector<std::vector<double>>& xi,
-        const std::vector<double>& segmentlengths, Core::LinAlg::SerialDenseVector* forcevec1,
-        Core::LinAlg::SerialDenseVector* forcevec2, Core::LinAlg::SerialDenseMatrix* stiffmat11,
-        Core::LinAlg::SerialDenseMatrix* stiffmat12, Core::LinAlg::SerialDenseMatrix* stiffmat21,
-        Core::LinAlg::SerialDenseMatrix* stiffmat22);
+    //! evaluate GPTS at the Gauss points of the projection cache
+    void evaluate_gpts(const std::vector<double>& segmentlengths,
+        Core::LinAlg::SerialDenseVector* forcevec1, Core::LinAlg::SerialDenseVector* forcevec2,
+        Core::LinAlg::SerialDenseMatrix* stiffmat11, Core::LinAlg::SerialDenseMatrix* stiffmat12,
+        Core::LinAlg::SerialDenseMatrix* stiffmat21, Core::LinAlg::SerialDenseMatrix* stiffmat22);
 
     //! evaluate NTP
     void evaluate_ntp(const std::vector<double>& eta, const std::vector<std::vector<double>>& xi,
@@ -372,9 +377,8 @@ namespace PoroMultiPhaseScaTra
         Core::LinAlg::SerialDenseMatrix* stiffmat11, Core::LinAlg::SerialDenseMatrix* stiffmat12,
         Core::LinAlg::SerialDenseMatrix* stiffmat21, Core::LinAlg::SerialDenseMatrix* stiffmat22);
 
-    //! evaluate mortar coupling matrices D and M
-    void evaluate_dm_kappa(const std::vector<double>& eta,
-        const std::vector<std::vector<double>>& xi, const std::vector<double>& segmentlengths,
+    //! evaluate mortar coupling matrices D and M at the Gauss points of the projection cache
+    void evaluate_dm_kappa(const std::vector<double>& segmentlengths,
         Core::LinAlg::SerialDenseMatrix* D_ele, Core::LinAlg::SerialDenseMatrix* M_ele,
         Core::LinAlg::SerialDenseVector* Kappa_ele);
 
@@ -664,6 +668,51 @@ namespace PoroMultiPhaseScaTra
     //! (dX/dxi)^-1
     std::vector<Core::LinAlg::Matrix<numdim_, numdim_>> inv_j_;
 
+    /*!
+     * \brief Projection of the Gauss points of this pair and shape functions at these points
+     *
+     * The projection of the Gauss points in deformed configuration requires local Newton
+     * iterations for every Gauss point. It is reused as long as the nodal positions of the 2D/3D
+     * element and the segment lengths of the artery element change less than the tolerance. The
+     * shape functions are reused as long as the Gauss points do not change, i.e., for all
+     * evaluations in reference configuration.
+     */
+    struct ProjectionCache
+    {
+      //! whether the projection in deformed configuration is set
+      bool deformed_projection_valid = false;
+      //! nodal positions of the 2D/3D element the projection in deformed configuration belongs to
+      Core::LinAlg::Matrix<numdim_, numnodescont_> ele2pos;
+      //! segment lengths the projection in deformed configuration belongs to
+      std::vector<double> segmentlengths;
+      //! bounds of the integration segment in deformed configuration
+      double eta_a = 0.0;
+      double eta_b = 0.0;
+
+      //! Gauss points in artery and 2D/3D element parameter space
+      std::vector<double> eta;
+      std::vector<Core::LinAlg::Matrix<numdim_, 1>> xi;
+      //! shape functions and derivatives of the artery element at the Gauss points
+      std::vector<Core::LinAlg::Matrix<1, numnodesart_>> N1;
+      std::vector<Core::LinAlg::Matrix<1, numnodesart_>> N1_eta;
+      //! shape functions and derivatives of the 2D/3D element at the Gauss points
+      std::vector<Core::LinAlg::Matrix<1, numnodescont_>> N2;
+      std::vector<Core::LinAlg::Matrix<numdim_, numnodescont_>> N2_xi;
+      //! (dX/dxi)^-1 and det(dX/dxi) of the 2D/3D element at the Gauss points
+      std::vector<Core::LinAlg::Matrix<numdim_, numdim_>> inv_j0;
+      std::vector<double> det_j0;
+    };
+
+    //! projection cache of this pair
+    ProjectionCache projection_cache_;
+
+    //! relative tolerance of the nodal positions and segment lengths for reusing the projection
+    //! in deformed configuration
+    double projection_cache_tol_;
+
+    //! size of the 2D/3D element in reference configuration (largest distance to first node)
+    double ele2sizeref_;
+
     //! phase manager of the fluid
     std::shared_ptr<Discret::Elements::PoroFluidManager::PhaseManagerInterface> phasemanager_;
 
@@ -18,9 +18,11 @@
 #include "4C_inpar_problemtype.hpp"
 #include "4C_io_legacy_table.hpp"
 #include "4C_rigidsphere.hpp"
+#include "4C_utils_string.hpp"
 
 #include <Epetra_MpiComm.h>
 
+#include <algorithm>
 #include <stack>
 
 FOUR_C_NAMESPACE_OPEN
@@ -34,7 +36,7 @@ FOUR_C_NAMESPACE_OPEN
  * the Constructor of PostProblem
  *----------------------------------------------------------------------*/
 PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** argv)
-    : start_(0), end_(-1), step_(1), mortar_(false)
+    : start_(0), end_(-1), step_(1), mortar_(false), parallel_steps_(false)
 {
   using namespace FourC;
 
@@ -48,6 +50,8 @@ PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** ar
   struct_mat_disp_ = "no";
   struct_rot_ = "no";
   std::string mortar_string = "no";
+  std::string parallel_steps_string = "no";
+  std::string fields_string;
 
   CLP.throwExceptions(false);
   CLP.setOption("filter", &filter_, "filter to run [ensight, gid, vtu, vtu_node_based, vti]");
@@ -81,6 +85,11 @@ PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** ar
   CLP.setOption("structmatdisp", &struct_mat_disp_, "material displacement output output [yes]");
   CLP.setOption("outputtype", &outputtype_,
       "binary (bin) or ascii (ascii) output, option works for vtu filter only");
+  CLP.setOption("parallelsteps", &parallel_steps_string,
+      "distribute result steps instead of the mesh over the processors [yes], option works for "
+      "vtu, vtu_node_based and vti filters only");
+  CLP.setOption("fields", &fields_string,
+      "comma separated list of results to be written [defaults to all results]");
   Teuchos::CommandLineProcessor::EParseCommandLineReturn parseReturn = CLP.parse(argc, argv);
 
   if (parseReturn != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL)
@@ -139,6 +148,19 @@ PostProblem::PostProblem(Teuchos::CommandLineProcessor& CLP, int argc, char** ar
     mortar_ = true;
   }
 
+  if (parallel_steps_string == "yes")
+  {
+    if (filter_ != "vtu" and filter_ != "vtu_node_based" and filter_ != "vti")
+      FOUR_C_THROW("Parallel processing of result steps is not supported by the %s filter.",
+          filter_.c_str());
+    parallel_steps_ = true;
+  }
+
+  if (fields_string != "")
+  {
+    selected_results_ = Core::Utils::split_string_list(fields_string, ",");
+  }
+
   result_group_ = std::vector<MAP*>();
   setup_filter(file, output);
 
@@ -215,6 +237,31 @@ int PostProblem::field_pos(const PostField* field) const
  *----------------------------------------------------------------------*/
 MPI_Comm PostProblem::get_comm() { return comm_; }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool PostProblem::is_my_step(const int timestep) const
+{
+  if (not parallel_steps_) return true;
+  return timestep % Core::Communication::num_mpi_ranks(MPI_COMM_WORLD) ==
+         Core::Communication::my_mpi_rank(MPI_COMM_WORLD);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool PostProblem::is_master_writer() const
+{
+  return Core::Communication::my_mpi_rank(MPI_COMM_WORLD) == 0;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool PostProblem::is_selected_result(const std::string& name) const
+{
+  if (selected_results_.empty()) return true;
+  return std::find(selected_results_.begin(), selected_results_.end(), name) !=
+         selected_results_.end();
+}
+
 
 /*----------------------------------------------------------------------*
  * initializes all the data a filter needs. This function is called by
@@ -224,7 +271,8 @@ void PostProblem::setup_filter(std::string control_file_name, std::string output
 {
   MAP temp_table;
 
-  comm_ = MPI_COMM_WORLD;
+  // every processor reads the whole mesh if the result steps are distributed
+  comm_ = parallel_steps_ ? MPI_COMM_SELF : MPI_COMM_WORLD;
 
   /* The warning system is not set up. It's rather stupid anyway. */
 
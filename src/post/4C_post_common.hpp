@@ -153,6 +153,31 @@ class PostProblem
   //! Is post-processing of mortar interfaces activated?
   bool do_mortar_interfaces() { return mortar_; }
 
+  /*! \brief Result steps are distributed over the processors
+   *
+   *  In this mode, every processor reads the whole mesh on its own (get_comm() returns
+   *  MPI_COMM_SELF) and writes the result steps assigned to it. The output is identical to the
+   *  one of a serial run.
+   */
+  bool parallel_steps() const { return parallel_steps_; }
+
+  /*! \brief Returns whether the result step with the given index is processed on this processor
+   *
+   *  \param timestep [in] Index of the result step (counting the written steps only)
+   */
+  bool is_my_step(const int timestep) const;
+
+  //! Does this processor write the files common to all result steps?
+  bool is_master_writer() const;
+
+  /*! \brief Returns whether a result has been selected for output
+   *
+   *  All results are selected if no selection is given on the command line.
+   *
+   *  \param name [in] Name of the result (result group in the control file or output name)
+   */
+  bool is_selected_result(const std::string& name) const;
+
   //@}
 
  private:
@@ -218,6 +243,12 @@ class PostProblem
   //! Activate post-processing of mortar interfaces
   bool mortar_;
 
+  //! Distribute result steps instead of the mesh over the processors
+  bool parallel_steps_;
+
+  //! names of the results to be written (empty if all results are written)
+  std::vector<std::string> selected_results_;
+
   //! stress output type optionally set by command line argument
   std::string stresstype_;
 
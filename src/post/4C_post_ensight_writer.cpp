@@ -16,6 +16,7 @@
 #include "4C_post_common.hpp"
 #include "4C_xfem_discretization.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <string>
 
@@ -913,6 +914,10 @@ void EnsightWriter::write_result(const std::string groupname, const std::string
     const ResultType restype, const int numdf, const int from /*=0*/,
     const bool fillzeros /*=false*/)
 {
+  if (not field_->problem()->is_selected_result(groupname) and
+      not field_->problem()->is_selected_result(name))
+    return;
+
   PostResult result(field_);
   bool foundit = false;
   while (result.next_result(groupname))
@@ -1309,6 +1314,11 @@ void EnsightWriter::write_special_field(SpecialFieldInterface& special, PostResu
     const ResultType restype, const std::string& groupname,
     const std::vector<std::string>& fieldnames, const std::string& outinfo)
 {
+  if (not field_->problem()->is_selected_result(groupname) and
+      std::none_of(fieldnames.begin(), fieldnames.end(), [&](const std::string& fieldname)
+          { return field_->problem()->is_selected_result(fieldname); }))
+    return;
+
   const int numfiles = fieldnames.size();
 
   // new for file continuation
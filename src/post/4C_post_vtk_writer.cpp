@@ -13,6 +13,7 @@
 #include "4C_post_common.hpp"
 #include "4C_utils_shared_ptr_from_ref.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iomanip>
 
@@ -147,6 +148,11 @@ void PostVtkWriter::write_special_field(SpecialFieldInterface& special,
     const ResultType restype, const std::string& groupname,
     const std::vector<std::string>& fieldnames, const std::string& outinfo)
 {
+  if (not field_->problem()->is_selected_result(groupname) and
+      std::none_of(fieldnames.begin(), fieldnames.end(), [&](const std::string& fieldname)
+          { return field_->problem()->is_selected_result(fieldname); }))
+    return;
+
   // Vtk writes everything into the same file, so create to each output the
   // pointer to the same output writer
   std::vector<std::shared_ptr<std::ofstream>> files(fieldnames.size());
@@ -231,6 +237,10 @@ void PostVtkWriter::write_result(const std::string groupname, const std::string
 {
   using namespace FourC;
 
+  if (not field_->problem()->is_selected_result(groupname) and
+      not field_->problem()->is_selected_result(name))
+    return;
+
   std::shared_ptr<PostResult> result = std::make_shared<PostResult>(field_);
   // only write results which exist in the first result step
   bool foundit = false;
@@ -321,8 +331,6 @@ void PostVtkWriter::write_files(PostFilterBase& filter)
 
   for (timestep_ = 0; timestep_ < (int)soltime.size(); ++timestep_)
   {
-    this->writer_prep_timestep();
-
     {
       std::ostringstream tmpstream;
       tmpstream << field_->name() << "-" << std::setfill('0') << std::setw(ntdigits_) << timestep_;
@@ -333,6 +341,11 @@ void PostVtkWriter::write_files(PostFilterBase& filter)
     filenames.push_back(
         std::pair<double, std::string>(time_, filenamebase_ + this->writer_p_suffix()));
 
+    // in case of distributed result steps, other processors write this step
+    if (not field_->problem()->is_my_step(timestep_)) continue;
+
+    this->writer_prep_timestep();
+
     {
       std::ostringstream tmpstream;
       tmpstream << dirname << "/" << filenamebase_ << "-" << std::setfill('0')
@@ -364,7 +377,7 @@ void PostVtkWriter::write_vtk_master_file(
     const std::vector<std::pair<double, std::string>>& filenames, const std::string& dirname) const
 {
   // finally, write a single masterfile
-  if (myrank_ == 0)
+  if (myrank_ == 0 and field_->problem()->is_master_writer())
   {
     size_t pos = dirname.find_last_of("/");
     if (pos == dirname.npos)
@@ -18,6 +18,7 @@
 #include "4C_mat_maxwell_0d_acinus_NeoHookean.hpp"
 #include "4C_red_airways_elementbase.hpp"
 #include "4C_reduced_lung_helpers.hpp"
+#include "4C_reduced_lung_tree_solver.hpp"
 #include "4C_utils_function_of_time.hpp"
 
 #include <Teuchos_StandardParameterEntryValidators.hpp>
@@ -40,13 +41,20 @@ namespace ReducedLung
     }
     const Teuchos::ParameterList& rawdyn =
         Global::Problem::instance()->reduced_d_airway_dynamic_params();
-    const int linear_solver_number = rawdyn.get<int>("LINEAR_SOLVER");
-    std::unique_ptr<Core::LinAlg::Solver> solver = std::make_unique<Core::LinAlg::Solver>(
-        Global::Problem::instance()->solver_params(linear_solver_number), actdis->get_comm(),
-        Global::Problem::instance()->solver_params_callback(),
-        Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
-            Global::Problem::instance()->io_params(), "VERBOSITY"));
-    actdis->compute_null_space_if_necessary(solver->params());
+    // The tree-structured system is either solved by leaf-to-root elimination or by the given
+    // linear solver.
+    const bool use_tree_solver = rawdyn.get<bool>("TREE_SOLVER");
+    std::unique_ptr<Core::LinAlg::Solver> solver;
+    if (!use_tree_solver)
+    {
+      const int linear_solver_number = rawdyn.get<int>("LINEAR_SOLVER");
+      solver = std::make_unique<Core::LinAlg::Solver>(
+          Global::Problem::instance()->solver_params(linear_solver_number), actdis->get_comm(),
+          Global::Problem::instance()->solver_params_callback(),
+          Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
+              Global::Problem::instance()->io_params(), "VERBOSITY"));
+      actdis->compute_null_space_if_necessary(solver->params());
+    }
     // The existing mpi communicator is recycled for the new data layout.
     const auto& comm = actdis->get_comm();
 
@@ -420,6 +428,14 @@ namespace ReducedLung
       bc.local_dof_id = locally_relevant_dof_map.LID(bc.global_dof_id);
     }
 
+    // Set up the tree solver once the equation and dof numbering is fixed.
+    std::unique_ptr<TreeSolver> tree_solver;
+    if (use_tree_solver)
+    {
+      tree_solver = std::make_unique<TreeSolver>(comm, airways, terminal_units, connections,
+          bifurcations, boundary_conditions, locally_owned_dof_map);
+    }
+
     // Local airway vectors. Potentially add to airway objects in the future.
     std::vector<double> length(n_airways);
     std::vector<double> area(n_airways);
@@ -717,12 +733,17 @@ namespace ReducedLung
         sysmat.FillComplete();
       }
 
-      // Solve.
-      solver->solve(Core::Utils::shared_ptr_from_ref(sysmat), Core::Utils::shared_ptr_from_ref(x),
-          Core::Utils::shared_ptr_from_ref(rhs), {});
-
-      // Update dofs with solution vector.
-      export_to(x, x_mapped_to_dofs);
+      // Solve and update dofs with solution vector.
+      if (use_tree_solver)
+      {
+        tree_solver->solve(sysmat, rhs, x_mapped_to_dofs);
+      }
+      else
+      {
+        solver->solve(Core::Utils::shared_ptr_from_ref(sysmat),
+            Core::Utils::shared_ptr_from_ref(x), Core::Utils::shared_ptr_from_ref(rhs), {});
+        export_to(x, x_mapped_to_dofs);
+      }
       dofs.Update(1.0, x_mapped_to_dofs, 1.0);
       export_to(dofs, locally_relevant_dofs);
 
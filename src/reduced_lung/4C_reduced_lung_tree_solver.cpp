@@ -0,0 +1,467 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_reduced_lung_tree_solver.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <utility>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /*!
+   * @brief Order the nodes of a forest such that all children appear before their parent.
+   *
+   * @param roots Roots of the trees in the forest.
+   * @param children Function returning the children of a node.
+   */
+  template <typename ChildrenFunction>
+  std::vector<int> leaf_to_root_order(const std::vector<int>& roots, ChildrenFunction children)
+  {
+    std::vector<int> order;
+    // Iterative depth first search; a node is added after all of its children were added.
+    std::vector<std::pair<int, bool>> stack;
+    for (const int root : roots)
+    {
+      stack.emplace_back(root, false);
+      while (!stack.empty())
+      {
+        auto [node, expanded] = stack.back();
+        stack.pop_back();
+        if (expanded)
+        {
+          order.push_back(node);
+          continue;
+        }
+        stack.emplace_back(node, true);
+        for (const int child : children(node))
+        {
+          if (child >= 0) stack.emplace_back(child, false);
+        }
+      }
+    }
+    return order;
+  }
+}  // namespace
+
+namespace ReducedLung
+{
+  TreeSolver::TreeSolver(MPI_Comm comm, const std::vector<Airway>& airways,
+      const std::vector<TerminalUnit>& terminal_units, const std::vector<Connection>& connections,
+      const std::vector<Bifurcation>& bifurcations,
+      const std::vector<BoundaryCondition>& boundary_conditions, const Epetra_Map& dof_map)
+      : comm_(comm)
+  {
+    // Locally owned elements.
+    const auto add_element = [&](int global_id, int local_equation_id,
+                                 const std::vector<int>& global_dof_ids,
+                                 const std::vector<int>& local_dof_ids)
+    {
+      TreeElement element;
+      element.global_id = global_id;
+      element.local_equation_id = local_equation_id;
+      element.local_q_column_id = local_dof_ids[q_in];
+      element.local_dof_ids = {dof_map.LID(global_dof_ids[p_in]),
+          dof_map.LID(global_dof_ids[p_out]), dof_map.LID(global_dof_ids[q_in])};
+      local_index_[global_id] = static_cast<int>(elements_.size());
+      elements_.push_back(element);
+    };
+    for (const Airway& airway : airways)
+    {
+      FOUR_C_ASSERT_ALWAYS(airway.airway_type == AirwayType::resistive,
+          "The tree solver only supports resistive airways.");
+      add_element(airway.global_equation_id, airway.local_equation_id, airway.global_dof_ids,
+          airway.local_dof_ids);
+    }
+    for (const TerminalUnit& terminal_unit : terminal_units)
+    {
+      add_element(terminal_unit.global_equation_id, terminal_unit.local_equation_id,
+          terminal_unit.global_dof_ids, terminal_unit.local_dof_ids);
+    }
+
+    // Equations at the element outlets. Entities at the outlet of an element are always created on
+    // the rank owning the element.
+    const auto outlet_element = [&](int global_id) -> TreeElement&
+    {
+      const auto it = local_index_.find(global_id);
+      FOUR_C_ASSERT_ALWAYS(it != local_index_.end(),
+          "Outlet entity of element %d is not owned by the owner of the element.", global_id);
+      return elements_[it->second];
+    };
+    for (const Connection& conn : connections)
+    {
+      TreeElement& element = outlet_element(conn.global_parent_element_id);
+      element.outlet_type = OutletType::connection;
+      element.outlet_equation_ids = {
+          conn.first_local_equation_id, conn.first_local_equation_id + 1, -1};
+      element.children = {conn.global_child_element_id, -1};
+    }
+    for (const Bifurcation& bif : bifurcations)
+    {
+      TreeElement& element = outlet_element(bif.global_parent_element_id);
+      element.outlet_type = OutletType::bifurcation;
+      element.outlet_equation_ids = {bif.first_local_equation_id, bif.first_local_equation_id + 1,
+          bif.first_local_equation_id + 2};
+      element.children = {bif.global_child_1_element_id, bif.global_child_2_element_id};
+    }
+    for (const BoundaryCondition& bc : boundary_conditions)
+    {
+      TreeElement& element = outlet_element(bc.global_element_id);
+      switch (bc.bc_type)
+      {
+        case BoundaryConditionType::pressure_in:
+          element.inlet_equation_id = bc.local_equation_id;
+          break;
+        case BoundaryConditionType::pressure_out:
+          element.outlet_type = OutletType::boundary_condition;
+          element.outlet_equation_ids = {bc.local_equation_id, -1, -1};
+          break;
+        default:
+          FOUR_C_THROW("The tree solver only supports pressure boundary conditions.");
+      }
+    }
+    for (const TreeElement& element : elements_)
+    {
+      FOUR_C_ASSERT_ALWAYS(element.outlet_equation_ids[0] >= 0,
+          "Outlet of element %d is not closed by a boundary condition, connection, or "
+          "bifurcation.",
+          element.global_id);
+    }
+
+    // Distribute the topology {owner, outlet type, inlet bc, children} to all ranks.
+    const int my_rank = Core::Communication::my_mpi_rank(comm);
+    std::map<int, std::vector<int>> my_topology;
+    for (const TreeElement& element : elements_)
+    {
+      my_topology[element.global_id] = {my_rank, static_cast<int>(element.outlet_type),
+          element.inlet_equation_id >= 0, element.children[0], element.children[1]};
+    }
+    const auto topology = Core::Communication::all_reduce(my_topology, comm);
+    enum TopologyEntry
+    {
+      owner = 0,
+      outlet_type = 1,
+      inlet_bc = 2,
+      child_1 = 3,
+      child_2 = 4
+    };
+
+    std::unordered_map<int, int> parent;
+    for (const auto& [global_id, entries] : topology)
+    {
+      if (entries[child_1] >= 0) parent[entries[child_1]] = global_id;
+      if (entries[child_2] >= 0) parent[entries[child_2]] = global_id;
+    }
+    std::vector<int> roots;
+    for (const auto& [global_id, entries] : topology)
+    {
+      if (parent.find(global_id) == parent.end())
+      {
+        FOUR_C_ASSERT_ALWAYS(entries[inlet_bc],
+            "Root element %d of the tree has no inlet pressure boundary condition.", global_id);
+        roots.push_back(global_id);
+      }
+    }
+    const auto children = [&](int global_id)
+    {
+      const auto& entries = topology.at(global_id);
+      return std::array<int, 2>{entries[child_1], entries[child_2]};
+    };
+    const std::vector<int> global_order = leaf_to_root_order(roots, children);
+    FOUR_C_ASSERT_ALWAYS(global_order.size() == topology.size(),
+        "The reduced lung elements do not form a tree (forest).");
+
+    // A subtree is local if all of its elements are owned by the same rank.
+    std::unordered_map<int, bool> local_subtree;
+    for (const int global_id : global_order)
+    {
+      bool is_local = true;
+      for (const int child : children(global_id))
+      {
+        if (child < 0) continue;
+        is_local = is_local && local_subtree[child] &&
+                   topology.at(child)[owner] == topology.at(global_id)[owner];
+      }
+      local_subtree[global_id] = is_local;
+    }
+
+    for (int i = 0; i < static_cast<int>(elements_.size()); ++i)
+    {
+      TreeElement& element = elements_[i];
+      const auto parent_it = parent.find(element.global_id);
+      element.parent = parent_it != parent.end() ? parent_it->second : -1;
+      element.local_subtree = local_subtree[element.global_id];
+      if (!element.local_subtree)
+        local_trunk_elements_.push_back(i);
+      else if (element.parent < 0 or !local_subtree[element.parent])
+        local_subtree_roots_.push_back(i);
+    }
+
+    // Elimination order of the local subtrees.
+    std::vector<int> local_subtree_root_ids;
+    for (const int i : local_subtree_roots_)
+      local_subtree_root_ids.push_back(elements_[i].global_id);
+    for (const int global_id : leaf_to_root_order(local_subtree_root_ids, children))
+      local_order_.push_back(local_index_.at(global_id));
+
+    // Topology and elimination order of the trunk.
+    for (const int global_id : global_order)
+    {
+      if (local_subtree[global_id]) continue;
+      const auto& entries = topology.at(global_id);
+      trunk_[global_id] = TrunkElement{static_cast<OutletType>(entries[outlet_type]),
+          {entries[child_1], entries[child_2]}, entries[inlet_bc] != 0};
+      trunk_order_.push_back(global_id);
+    }
+
+    coefficients_.resize(elements_.size());
+    states_.resize(elements_.size());
+    data_.resize(elements_.size());
+  }
+
+  void TreeSolver::solve(const Epetra_CrsMatrix& sysmat, const Core::LinAlg::Vector<double>& rhs,
+      Core::LinAlg::Vector<double>& dof_increment)
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("ReducedLung::TreeSolver::solve");
+
+    for (std::size_t i = 0; i < elements_.size(); ++i)
+      data_[i] = element_data(elements_[i], sysmat, rhs);
+
+    const auto local_children = [&](int i)
+    {
+      std::array<Coefficients, 2> children{};
+      const TreeElement& element = elements_[i];
+      for (int k = 0; k < num_children(element.outlet_type); ++k)
+        children[k] = coefficients_[local_index_.at(element.children[k])];
+      return children;
+    };
+
+    // Eliminate local subtrees from the leaves to the subtree roots.
+    for (const int i : local_order_) coefficients_[i] = eliminate(data_[i], local_children(i));
+
+    // Solve the trunk redundantly on every rank.
+    std::map<int, std::array<double, 2>> trunk_states;
+    if (!trunk_.empty())
+    {
+      std::map<int, std::vector<double>> my_trunk_data;
+      for (const int i : local_trunk_elements_)
+      {
+        const ElementData& d = data_[i];
+        my_trunk_data[elements_[i].global_id] = {d.resistance, d.residual, d.outlet_residuals[0],
+            d.outlet_residuals[1], d.outlet_residuals[2], d.inlet_residual};
+      }
+      for (const int i : local_subtree_roots_)
+      {
+        if (elements_[i].parent < 0) continue;
+        my_trunk_data[elements_[i].global_id] = {coefficients_[i].a, coefficients_[i].b};
+      }
+      const auto trunk_data = Core::Communication::all_reduce(my_trunk_data, comm_);
+
+      std::map<int, Coefficients> trunk_coefficients;
+      for (const auto& [global_id, values] : trunk_data)
+      {
+        if (values.size() == 2) trunk_coefficients[global_id] = {values[0], values[1]};
+      }
+      const auto trunk_element_data = [&](int global_id)
+      {
+        const auto& values = trunk_data.at(global_id);
+        return ElementData{trunk_.at(global_id).outlet_type, values[0], values[1],
+            {values[2], values[3], values[4]}, values[5]};
+      };
+      const auto trunk_children = [&](int global_id)
+      {
+        std::array<Coefficients, 2> children{};
+        const TrunkElement& element = trunk_.at(global_id);
+        for (int k = 0; k < num_children(element.outlet_type); ++k)
+          children[k] = trunk_coefficients.at(element.children[k]);
+        return children;
+      };
+
+      for (const int global_id : trunk_order_)
+      {
+        trunk_coefficients[global_id] =
+            eliminate(trunk_element_data(global_id), trunk_children(global_id));
+      }
+
+      for (auto it = trunk_order_.rbegin(); it != trunk_order_.rend(); ++it)
+      {
+        const int global_id = *it;
+        const ElementData data = trunk_element_data(global_id);
+        if (trunk_states.find(global_id) == trunk_states.end())
+        {
+          // root of a tree
+          FOUR_C_ASSERT(trunk_.at(global_id).has_inlet_bc,
+              "Internal error: Trunk root without inlet boundary condition.");
+          const Coefficients& coefficients = trunk_coefficients.at(global_id);
+          trunk_states[global_id] = {data.inlet_residual,
+              (data.inlet_residual - coefficients.a) / coefficients.b};
+        }
+        const auto& state = trunk_states.at(global_id);
+        std::array<std::array<double, 2>, 2> child_states;
+        back_substitute(data, trunk_children(global_id), state[0], state[1], child_states);
+        const TrunkElement& element = trunk_.at(global_id);
+        for (int k = 0; k < num_children(element.outlet_type); ++k)
+          trunk_states[element.children[k]] = child_states[k];
+      }
+    }
+
+    // Inlet states of locally owned trunk elements and local subtree roots.
+    for (const int i : local_trunk_elements_) states_[i] = trunk_states.at(elements_[i].global_id);
+    for (const int i : local_subtree_roots_)
+    {
+      if (elements_[i].parent >= 0)
+      {
+        states_[i] = trunk_states.at(elements_[i].global_id);
+      }
+      else
+      {
+        const double dp_in = data_[i].inlet_residual;
+        states_[i] = {dp_in, (dp_in - coefficients_[i].a) / coefficients_[i].b};
+      }
+    }
+
+    // Back substitution from the local subtree roots to the leaves.
+    for (auto it = local_order_.rbegin(); it != local_order_.rend(); ++it)
+    {
+      const int i = *it;
+      const TreeElement& element = elements_[i];
+      std::array<std::array<double, 2>, 2> child_states;
+      back_substitute(data_[i], local_children(i), states_[i][0], states_[i][1], child_states);
+      for (int k = 0; k < num_children(element.outlet_type); ++k)
+        states_[local_index_.at(element.children[k])] = child_states[k];
+    }
+
+    // Write the increments of all locally owned elements.
+    for (std::size_t i = 0; i < elements_.size(); ++i)
+    {
+      const TreeElement& element = elements_[i];
+      const double dp_in = states_[i][0];
+      const double dq = states_[i][1];
+      dof_increment[element.local_dof_ids[p_in]] = dp_in;
+      dof_increment[element.local_dof_ids[p_out]] =
+          dp_in - data_[i].residual - data_[i].resistance * dq;
+      dof_increment[element.local_dof_ids[q_in]] = dq;
+    }
+  }
+
+  TreeSolver::Coefficients TreeSolver::eliminate(
+      const ElementData& data, const std::array<Coefficients, 2>& children)
+  {
+    const std::array<double, 3>& r = data.outlet_residuals;
+
+    // Affine relation dp_out = outlet.a + outlet.b * dq at the outlet of the element.
+    Coefficients outlet{};
+    switch (data.outlet_type)
+    {
+      case OutletType::boundary_condition:
+      {
+        // dp_out = r_0
+        outlet = {r[0], 0.0};
+        break;
+      }
+      case OutletType::connection:
+      {
+        // dp_out - dp_in_child = r_0, dq - dq_child = r_1
+        const Coefficients& child = children[0];
+        outlet = {r[0] + child.a - child.b * r[1], child.b};
+        break;
+      }
+      case OutletType::bifurcation:
+      {
+        // dp_out - dp_in_child_k = r_k (k = 0, 1), dq - dq_child_0 - dq_child_1 = r_2
+        FOUR_C_ASSERT(children[0].b > 0.0 and children[1].b > 0.0,
+            "Vanishing resistance of a subtree at a bifurcation.");
+        const double conductance = 1.0 / children[0].b + 1.0 / children[1].b;
+        outlet = {(-r[2] + (r[0] + children[0].a) / children[0].b +
+                      (r[1] + children[1].a) / children[1].b) /
+                      conductance,
+            1.0 / conductance};
+        break;
+      }
+    }
+
+    // dp_in - dp_out - R * dq = r
+    return {data.residual + outlet.a, data.resistance + outlet.b};
+  }
+
+  double TreeSolver::back_substitute(const ElementData& data,
+      const std::array<Coefficients, 2>& children, double dp_in, double dq,
+      std::array<std::array<double, 2>, 2>& child_states)
+  {
+    const std::array<double, 3>& r = data.outlet_residuals;
+    const double dp_out = dp_in - data.residual - data.resistance * dq;
+
+    switch (data.outlet_type)
+    {
+      case OutletType::boundary_condition:
+        break;
+      case OutletType::connection:
+        child_states[0] = {dp_out - r[0], dq - r[1]};
+        break;
+      case OutletType::bifurcation:
+        for (int k = 0; k < 2; ++k)
+        {
+          const double dp_child = dp_out - r[k];
+          child_states[k] = {dp_child, (dp_child - children[k].a) / children[k].b};
+        }
+        break;
+    }
+
+    return dp_out;
+  }
+
+  int TreeSolver::num_children(OutletType outlet_type)
+  {
+    switch (outlet_type)
+    {
+      case OutletType::boundary_condition:
+        return 0;
+      case OutletType::connection:
+        return 1;
+      case OutletType::bifurcation:
+        return 2;
+    }
+    return 0;
+  }
+
+  TreeSolver::ElementData TreeSolver::element_data(const TreeElement& element,
+      const Epetra_CrsMatrix& sysmat, const Core::LinAlg::Vector<double>& rhs) const
+  {
+    ElementData data{};
+    data.outlet_type = element.outlet_type;
+
+    // The element equation reads dp_in - dp_out - R * dq = r.
+    int num_entries;
+    double* values;
+    int* indices;
+    [[maybe_unused]] int err =
+        sysmat.ExtractMyRowView(element.local_equation_id, num_entries, values, indices);
+    FOUR_C_ASSERT(err == 0, "Internal error: Extracting element equation did not work.");
+    for (int k = 0; k < num_entries; ++k)
+    {
+      if (indices[k] == element.local_q_column_id) data.resistance = -values[k];
+    }
+    data.residual = rhs[element.local_equation_id];
+
+    for (int k = 0; k < 3; ++k)
+    {
+      const int equation_id = element.outlet_equation_ids[k];
+      data.outlet_residuals[k] = equation_id >= 0 ? rhs[equation_id] : 0.0;
+    }
+    data.inlet_residual =
+        element.inlet_equation_id >= 0 ? rhs[element.inlet_equation_id] : 0.0;
+
+    return data;
+  }
+}  // namespace ReducedLung
+
+FOUR_C_NAMESPACE_CLOSE
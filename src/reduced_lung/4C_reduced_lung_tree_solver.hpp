@@ -0,0 +1,196 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_REDUCED_LUNG_TREE_SOLVER_HPP
+#define FOUR_C_REDUCED_LUNG_TREE_SOLVER_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_vector.hpp"
+#include "4C_reduced_lung_helpers.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+#include <mpi.h>
+
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace ReducedLung
+{
+  /*!
+   * @brief Direct solver for the linear system of a tree-structured reduced lung model that
+   * eliminates the equations from the leaves to the roots in linear time.
+   *
+   * Every element (airway or terminal unit) contributes the equation
+   * dp_in - dp_out - R * dq = r, its outlet is closed by a pressure boundary condition, a
+   * connection, or a bifurcation. Starting at the leaves, the inlet pressure of every element is
+   * expressed as an affine function dp_in = a + b * dq of its flow. At the roots, the inlet
+   * pressure boundary conditions determine the flows and the solution is recovered by back
+   * substitution from the roots to the leaves.
+   *
+   * Parallel variant: every rank eliminates the subtrees whose elements are all owned by the rank.
+   * The remaining elements (the trunk connecting the subtrees of different ranks) and the
+   * coefficients of the subtree roots attached to the trunk are gathered in one collective
+   * communication and the small trunk system is solved redundantly on every rank. Afterwards,
+   * every rank back-substitutes its subtrees without further communication.
+   *
+   * The system matrix is only accessed for the element resistances, i.e. the solver relies on the
+   * equation structure assembled in reduced_lung_main().
+   */
+  class TreeSolver
+  {
+   public:
+    /*!
+     * @brief Set up the tree topology and the elimination order.
+     *
+     * @param comm Communicator of the reduced lung discretization.
+     * @param airways Vector of locally owned airways.
+     * @param terminal_units Vector of locally owned terminal units.
+     * @param connections Vector of locally owned connections.
+     * @param bifurcations Vector of locally owned bifurcations.
+     * @param boundary_conditions Vector of locally owned boundary conditions.
+     * @param dof_map Map with the locally owned dofs of the elements.
+     */
+    TreeSolver(MPI_Comm comm, const std::vector<Airway>& airways,
+        const std::vector<TerminalUnit>& terminal_units, const std::vector<Connection>& connections,
+        const std::vector<Bifurcation>& bifurcations,
+        const std::vector<BoundaryCondition>& boundary_conditions, const Epetra_Map& dof_map);
+
+    /*!
+     * @brief Solve the system of equations.
+     *
+     * @param sysmat Assembled Jacobian of the system equations.
+     * @param rhs Right hand side with the residuals of the system equations.
+     * @param dof_increment Solution in the layout of the locally owned dofs of the elements.
+     */
+    void solve(const Epetra_CrsMatrix& sysmat, const Core::LinAlg::Vector<double>& rhs,
+        Core::LinAlg::Vector<double>& dof_increment);
+
+    //! Type of equations closing the outlet of an element.
+    enum class OutletType
+    {
+      boundary_condition,
+      connection,
+      bifurcation
+    };
+
+    //! Coefficients of the affine relation dp_in = a + b * dq at the inlet of a (sub)tree.
+    struct Coefficients
+    {
+      double a;
+      double b;
+    };
+
+    //! Equation data of one element and the equations at its outlet.
+    struct ElementData
+    {
+      OutletType outlet_type;
+      double resistance;
+      double residual;
+      //! residuals of the outlet equations (boundary condition: 1, connection: 2, bifurcation: 3)
+      std::array<double, 3> outlet_residuals;
+      //! residual of the inlet pressure boundary condition (roots only)
+      double inlet_residual;
+    };
+
+    /*!
+     * @brief Eliminate an element given the coefficients of its children.
+     */
+    static Coefficients eliminate(
+        const ElementData& data, const std::array<Coefficients, 2>& children);
+
+    /*!
+     * @brief Recover outlet pressure and the inlet states {dp_in, dq} of the children of an
+     * element from its inlet pressure and flow.
+     *
+     * @return outlet pressure of the element
+     */
+    static double back_substitute(const ElementData& data,
+        const std::array<Coefficients, 2>& children, double dp_in, double dq,
+        std::array<std::array<double, 2>, 2>& child_states);
+
+   private:
+    //! Locally owned element of the tree.
+    struct TreeElement
+    {
+      int global_id;
+      //! local row of the element equation
+      int local_equation_id;
+      //! local column of the flow dof in the system matrix
+      int local_q_column_id;
+      //! local ids of p_in, p_out, q in the dof map
+      std::array<int, 3> local_dof_ids;
+      OutletType outlet_type = OutletType::boundary_condition;
+      //! local rows of the outlet equations
+      std::array<int, 3> outlet_equation_ids{-1, -1, -1};
+      //! local row of the inlet pressure boundary condition (-1 if none)
+      int inlet_equation_id = -1;
+      //! global ids of the children
+      std::array<int, 2> children{-1, -1};
+      //! global id of the parent (-1 for roots)
+      int parent = -1;
+      //! whether all elements of the subtree starting at this element are owned by this rank
+      bool local_subtree = false;
+    };
+
+    //! Topology of a trunk element known on every rank.
+    struct TrunkElement
+    {
+      OutletType outlet_type;
+      std::array<int, 2> children;
+      bool has_inlet_bc;
+    };
+
+    //! number of children for the given outlet type
+    static int num_children(OutletType outlet_type);
+
+    //! gather the equation data of a local element from the assembled system
+    ElementData element_data(const TreeElement& element, const Epetra_CrsMatrix& sysmat,
+        const Core::LinAlg::Vector<double>& rhs) const;
+
+    MPI_Comm comm_;
+
+    //! locally owned elements
+    std::vector<TreeElement> elements_;
+
+    //! map from global element id to index in elements_
+    std::unordered_map<int, int> local_index_;
+
+    //! indices of local subtree elements in leaf-to-root order
+    std::vector<int> local_order_;
+
+    //! indices of local subtree roots, i.e. local subtree elements without local subtree parent
+    std::vector<int> local_subtree_roots_;
+
+    //! indices of locally owned trunk elements
+    std::vector<int> local_trunk_elements_;
+
+    //! topology of all trunk elements
+    std::map<int, TrunkElement> trunk_;
+
+    //! global ids of trunk elements in leaf-to-root order
+    std::vector<int> trunk_order_;
+
+    //! equation data of local elements (valid during solve)
+    std::vector<ElementData> data_;
+
+    //! coefficients of local elements (valid during solve)
+    std::vector<Coefficients> coefficients_;
+
+    //! inlet states {dp_in, dq} of local elements (valid during solve)
+    std::vector<std::array<double, 2>> states_;
+  };
+}  // namespace ReducedLung
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -296,14 +296,14 @@ void ScaTra::TimIntGenAlpha::add_time_integration_specific_vectors(bool forcedin
   // call base class routine
   ScaTraTimIntImpl::add_time_integration_specific_vectors(forcedincrementalsolver);
 
-  discret_->set_state("phinp", phiaf_);
+  discret_->set_state(phinp_handle_, phiaf_);
 
   if (incremental_ or forcedincrementalsolver)
-    discret_->set_state("hist", phidtam_);
+    discret_->set_state(hist_handle_, phidtam_);
   else
   {
-    discret_->set_state("hist", hist_);
-    discret_->set_state("phin", phin_);
+    discret_->set_state(hist_handle_, hist_);
+    discret_->set_state(phin_handle_, phin_);
   }
 }
 
@@ -362,6 +362,11 @@ void ScaTra::ScaTraTimIntImpl::setup()
   phinp_ = Core::LinAlg::create_vector(*dofrowmap, true);
   phin_ = Core::LinAlg::create_vector(*dofrowmap, true);
 
+  // register the states of the scatra discretization once
+  phinp_handle_ = discret_->register_state(0, "phinp");
+  phin_handle_ = discret_->register_state(0, "phin");
+  hist_handle_ = discret_->register_state(0, "hist");
+
   setup_context_vector();
 
   if (nds_micro() != -1)
@@ -693,7 +698,7 @@ void ScaTra::ScaTraTimIntImpl::setup_nat_conv()
   if (num_scal() < 1) FOUR_C_THROW("Error since numscal = %d. Not allowed since < 1", num_scal());
   c0_.resize(num_scal());
 
-  discret_->set_state("phinp", phinp_);
+  discret_->set_state(phinp_handle_, phinp_);
 
   // set action for elements
   Teuchos::ParameterList eleparams;
@@ -1667,7 +1672,9 @@ void ScaTra::ScaTraTimIntImpl::apply_mesh_movement(
     if (dispnp == nullptr) FOUR_C_THROW("Got null pointer for displacements!");
 
     // provide scatra discretization with displacement field
-    discret_->set_state(nds_disp(), "dispnp", dispnp);
+    if (not dispnp_handle_.is_valid())
+      dispnp_handle_ = discret_->register_state(nds_disp(), "dispnp");
+    discret_->set_state(dispnp_handle_, dispnp);
   }  // if (isale_)
 }
 
@@ -3770,7 +3777,7 @@ void ScaTra::ScaTraTimIntImpl::calc_mean_micro_concentration()
 
   if (nds_micro() < 0) FOUR_C_THROW("must set number of dofset for micro scale concentrations");
 
-  discret_->set_state("phinp", phinp_);
+  discret_->set_state(phinp_handle_, phinp_);
 
   Teuchos::ParameterList eleparams;
 
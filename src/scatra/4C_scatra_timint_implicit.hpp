@@ -12,6 +12,7 @@
 
 #include "4C_adapter_scatra_wrapper.hpp"
 #include "4C_fem_condition.hpp"
+#include "4C_fem_discretization.hpp"
 #include "4C_inpar_fluid.hpp"
 #include "4C_inpar_scatra.hpp"
 #include "4C_io_discretization_visualization_writer_mesh.hpp"
@@ -1429,6 +1430,14 @@ namespace ScaTra
     //!                or phin, phidtn (One-Step-Theta)
     std::shared_ptr<Core::LinAlg::Vector<double>> hist_;
 
+    //! handles of the states phinp, phin and hist of the scatra discretization
+    Core::FE::StateHandle phinp_handle_;
+    Core::FE::StateHandle phin_handle_;
+    Core::FE::StateHandle hist_handle_;
+
+    //! handle of the displacement state (registered on first use)
+    Core::FE::StateHandle dispnp_handle_;
+
     //! density at time n+alpha_F (gen-alpha) or n+1 (otherwise) for natural convection algorithm
     std::shared_ptr<Core::LinAlg::Vector<double>> densafnp_;
 
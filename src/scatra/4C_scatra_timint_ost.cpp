@@ -234,8 +234,8 @@ void ScaTra::TimIntOneStepTheta::add_time_integration_specific_vectors(bool forc
   // call base class routine
   ScaTraTimIntImpl::add_time_integration_specific_vectors(forcedincrementalsolver);
 
-  discret_->set_state("hist", hist_);
-  discret_->set_state("phinp", phinp_);
+  discret_->set_state(hist_handle_, hist_);
+  discret_->set_state(phinp_handle_, phinp_);
 }
 
 /*----------------------------------------------------------------------*
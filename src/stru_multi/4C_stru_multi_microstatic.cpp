@@ -30,6 +30,30 @@
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * \brief Create a linear solver for the micro problems of a micro discretization
+   *
+   * All RVEs of a micro material live on the same discretization, i.e. their stiffness matrices
+   * have the same sparsity pattern. The solver is kept by the MicroStatic object of the micro
+   * discretization, such that direct solvers reuse the symbolic factorization across RVEs and
+   * Newton iterations, only the numeric factorization is done per matrix.
+   */
+  std::shared_ptr<Core::LinAlg::Solver> create_micro_solver(
+      Core::FE::Discretization& discret, const int microdisnum, const int linsolvernumber)
+  {
+    auto solver = std::make_shared<Core::LinAlg::Solver>(
+        Global::Problem::instance(microdisnum)->solver_params(linsolvernumber), discret.get_comm(),
+        Global::Problem::instance()->solver_params_callback(),
+        Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
+            Global::Problem::instance()->io_params(), "VERBOSITY"));
+    solver->params().set("reuse symbolic factorization", true);
+    discret.compute_null_space_if_necessary(solver->params());
+    return solver;
+  }
+}  // namespace
+
 
 /*----------------------------------------------------------------------*
  |  ctor (public)|
@@ -71,12 +95,7 @@ MultiScale::MicroStatic::MicroStatic(const int microdisnum, const double V0)
         "no linear solver defined for structural field. Please set LINEAR_SOLVER in STRUCTURAL "
         "DYNAMIC to a valid number!");
 
-  solver_ = std::make_shared<Core::LinAlg::Solver>(
-      Global::Problem::instance(microdisnum_)->solver_params(linsolvernumber), discret_->get_comm(),
-      Global::Problem::instance()->solver_params_callback(),
-      Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
-          Global::Problem::instance()->io_params(), "VERBOSITY"));
-  discret_->compute_null_space_if_necessary(solver_->params());
+  solver_ = create_micro_solver(*discret_, microdisnum_, linsolvernumber);
 
   auto pred = Teuchos::getIntegralValue<Inpar::Solid::PredEnum>(sdyn_micro, "PREDICT");
   pred_ = pred;
@@ -434,12 +453,10 @@ void MultiScale::MicroStatic::predict_tang_dis(Core::LinAlg::Matrix<3, 3>* defgr
 
   // solve for disi_
   // Solve K_Teffdyn . IncD = -R  ===>  IncD_{n+1}
-  solver_->reset();
+  // the solver is shared by all RVEs of this micro discretization, hence no reset
   Core::LinAlg::SolverParams solver_params;
   solver_params.refactor = true;
-  solver_params.reset = true;
   solver_->solve(stiff_->epetra_operator(), disi_, fresn_, solver_params);
-  solver_->reset();
 
   // store norm of displacement increments
   normdisi_ = Solid::calculate_vector_norm(iternorm_, *disi_);
@@ -547,7 +564,6 @@ void MultiScale::MicroStatic::full_newton()
       solver_params.lin_tol_better = adaptolbetter_;
     }
     solver_params.refactor = true;
-    solver_params.reset = numiter_ == 0;
     solver_->solve(stiff_->epetra_operator(), disi_, fresn_, solver_params);
     solver_->reset_tolerance();
 
@@ -1018,14 +1034,11 @@ void MultiScale::MicroStatic::static_homogenization(Core::LinAlg::Matrix<6, 1>*
     const auto solvertype =
         Teuchos::getIntegralValue<Core::LinearSolver::SolverType>(solverparams, "SOLVER");
 
-    // create solver
-    Core::LinAlg::Solver solver(solverparams, discret_->get_comm(),
-        Global::Problem::instance()->solver_params_callback(),
-        Teuchos::getIntegralValue<Core::IO::Verbositylevel>(
-            Global::Problem::instance()->io_params(), "VERBOSITY"));
-
-    // prescribe rigid body modes
-    discret_->compute_null_space_if_necessary(solver.params());
+    // the solver (including the rigid body modes) is kept for all RVEs of this micro
+    // discretization
+    if (homogenization_solver_ == nullptr)
+      homogenization_solver_ = create_micro_solver(*discret_, microdisnum_, linsolvernumber);
+    Core::LinAlg::Solver& solver = *homogenization_solver_;
 
     std::shared_ptr<Core::LinAlg::MultiVector<double>> iterinc =
         std::make_shared<Core::LinAlg::MultiVector<double>>(*dofrowmap, 9);
@@ -1034,29 +1047,17 @@ void MultiScale::MicroStatic::static_homogenization(Core::LinAlg::Matrix<6, 1>*
     switch (solvertype)
     {
       case Core::LinearSolver::SolverType::belos:
+      case Core::LinearSolver::SolverType::superlu:
+      case Core::LinearSolver::SolverType::umfpack:
       {
-        // solve for 9 rhs at the same time --> thanks to Belos
+        // solve for 9 rhs at the same time: direct solvers factorize the stiffness matrix once
+        // (numerically only if the symbolic factorization of another RVE can be reused), Belos
+        // solvers use a block Krylov method
         Core::LinAlg::SolverParams solver_params;
         solver_params.refactor = true;
-        solver_params.reset = true;
         solver.solve_with_multi_vector(stiff_->epetra_operator(), iterinc, rhs_, solver_params);
         break;
       }
-      case Core::LinearSolver::SolverType::superlu:
-      case Core::LinearSolver::SolverType::umfpack:
-      {
-        // solve for 9 rhs iteratively
-        for (int i = 0; i < rhs_->NumVectors(); i++)
-        {
-          Core::LinAlg::SolverParams solver_params;
-          solver_params.refactor = true;
-          solver_params.reset = true;
-          solver.solve_with_multi_vector(stiff_->epetra_operator(),
-              (*iterinc)(i).get_ptr_of_MultiVector(), (*rhs_)(i).get_ptr_of_MultiVector(),
-              solver_params);
-        }
-        break;
-      }
       default:
       {
         FOUR_C_THROW("You have to choose either belos, superlu or umfpack for micro structures!");
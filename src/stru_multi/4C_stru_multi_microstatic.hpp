@@ -251,6 +251,8 @@ namespace MultiScale
 
     std::shared_ptr<Core::FE::Discretization> discret_;
     std::shared_ptr<Core::LinAlg::Solver> solver_;
+    //! solver of the homogenization (created on first use)
+    std::shared_ptr<Core::LinAlg::Solver> homogenization_solver_;
     int myrank_;
     int maxentriesperrow_;
 
@@ -11,6 +11,7 @@
 #include "4C_beamcontact_input.hpp"
 #include "4C_cardiovascular0d_manager.hpp"
 #include "4C_cardiovascular0d_mor_pod.hpp"
+#include "4C_cardiovascular0d_mor_pod_generator.hpp"
 #include "4C_comm_utils.hpp"
 #include "4C_constraint_manager.hpp"
 #include "4C_constraint_solver.hpp"
@@ -147,6 +148,7 @@ Solid::TimInt::TimInt(const Teuchos::ParameterList& timeparams,
       dtcmt_(0.0),
       strgrdisp_(nullptr),
       mor_(nullptr),
+      pod_generator_(nullptr),
       issetup_(false),
       isinit_(false)
 {
@@ -233,13 +235,27 @@ void Solid::TimInt::setup()
   // model order reduction
   mor_ = std::make_shared<Cardiovascular0D::ProperOrthogonalDecomposition>(dof_row_map(),
       Global::Problem::instance()->mor_params().get<std::string>("POD_MATRIX"),
+      Global::Problem::instance()->mor_params().get<std::string>("ECSW_WEIGHTS"),
       Global::Problem::instance()->output_control_file()->input_file_name());
 
+  // in-situ generation of a POD basis from displacement increments
+  if (Global::Problem::instance()->mor_params().get<bool>("POD_SNAPSHOTS"))
+  {
+    const Teuchos::ParameterList& morparams = Global::Problem::instance()->mor_params();
+    pod_generator_ = std::make_shared<Cardiovascular0D::PodBasisGenerator>(dof_row_map(),
+        morparams.get<int>("POD_SNAPSHOT_RANK"), morparams.get<int>("POD_SNAPSHOT_BLOCK"),
+        morparams.get<double>("POD_SNAPSHOT_TOL"));
+  }
+
   // initialize 0D cardiovascular manager
   cardvasc0dman_ =
       std::make_shared<FourC::Utils::Cardiovascular0DManager>(discret_, (*dis_)(0), sdynparams_,
           Global::Problem::instance()->cardiovascular0_d_structural_params(), *solver_, mor_);
 
+  // the hyper-reduced operators are only meaningful if the reduced system is solved
+  if (mor_->have_hyper_reduction() and not cardvasc0dman_->have_cardiovascular0_d())
+    FOUR_C_THROW("Hyper-reduction is only available for 0D cardiovascular-structural coupling.");
+
   // initialize spring dashpot manager
   springman_ = std::make_shared<CONSTRAINTS::SpringDashpotManager>(discret_);
 
@@ -1218,6 +1234,18 @@ void Solid::TimInt::update_step_time()
   stepn_ += 1;
 }
 
+/*----------------------------------------------------------------------*/
+/* Add displacement increment to POD basis */
+void Solid::TimInt::collect_pod_snapshot()
+{
+  if (pod_generator_ == nullptr) return;
+
+  // D_{n+1} - D_{n}
+  Core::LinAlg::Vector<double> increment(*disn_);
+  increment.Update(-1.0, *(*dis_)(0), 1.0);
+  pod_generator_->add_snapshot(increment);
+}
+
 /*----------------------------------------------------------------------*/
 /* Update contact and meshtying */
 void Solid::TimInt::update_step_contact_meshtying()
@@ -1972,6 +2000,7 @@ void Solid::TimInt::output_step(const bool forced_writerestart)
   // repeated initialising of output writer, printing of
   // state vectors, or similar
   bool datawritten = false;
+  bool restartwritten = false;
 
   // output restart (try this first)
   // write restart step
@@ -1981,6 +2010,7 @@ void Solid::TimInt::output_step(const bool forced_writerestart)
   {
     output_restart(datawritten);
     lastwrittenresultsstep_ = step_;
+    restartwritten = true;
   }
 
   // output results (not necessary if restart in same step)
@@ -2010,6 +2040,14 @@ void Solid::TimInt::output_step(const bool forced_writerestart)
 
   // output active set, energies and momentum for contact
   output_contact();
+
+  // POD basis generated so far, only written at restart steps and after the last step since the
+  // pending snapshots are added to the basis before writing, i.e., a partial block is processed
+  if (pod_generator_ != nullptr and (restartwritten or not not_finished()))
+  {
+    pod_generator_->write_basis(
+        Global::Problem::instance()->output_control_file()->file_name() + "_pod.bin");
+  }
 }
 
 /*-----------------------------------------------------------------------------*
@@ -77,6 +77,7 @@ namespace Core::IO
 
 namespace Cardiovascular0D
 {
+  class PodBasisGenerator;
   class ProperOrthogonalDecomposition;
 }
 
@@ -338,6 +339,9 @@ namespace Solid
     //! Update time and step counter
     void update_step_time();
 
+    //! Add the displacement increment of the current time step to the in-situ POD basis
+    void collect_pod_snapshot();
+
     //! Update step for contact / meshtying
     void update_step_contact_meshtying();
 
@@ -1198,6 +1202,9 @@ namespace Solid
     std::shared_ptr<Cardiovascular0D::ProperOrthogonalDecomposition>
         mor_;  //!< model order reduction
 
+    std::shared_ptr<Cardiovascular0D::PodBasisGenerator>
+        pod_generator_;  //!< in-situ generation of a POD basis
+
    private:
     //! flag indicating if class is setup
     bool issetup_;
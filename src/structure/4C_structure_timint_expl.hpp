@@ -275,6 +275,7 @@ namespace Solid
     void update() override
     {
       pre_update();
+      collect_pod_snapshot();
       update_step_state();
       update_step_time();
       update_step_element();
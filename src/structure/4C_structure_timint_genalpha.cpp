@@ -7,6 +7,7 @@
 
 #include "4C_structure_timint_genalpha.hpp"
 
+#include "4C_cardiovascular0d_mor_pod.hpp"
 #include "4C_fem_condition_locsys.hpp"
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_node.hpp"
@@ -462,11 +463,30 @@ void Solid::TimIntGenAlpha::evaluate_force_stiff_residual(Teuchos::ParameterList
     //                + (1 - alpha_f)*y/(beta*dt) C
     //                + (1 - alpha_f) K_{T}
 
-    stiff_->add(*mass_, false, (1. - alpham_) / (beta_ * (*dt_)[0] * (*dt_)[0]), 1. - alphaf_);
-    if (damping_ != Inpar::Solid::damp_none)
+    if (mor_->have_hyper_reduction())
     {
-      if (damping_ == Inpar::Solid::damp_material) damp_->complete();
-      stiff_->add(*damp_, false, (1. - alphaf_) * gamma_ / (beta_ * (*dt_)[0]), 1.0);
+      // the projected element matrices of the sampled elements, the mass and the damping matrix
+      // are combined in the reduced space, stiff_ only keeps the remaining contributions
+      const double facmass = (1. - alpham_) / (beta_ * (*dt_)[0] * (*dt_)[0]);
+      const double facdamp = (1. - alphaf_) * gamma_ / (beta_ * (*dt_)[0]);
+      std::vector<std::pair<double, const Core::LinAlg::SparseMatrix*>> constant_matrices = {
+          {facmass, mass_matrix().get()}};
+      if (damping_ == Inpar::Solid::damp_rayleigh)
+        constant_matrices.emplace_back(
+            facdamp, std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(damp_).get());
+
+      stiff_->scale(1. - alphaf_);
+      mor_->combine_hyper_reduced_stiffness(1. - alphaf_,
+          (damping_ == Inpar::Solid::damp_material) ? facdamp : 0.0, constant_matrices);
+    }
+    else
+    {
+      stiff_->add(*mass_, false, (1. - alpham_) / (beta_ * (*dt_)[0] * (*dt_)[0]), 1. - alphaf_);
+      if (damping_ != Inpar::Solid::damp_none)
+      {
+        if (damping_ == Inpar::Solid::damp_material) damp_->complete();
+        stiff_->add(*damp_, false, (1. - alphaf_) * gamma_ / (beta_ * (*dt_)[0]), 1.0);
+      }
     }
   }
   // build residual vector and tangent matrix if a multiplicative Gen-Alpha scheme for rotations is
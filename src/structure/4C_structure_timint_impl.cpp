@@ -19,6 +19,7 @@
 #include "4C_contact_meshtying_contact_bridge.hpp"
 #include "4C_fem_condition_locsys.hpp"
 #include "4C_fem_discretization_nullspace.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
 #include "4C_global_data.hpp"
 #include "4C_inpar_contact.hpp"
 #include "4C_inpar_wear.hpp"
@@ -216,6 +217,21 @@ void Solid::TimIntImpl::setup()
         Inpar::Solid::nonlin_sol_tech_string(itertype_).c_str());
   }
 
+  // with hyper-reduction, the full residual and the characteristic norms are assembled from the
+  // sampled elements only, i.e., only the absolute norms of the reduced residuals are meaningful
+  if (mor_->have_hyper_reduction() and (normtypefres_ != Inpar::Solid::convnorm_abs or
+                                           normtypedisi_ != Inpar::Solid::convnorm_abs))
+    FOUR_C_THROW("Hyper-reduction requires absolute norms, set NORM_RESF and NORM_DISP to Abs.");
+
+  // the hyper-reduced effective stiffness is only combined by the generalized-alpha scheme with a
+  // constant mass matrix, the tangential predictors solve the full system
+  if (mor_->have_hyper_reduction() and
+      (method_name() != Inpar::Solid::dyna_genalpha or
+          have_nonlinear_mass() != Inpar::Solid::ml_none or pred_ == Inpar::Solid::pred_tangdis or
+          pred_ == Inpar::Solid::pred_tangdis_constfext))
+    FOUR_C_THROW(
+        "Hyper-reduction requires GenAlpha with a linear mass matrix and no tangential predictor.");
+
   // setup tolerances and binary operators for convergence check of contact/meshtying problems
   // in saddlepoint formulation
   tolcontconstr_ = tolfres_;
@@ -894,7 +910,15 @@ void Solid::TimIntImpl::apply_force_stiff_internal(const double time, const doub
    * without the modifications due to the local condensation procedure.
    */
   if (fintn_str_ != nullptr) fintn_str_->PutScalar(0.);
-  discret_->evaluate(params, stiff, damp, fint, nullptr, fintn_str_);
+  if (mor_->have_hyper_reduction())
+  {
+    // evaluate the sampled elements of the reduced mesh only, their matrices are projected onto
+    // the reduced basis instead of being assembled into stiff and damp
+    Core::FE::AssembleStrategy strategy(0, 0, stiff, damp, fint, nullptr, fintn_str_);
+    mor_->evaluate_hyper_reduced(*discret_, params, strategy);
+  }
+  else
+    discret_->evaluate(params, stiff, damp, fint, nullptr, fintn_str_);
   discret_->clear_state();
 
   // *********** time measurement ***********
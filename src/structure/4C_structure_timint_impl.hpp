@@ -848,6 +848,7 @@ namespace Solid
     void update() override
     {
       pre_update();
+      collect_pod_snapshot();
       update_step_state();
       update_step_time();
       update_step_element();
@@ -859,6 +860,7 @@ namespace Solid
     void update(const double endtime) override
     {
       pre_update();
+      collect_pod_snapshot();
       update_step_state();
 
       timen_ = endtime;
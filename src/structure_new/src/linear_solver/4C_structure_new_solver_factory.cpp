@@ -428,6 +428,12 @@ std::shared_ptr<Core::LinAlg::Solver> Solid::SOLVER::Factory::build_cardiovascul
       actdis.compute_null_space_if_necessary(linsolver->params().sublist("Inverse2"), true);
       break;
     }
+    case Inpar::Cardiovascular0D::cardvasc0dsolve_schur:
+    {
+      // the solver is only applied to the structural block
+      actdis.compute_null_space_if_necessary(linsolver->params(), true);
+      break;
+    }
     default:
       FOUR_C_THROW("Unknown 0D cardiovascular-structural solution technique!");
   }
@@ -10,6 +10,7 @@
 #include "4C_fem_discretization.hpp"
 #include "4C_global_data.hpp"
 #include "4C_mat_micromaterial.hpp"
+#include "4C_mat_par_bundle.hpp"
 #include "4C_solid_3D_ele.hpp"
 #include "4C_stru_multi_microstatic.hpp"
 
@@ -119,6 +120,14 @@ void Solid::ModelEvaluator::Multiscale::output_step_state(
  *----------------------------------------------------------------------*/
 void Solid::ModelEvaluator::Multiscale::post_time_loop()
 {
+  // statistics of the response caches of the micro materials over all macro processors
+  for (const auto& [id, mat] : Global::Problem::instance()->materials()->map())
+  {
+    if (mat->type() == Core::Materials::m_struct_multiscale)
+      static_cast<const Mat::PAR::MicroMaterial&>(*mat).print_response_cache_statistics(
+          discret().get_comm());
+  }
+
   // stop supporting processors in multi scale simulations
   MultiScale::stop_np_multiscale();
 }
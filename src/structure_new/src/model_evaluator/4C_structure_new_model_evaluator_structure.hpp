@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_fem_discretization.hpp"
 #include "4C_inpar_structure.hpp"  // enumerators
 #include "4C_io_visualization_parameters.hpp"
 #include "4C_structure_new_elements_paramsinterface.hpp"  // interface to the element evaluation
@@ -532,6 +533,13 @@ namespace Solid
        *  etc.. */
       std::shared_ptr<Core::LinAlg::Vector<double>> dis_incr_ptr_;
 
+      //! handles of the states of the structural discretization set for the element evaluation
+      Core::FE::StateHandle displacement_handle_;
+      Core::FE::StateHandle residual_displacement_handle_;
+      Core::FE::StateHandle velocity_handle_;
+      Core::FE::StateHandle acceleration_handle_;
+      Core::FE::StateHandle displacement_new_handle_;
+
       //! visualization parameters
       Core::IO::VisualizationParameters visualization_params_;
 
@@ -217,15 +217,13 @@ void XFEM::DiscretizationXFEM::set_initial_state(unsigned nds, const std::string
   const Epetra_Map* colmap = initial_dof_col_map(nds);
   const Epetra_BlockMap& vecmap = state->Map();
 
-  if (state_.size() <= nds) state_.resize(nds + 1);
-
   // if it's already in column map just set a reference
   // This is a rough test, but it might be ok at this place. It is an
   // error anyway to hand in a vector that is not related to our dof
   // maps.
   if (vecmap.PointSameAs(*colmap))
   {
-    state_[nds][name] = state;
+    store_state(nds, name, state);
   }
   else  // if it's not in column map export and allocate
   {
@@ -239,7 +237,7 @@ void XFEM::DiscretizationXFEM::set_initial_state(unsigned nds, const std::string
 #endif
     std::shared_ptr<Core::LinAlg::Vector<double>> tmp = Core::LinAlg::create_vector(*colmap, false);
     Core::LinAlg::export_to(*state, *tmp);
-    state_[nds][name] = tmp;
+    store_state(nds, name, tmp);
   }
   return;
 }
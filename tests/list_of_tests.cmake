@@ -40,6 +40,7 @@ four_c_test(TEST_FILE beam3eb_static_contact_penalty_linposquadpen_beamslidingov
 four_c_test(TEST_FILE beam3eb_static_contact_penalty_newgap_twocrossedbeams.dat NP 2)
 four_c_test(TEST_FILE beam3eb_static_endmoment_quartercircle.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line2_static_test1.dat NP 2)
+four_c_test(TEST_FILE beam3r_herm2line2_static_test1_appended.dat NP 2)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2.dat NP 2 RESTART_STEP 70)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2_additional_fixed_crosslink.dat)
 four_c_test(TEST_FILE beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2_belloffrate.dat NP 2)
@@ -222,8 +223,11 @@ four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_direct_ost.d
 four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_direct_ost_new_struc.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_direct_stat.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_direct_stat_new_struc.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
+four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_schur_genalpha.dat NP 2)
+four_c_test(TEST_FILE cardiovascular0d_4elementwindkessel_structure_schur_genalpha_new_struc.dat NP 2)
 four_c_test(TEST_FILE cardiovascular0d_arterialproxdist_structure_direct_genalpha.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE cardiovascular0d_arterialproxdist_structure_direct_genalpha_mor.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
+four_c_test(TEST_FILE cardiovascular0d_arterialproxdist_structure_direct_genalpha_mor_ecsw.dat NP 2)
 four_c_test(TEST_FILE cardiovascular0d_arterialproxdist_structure_direct_genalpha_new_struc.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE cardiovascular0d_syspulcirculation_0d_heart.dat NP 2 POST_ENSIGHT_STRUCTURE ON)
 four_c_test(TEST_FILE cardiovascular0d_syspulcirculation_2chamber_structure_statprestress.dat cardiovascular0d_syspulcirculation_2chamber_structure_direct_genalpha.dat NP 1 1 RESTART_STEP 10)
@@ -593,6 +597,7 @@ four_c_test(TEST_FILE f3_beltrami_8x8x8_new_ost.dat NP 2)
 four_c_test(TEST_FILE f3_beltrami_8x8x8_npgenalpha_conv_edge_based_stab.dat)
 four_c_test(TEST_FILE f3_beltrami_8x8x8_ost_2iter_conv.dat)
 four_c_test(TEST_FILE f3_beltrami_8x8x8_ost_conv_edge_based_stab.dat NP 2 RESTART_STEP 4)
+four_c_test(TEST_FILE f3_beltrami_8x8x8_ost_conv_edge_based_stab_cache_face_geometry.dat NP 2 RESTART_STEP 4)
 four_c_test(TEST_FILE f3_beltrami_8x8x8_ost_conv.dat)
 four_c_test(TEST_FILE f3_beltrami_sphere_hdg_legendre.dat)
 four_c_test(TEST_FILE f3_beltrami_tet10_hdg.dat)
@@ -697,6 +702,7 @@ four_c_test(TEST_FILE fsi_dc_mono_ss_ost_ga_eos.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_mono_ss_ost_ga_rsb.dat NP 3 RESTART_STEP 8)
 four_c_test(TEST_FILE fsi_dc_part_ait_ga_ga.dat NP 2 RESTART_STEP 7)
 four_c_test(TEST_FILE fsi_dc_part_ait_ost_ga.dat NP 2 RESTART_STEP 1)
+four_c_test(TEST_FILE fsi_dc_part_iqnils_ost_ga.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_part_mfnk_ost_ga.dat NP 2)
 four_c_test(TEST_FILE fsi_dc_part_mpe_ost_ga.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE fsi_dc_part_mtrait_ost_ga.dat NP 2)
@@ -956,10 +962,14 @@ four_c_test(TEST_FILE particle_dem_2d_rigidbody_initialstates.dat NP 2 RESTART_S
 four_c_test(TEST_FILE particle_dem_2d_rollingcontact_coulomb.dat NP 2 RESTART_STEP 550 CSV_COMPARISON_RESULT_FILE xxx-particle-energy.csv CSV_COMPARISON_REFERENCE_FILE ref/particle_dem_2d_rollingcontact_coulomb-particle-energy.csv CSV_COMPARISON_TOL_R 0.0 CSV_COMPARISON_TOL_A 1e-14)
 four_c_test(TEST_FILE particle_dem_2d_rollingcontact_viscous.dat NP 2 RESTART_STEP 550)
 four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp.dat NP 2 RESTART_STEP 450)
+four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp_respa1.dat NP 2 RESTART_STEP 450)
 four_c_test(TEST_FILE particle_dem_2d_tangentialcontact_linspringdamp_dense.dat NP 3 RESTART_STEP 500)
 four_c_test(TEST_FILE particle_dem_3d_diffwallmat.dat NP 2 RESTART_STEP 150)
+four_c_test(TEST_FILE particle_dem_3d_gravity_respa.dat NP 2 RESTART_STEP 250)
 four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp.dat NP 2 RESTART_STEP 2000)
+four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp_respa.dat NP 2 RESTART_STEP 1000)
 four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp_walldiscretcond.dat NP 2 RESTART_STEP 150)
+four_c_test(TEST_FILE particle_dem_3d_normalcontact_linspringdamp_walldiscretcond_respa.dat NP 2 RESTART_STEP 75)
 four_c_test(TEST_FILE particle_dem_3d_tangentialcontact_linspringdamp_walldiscretcond.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_nointer_3d_nopbc_walldiscretcond_nonmoving.dat NP 3 RESTART_STEP 300)
 four_c_test(TEST_FILE particle_nointer_3d_pbc_x_dbc_semiipliciteuler.dat NP 3 RESTART_STEP 800)
@@ -1015,6 +1025,7 @@ four_c_test(TEST_FILE particle_sph_2d_continuumsurfaceforce_wetting_twophase_equ
 four_c_test(TEST_FILE particle_sph_2d_dambreak_freesurface_densitynormalizedreinit.dat NP 2)
 four_c_test(TEST_FILE particle_sph_2d_dambreak_freesurface_densityrandlesreinit.dat NP 2)
 four_c_test(TEST_FILE particle_sph_2d_drivencavity_densitysummation_adami.dat NP 2 RESTART_STEP 150)
+four_c_test(TEST_FILE particle_sph_2d_drivencavity_densitysummation_adami_parallelpairs.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_sph_2d_drivencavity_densitysummation_monaghan.dat NP 2 RESTART_STEP 150)
 four_c_test(TEST_FILE particle_sph_2d_openboundary_straight_channel.dat NP 2 RESTART_STEP 400)
 four_c_test(TEST_FILE particle_sph_2d_poiseuille_densitysummation_adami_artificialvisc.dat NP 2 RESTART_STEP 400)
@@ -1130,6 +1141,7 @@ four_c_test(TEST_FILE porofluidmulti_3D_tet10.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE porofluidmulti_3D_tet4.dat NP 2 RESTART_STEP 14)
 four_c_test(TEST_FILE poromultielast_2D_quad4_3_fluids_2_volfrac_mono_FD.dat)
 four_c_test(TEST_FILE poromultielast_2D_quad4_linebased_artery_coupling_mono_MP.dat)
+four_c_test(TEST_FILE poromultielast_2D_quad4_linebased_artery_coupling_mono_MP_projection_cache.dat)
 four_c_test(TEST_FILE poromultielast_2D_quad4_mono.dat NP 2 RESTART_STEP 4)
 four_c_test(TEST_FILE poromultielast_2D_quad4_mono_FD.dat)
 four_c_test(TEST_FILE poromultielast_2D_quad4_part.dat NP 2 RESTART_STEP 4)
@@ -1205,6 +1217,8 @@ four_c_test(TEST_FILE reduced_lung_aw_bifurcation_flow.dat)
 four_c_test(TEST_FILE reduced_lung_aw_bifurcation_flow.dat NP 2)
 four_c_test(TEST_FILE reduced_lung_3_aw_2_tu.dat)
 four_c_test(TEST_FILE reduced_lung_3_aw_2_tu.dat NP 3)
+four_c_test(TEST_FILE reduced_lung_3_aw_2_tu_tree_solver.dat)
+four_c_test(TEST_FILE reduced_lung_3_aw_2_tu_tree_solver.dat NP 3)
 four_c_test(TEST_FILE reduced_lung_terminal_unit.dat)
 four_c_test(TEST_FILE rigidsphere_freefall.dat RESTART_STEP 5)
 four_c_test(TEST_FILE roughcontact2d_brokenrational_patchtest.dat NP 2)
@@ -1373,6 +1387,7 @@ four_c_test(TEST_FILE solid_ele_hex27_Standard_linear.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_hex27_Standard_mulf.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_hex27_Standard_stressout.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_hex27_Standard_volume_neumann.dat NP 2 RESTART_STEP 1)
+four_c_test(TEST_FILE solid_ele_hex8_Old_dynamic_pod_snapshots.dat NP 2)
 four_c_test(TEST_FILE solid_ele_hex8_Old_eas_full_dynamic.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_hex8_Old_eas_full_nodal_fibers.dat NP 2 RESTART_STEP 1)
 four_c_test(TEST_FILE solid_ele_hex8_Old_eas_full_volume_neumann.dat NP 2 RESTART_STEP 1)
@@ -1990,6 +2005,7 @@ if (FOUR_C_WITH_ARBORX)
     four_c_test(TEST_FILE beam3r_herm2line3_static_point_coupling_BTSPH_contact_stent_honeycomb_stretch_r01_circ10_boundingvolume.dat NP 3 RESTART_STEP 20)
     four_c_test(TEST_FILE embeddedmesh_parallel_bending_beam.dat NP 3)
     four_c_test(TEST_FILE embeddedmesh_parallel_bending_beam_fine.dat NP 3)
+    four_c_test(TEST_FILE volmortar3D_tsi_hex8_tet4_bvh.dat NP 2 RESTART_STEP 7)
 
     # only execute these vtk tests with ArborX
     four_c_test_vtk(beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume-vtk-beam-interaction-geometric-search.dat beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume.dat 2 xxx-beam-interaction-geometric-search.pvd ref/beam3eb_static_beam_to_solid_volume_meshtying_beam_to_beam_contact_boundingvolume-vtk/beam-interaction-geometric-search.pvd 1e-06 0.0 1.0)
@@ -2024,6 +2040,7 @@ four_c_test_pre_processing(pre_exo_cube 1)
 # four_c_test_nested_parallelism
 four_c_test_nested_parallelism(sohex8_multiscale_macro.dat sohex8_multiscale_npsupport.dat "1")
 four_c_test_nested_parallelism(sohex8_multiscale_macro_2micro.dat sohex8_multiscale_npsupport.dat "1")
+four_c_test_nested_parallelism(sohex8_multiscale_macro_2micro.dat sohex8_multiscale_npsupport.dat "" "2,3")
 four_c_test_nested_parallelism(tsi_heatconvection_monolithic.dat tsi_heatconvection_monolithic.dat "")
 
 # testing the whole framework: from pre_exodus and 4C to the post-filter:
@@ -2061,9 +2078,13 @@ four_c_test_post_processing(w1q8_patch_nonlinear.dat 2 2 ndxyz ndxyz 1)
 four_c_test_post_processing(w1q9_dyn_rot_drt_gena.dat 2 2 ndxyz ndxyz 100)
 four_c_test_post_processing(w1t6_patch_linear.dat 2 2 cxyz cxyz 1)
 
+# four_c_test_post_processing_parallel_steps
+four_c_test_post_processing_parallel_steps(sotet10_cooks_nl.dat 3 2 displacement)
+
 # four_c_test_vtk
 four_c_test_vtk(beam_runtime_ghosting_output-vtk-beam.dat beam_runtime_ghosting_output.dat 3 xxx-structure-beams.pvd ref/beam_runtime_ghosting_output-vtk/structure-beams.pvd 1e-08 0.0 1.0)
 four_c_test_vtk(beam3r_herm2line2_static_test1_vtk.dat beam3r_herm2line2_static_test1.dat 2 xxx-structure-beams.pvd ref/beam3r_herm2line2_static_test1-structure-beams.pvd 1e-06)
+four_c_test_vtk(beam3r_herm2line2_static_test1_appended_vtk.dat beam3r_herm2line2_static_test1_appended.dat 2 xxx-structure-beams.pvd ref/beam3r_herm2line2_static_test1-structure-beams.pvd 1e-06)
 four_c_test_vtk(beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2_vtk.dat beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2.dat 2 xxx-structure-beams.pvd ref/beam3r_herm2line3_backweuler_browndyn_crosslinking_beam3rline2-vtk/structure-beams.pvd 1e-08 0.0025 0.0085)
 four_c_test_vtk(beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad-vtk-averaged-normals.dat beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad.dat 3 xxx-beam-to-solid-surface-contact-averaged-normals.pvd ref/beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad/beam-to-solid-surface-contact-averaged-normals.pvd 1e-08 2.5000001e-01 3.0)
 four_c_test_vtk(beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad-vtk-integration-points.dat beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad.dat 3 xxx-beam-to-solid-surface-contact-integration-points.pvd ref/beam3r_herm2line3_static_beam_to_solid_surface_contact_ironing_penalty_gap_variation_segmentation_lin_quad/beam-to-solid-surface-contact-integration-points.pvd 1e-08 2.5000001e-01 3.0)
@@ -0,0 +1,139 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_beaminteraction_crosslinker_container.hpp"
+
+#include "4C_comm_pack_buffer.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  class CrosslinkerContainerTest : public ::testing::Test
+  {
+   protected:
+    CrosslinkerContainerTest()
+    {
+      // add crosslinker with gids 0 to 5 residing alternately in bins 7 and 3
+      Core::LinAlg::Matrix<3, 1> position(true);
+      const std::vector<std::pair<int, int>> bspots = {{-1, -1}, {-1, -1}};
+      for (int gid = 0; gid < 6; ++gid)
+      {
+        position(0) = gid;
+        container_.add_crosslinker(gid, gid % 2, position, 0, bspots, (gid % 2) ? 3 : 7);
+      }
+    }
+
+    BeamInteraction::CrosslinkerContainer container_;
+  };
+
+  TEST_F(CrosslinkerContainerTest, AddAndRemove)
+  {
+    EXPECT_EQ(container_.size(), 6);
+    EXPECT_EQ(container_.index_of(1), 1);
+
+    // the last crosslinker is swapped to the removed position
+    container_.remove_crosslinker(1);
+    EXPECT_EQ(container_.size(), 5);
+    EXPECT_EQ(container_.gid(1), 5);
+    EXPECT_EQ(container_.type(1), 1);
+    EXPECT_DOUBLE_EQ(container_.position(1)[0], 5.0);
+    EXPECT_EQ(container_.index_of(1), -1);
+    EXPECT_EQ(container_.index_of(5), 1);
+
+    container_.set_number_of_bonds(1, 1);
+    container_.set_bspot(1, 0, {42, 3});
+    EXPECT_EQ(container_.number_of_bonds(1), 1);
+    EXPECT_EQ(container_.bspot(1, 0), std::make_pair(42, 3));
+    EXPECT_EQ(container_.bspot(1, 1), std::make_pair(-1, -1));
+  }
+
+  TEST_F(CrosslinkerContainerTest, RemoveLastAndClear)
+  {
+    container_.remove_crosslinker(5);
+    EXPECT_EQ(container_.size(), 5);
+    EXPECT_EQ(container_.gid(4), 4);
+    EXPECT_EQ(container_.index_of(5), -1);
+
+    container_.clear();
+    EXPECT_EQ(container_.size(), 0);
+    EXPECT_EQ(container_.index_of(0), -1);
+  }
+
+  TEST_F(CrosslinkerContainerTest, SortByBin)
+  {
+    container_.sort_by_bin();
+
+    EXPECT_EQ(container_.bins(), std::vector<int>({3, 7}));
+
+    // crosslinkers of one bin are stored contiguously and sorted by gid
+    const auto [first3, last3] = container_.bin_range(3);
+    ASSERT_EQ(last3 - first3, 3);
+    for (int i = first3; i < last3; ++i)
+    {
+      EXPECT_EQ(container_.bin(i), 3);
+      EXPECT_EQ(container_.gid(i), 2 * (i - first3) + 1);
+      EXPECT_EQ(container_.index_of(container_.gid(i)), i);
+    }
+
+    const auto [first7, last7] = container_.bin_range(7);
+    EXPECT_EQ(first7, last3);
+    EXPECT_EQ(last7, 6);
+
+    // empty bin
+    const auto [first5, last5] = container_.bin_range(5);
+    EXPECT_EQ(first5, last5);
+  }
+
+  TEST_F(CrosslinkerContainerTest, ReferencePositions)
+  {
+    Core::LinAlg::Matrix<3, 1> position(true);
+    position(1) = 2.0;
+    container_.set_position(2, position);
+
+    EXPECT_DOUBLE_EQ(container_.reference_position(2)[0], 2.0);
+    EXPECT_DOUBLE_EQ(container_.reference_position(2)[1], 0.0);
+
+    container_.reset_reference_positions();
+    EXPECT_DOUBLE_EQ(container_.reference_position(2)[0], 0.0);
+    EXPECT_DOUBLE_EQ(container_.reference_position(2)[1], 2.0);
+  }
+
+  TEST_F(CrosslinkerContainerTest, PackAndUnpack)
+  {
+    container_.set_number_of_bonds(4, 1);
+    container_.set_bspot(4, 1, {12, 1});
+    Core::LinAlg::Matrix<3, 1> position(true);
+    position(2) = -1.0;
+    container_.set_position(4, position);
+
+    Core::Communication::PackBuffer data;
+    container_.pack(data);
+
+    BeamInteraction::CrosslinkerContainer unpacked;
+    Core::Communication::UnpackBuffer buffer(data());
+    unpacked.unpack(buffer);
+
+    ASSERT_EQ(unpacked.size(), container_.size());
+    for (int i = 0; i < container_.size(); ++i)
+    {
+      EXPECT_EQ(unpacked.gid(i), container_.gid(i));
+      EXPECT_EQ(unpacked.type(i), container_.type(i));
+      EXPECT_EQ(unpacked.bin(i), container_.bin(i));
+      EXPECT_EQ(unpacked.number_of_bonds(i), container_.number_of_bonds(i));
+      EXPECT_EQ(unpacked.bspots(i), container_.bspots(i));
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        EXPECT_DOUBLE_EQ(unpacked.position(i)[dim], container_.position(i)[dim]);
+        EXPECT_DOUBLE_EQ(
+            unpacked.reference_position(i)[dim], container_.reference_position(i)[dim]);
+      }
+    }
+  }
+}  // namespace
@@ -0,0 +1,81 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_beaminteraction_crosslinker_container.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  class CrosslinkerContainerParallelTest : public ::testing::Test
+  {
+   protected:
+    CrosslinkerContainerParallelTest()
+        : comm_(MPI_COMM_WORLD), myrank_(Core::Communication::my_mpi_rank(comm_))
+    {
+      // each processor owns crosslinkers 10*rank + (0, 1, 2), the first one in bin 0
+      Core::LinAlg::Matrix<3, 1> position(true);
+      const std::vector<std::pair<int, int>> bspots = {{-1, -1}, {-1, -1}};
+      for (int i = 0; i < 3; ++i)
+      {
+        const int gid = 10 * myrank_ + i;
+        position(0) = gid;
+        container_.add_crosslinker(gid, 0, position, 0, bspots, (i == 0) ? 0 : 1 + myrank_);
+      }
+      container_.sort_by_bin();
+    }
+
+    MPI_Comm comm_;
+    int myrank_;
+    BeamInteraction::CrosslinkerContainer container_;
+  };
+
+  TEST_F(CrosslinkerContainerParallelTest, Migrate)
+  {
+    // send first crosslinker to other processor, drop second one, keep third one
+    const int otherrank = 1 - myrank_;
+    std::vector<int> targetrank(container_.size());
+    for (int i = 0; i < container_.size(); ++i)
+    {
+      const int local = container_.gid(i) % 10;
+      targetrank[i] = (local == 0) ? otherrank : ((local == 1) ? -1 : myrank_);
+    }
+
+    container_.migrate(comm_, targetrank);
+
+    ASSERT_EQ(container_.size(), 2);
+    EXPECT_EQ(container_.index_of(10 * myrank_ + 1), -1);
+    EXPECT_GE(container_.index_of(10 * myrank_ + 2), 0);
+
+    const int received = container_.index_of(10 * otherrank);
+    ASSERT_GE(received, 0);
+    EXPECT_DOUBLE_EQ(container_.position(received)[0], 10.0 * otherrank);
+    EXPECT_EQ(container_.bin(received), 0);
+  }
+
+  TEST_F(CrosslinkerContainerParallelTest, ExportCopies)
+  {
+    // send copies of all crosslinkers in bin 0 to the other processor
+    std::vector<std::vector<int>> indicesperrank(2);
+    const auto [first, last] = container_.bin_range(0);
+    for (int i = first; i < last; ++i) indicesperrank[1 - myrank_].push_back(i);
+
+    BeamInteraction::CrosslinkerContainer copies;
+    container_.export_copies(comm_, indicesperrank, copies);
+
+    // the original crosslinkers stay untouched
+    EXPECT_EQ(container_.size(), 3);
+
+    ASSERT_EQ(copies.size(), 1);
+    EXPECT_EQ(copies.gid(0), 10 * (1 - myrank_));
+    EXPECT_EQ(copies.bins(), std::vector<int>({0}));
+  }
+}  // namespace
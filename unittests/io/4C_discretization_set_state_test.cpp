@@ -0,0 +1,155 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_utils_sparse_algebra_create.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  // Serial discretization
+  class SetStateTest : public testing::Test
+  {
+   public:
+    SetStateTest()
+    {
+      create_material_in_global_problem();
+
+      comm_ = MPI_COMM_WORLD;
+      test_discretization_ = std::make_shared<Core::FE::Discretization>("dummy", comm_, 3);
+
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{2, 2, 2};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *test_discretization_, inputData, true);
+
+      test_discretization_->fill_complete(true, false, false);
+
+      state_ = Core::LinAlg::create_vector(*test_discretization_->dof_row_map(), true);
+      for (int lid = 0; lid < state_->MyLength(); ++lid) (*state_)[lid] = lid;
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+   protected:
+    std::shared_ptr<Core::FE::Discretization> test_discretization_;
+    std::shared_ptr<Core::LinAlg::Vector<double>> state_;
+    MPI_Comm comm_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(SetStateTest, UnchangedStateIsNotImportedAgain)
+  {
+    const Core::FE::StateHandle handle = test_discretization_->register_state(0, "velnp");
+
+    test_discretization_->set_state(handle, state_);
+    const auto first = test_discretization_->get_state(handle);
+
+    // the previously imported vector is reused in the usual clear_state() and set_state() cycle
+    test_discretization_->clear_state();
+    EXPECT_FALSE(test_discretization_->has_state(handle));
+    test_discretization_->set_state(handle, state_, false);
+    EXPECT_EQ(test_discretization_->get_state(handle), first);
+  }
+
+  TEST_F(SetStateTest, StateIsImportedByDefault)
+  {
+    const Core::FE::StateHandle handle = test_discretization_->register_state(0, "velnp");
+
+    test_discretization_->set_state(handle, state_);
+    const auto first = test_discretization_->get_state(handle);
+
+    test_discretization_->set_state(handle, state_);
+    EXPECT_NE(test_discretization_->get_state(handle), first);
+
+    // states set by name are always imported
+    const auto second = test_discretization_->get_state(handle);
+    test_discretization_->set_state(0, "velnp", state_);
+    EXPECT_NE(test_discretization_->get_state("velnp"), second);
+  }
+
+  TEST_F(SetStateTest, OtherVectorIsImported)
+  {
+    const Core::FE::StateHandle handle = test_discretization_->register_state(0, "velnp");
+
+    test_discretization_->set_state(handle, state_);
+    const auto first = test_discretization_->get_state(handle);
+
+    // the last import is only reused for the same row vector
+    auto copy = std::make_shared<Core::LinAlg::Vector<double>>(*state_);
+    test_discretization_->set_state(handle, copy, false);
+    EXPECT_NE(test_discretization_->get_state(handle), first);
+  }
+
+  TEST_F(SetStateTest, ChangedStateIsImported)
+  {
+    const Core::FE::StateHandle handle = test_discretization_->register_state(0, "velnp");
+
+    test_discretization_->set_state(handle, state_);
+    const auto first = test_discretization_->get_state(handle);
+
+    (*state_)[state_->MyLength() - 1] += 1.0;
+    test_discretization_->clear_state();
+    test_discretization_->set_state(handle, state_);
+
+    const auto second = test_discretization_->get_state(handle);
+    EXPECT_NE(second, first);
+
+    const Epetra_Map& colmap = *test_discretization_->dof_col_map();
+    for (int lid = 0; lid < state_->MyLength(); ++lid)
+      EXPECT_EQ((*second)[colmap.LID(state_->Map().GID(lid))], (*state_)[lid]);
+  }
+
+  TEST_F(SetStateTest, ColumnStateIsCopied)
+  {
+    const Core::FE::StateHandle handle = test_discretization_->register_state(0, "velnp");
+
+    std::shared_ptr<Core::LinAlg::Vector<double>> colstate =
+        Core::LinAlg::create_vector(*test_discretization_->dof_col_map(), true);
+    colstate->PutScalar(2.0);
+
+    test_discretization_->set_state(handle, colstate);
+    const auto first = test_discretization_->get_state(handle);
+    EXPECT_NE(first, colstate);
+
+    test_discretization_->set_state(handle, colstate);
+    EXPECT_NE(test_discretization_->get_state(handle), first);
+  }
+}  // namespace
@@ -0,0 +1,171 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_micromaterial_response_cache.hpp"
+
+#include "4C_unittest_utils_assertions_test.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  class MicroMaterialResponseCacheTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      // isotropic elasticity tensor in Voigt notation with engineering shear strains
+      const double lambda = 100.0;
+      const double mu = 50.0;
+      for (int i = 0; i < 3; ++i)
+      {
+        for (int j = 0; j < 3; ++j) cmat_(i, j) = lambda;
+        cmat_(i, i) += 2.0 * mu;
+        cmat_(i + 3, i + 3) = mu;
+      }
+    }
+
+    //! strain with all components equal to @p value
+    static Core::LinAlg::Matrix<6, 1> strain(double value)
+    {
+      Core::LinAlg::Matrix<6, 1> glstrain;
+      glstrain.put_scalar(value);
+      return glstrain;
+    }
+
+    //! linear elastic response
+    void linear_response(const Core::LinAlg::Matrix<6, 1>& glstrain,
+        Core::LinAlg::Matrix<6, 1>& stress, Core::LinAlg::Matrix<6, 6>& cmat) const
+    {
+      stress.multiply_nn(cmat_, glstrain);
+      cmat = cmat_;
+    }
+
+    //! stiffening response S = (1 + a |E|^2) C E
+    void stiffening_response(const Core::LinAlg::Matrix<6, 1>& glstrain,
+        Core::LinAlg::Matrix<6, 1>& stress, Core::LinAlg::Matrix<6, 6>& cmat) const
+    {
+      const double a = 1.0e3;
+      const double factor = 1.0 + a * glstrain.dot(glstrain);
+      Core::LinAlg::Matrix<6, 1> linear_stress;
+      linear_stress.multiply_nn(cmat_, glstrain);
+      stress.update(factor, linear_stress);
+      cmat.update(factor, cmat_);
+      cmat.multiply_nt(2.0 * a, linear_stress, glstrain, 1.0);
+    }
+
+    Core::LinAlg::Matrix<6, 6> cmat_;
+  };
+
+  TEST_F(MicroMaterialResponseCacheTest, SingleSampleOnlyReproducesItself)
+  {
+    Mat::MicroMaterialResponseCache cache(1.0e-3, 100);
+    Core::LinAlg::Matrix<6, 1> stress;
+    Core::LinAlg::Matrix<6, 6> cmat;
+
+    EXPECT_FALSE(cache.lookup(strain(1.0e-3), stress, cmat));
+
+    linear_response(strain(1.0e-3), stress, cmat);
+    cache.insert(strain(1.0e-3), stress, cmat);
+
+    // the curvature around a single sample is unknown
+    EXPECT_FALSE(cache.lookup(strain(1.1e-3), stress, cmat));
+
+    Core::LinAlg::Matrix<6, 1> ref_stress;
+    Core::LinAlg::Matrix<6, 6> ref_cmat;
+    linear_response(strain(1.0e-3), ref_stress, ref_cmat);
+    stress.clear();
+    EXPECT_TRUE(cache.lookup(strain(1.0e-3), stress, cmat));
+    FOUR_C_EXPECT_NEAR(stress, ref_stress, 1.0e-12);
+
+    EXPECT_EQ(cache.statistics().lookups, 3);
+    EXPECT_EQ(cache.statistics().hits, 1);
+  }
+
+  TEST_F(MicroMaterialResponseCacheTest, LinearResponseIsExtrapolatedExactly)
+  {
+    Mat::MicroMaterialResponseCache cache(1.0e-6, 100);
+    Core::LinAlg::Matrix<6, 1> stress;
+    Core::LinAlg::Matrix<6, 6> cmat;
+
+    for (const double value : {0.0, 1.0e-3})
+    {
+      linear_response(strain(value), stress, cmat);
+      cache.insert(strain(value), stress, cmat);
+    }
+    EXPECT_EQ(cache.num_samples(), 2);
+    EXPECT_EQ(cache.statistics().validations, 1);
+    EXPECT_NEAR(cache.statistics().max_validated_error, 0.0, 1.0e-12);
+
+    Core::LinAlg::Matrix<6, 1> glstrain;
+    for (int i = 0; i < 6; ++i) glstrain(i) = 0.1 * (i + 1);
+
+    Core::LinAlg::Matrix<6, 1> ref_stress;
+    Core::LinAlg::Matrix<6, 6> ref_cmat;
+    linear_response(glstrain, ref_stress, ref_cmat);
+    EXPECT_TRUE(cache.lookup(glstrain, stress, cmat));
+    FOUR_C_EXPECT_NEAR(stress, ref_stress, 1.0e-10);
+    FOUR_C_EXPECT_NEAR(cmat, ref_cmat, 1.0e-12);
+  }
+
+  TEST_F(MicroMaterialResponseCacheTest, NonlinearResponseRespectsTolerance)
+  {
+    const double tolerance = 1.0e-3;
+    Mat::MicroMaterialResponseCache cache(tolerance, 100);
+    Core::LinAlg::Matrix<6, 1> stress;
+    Core::LinAlg::Matrix<6, 6> cmat;
+
+    for (const double value : {0.0, 1.0e-2, 2.0e-2})
+    {
+      stiffening_response(strain(value), stress, cmat);
+      cache.insert(strain(value), stress, cmat);
+    }
+
+    // far away from all samples the response is computed
+    EXPECT_FALSE(cache.lookup(strain(5.0e-2), stress, cmat));
+
+    // close to a sample the extrapolation is accurate
+    Core::LinAlg::Matrix<6, 1> glstrain = strain(2.0e-2);
+    glstrain(0) += 1.0e-5;
+    ASSERT_TRUE(cache.lookup(glstrain, stress, cmat));
+
+    Core::LinAlg::Matrix<6, 1> ref_stress;
+    Core::LinAlg::Matrix<6, 6> ref_cmat;
+    stiffening_response(glstrain, ref_stress, ref_cmat);
+    Core::LinAlg::Matrix<6, 1> error(stress);
+    error.update(-1.0, ref_stress, 1.0);
+    EXPECT_LE(error.norm2(), tolerance * ref_stress.norm2());
+    EXPECT_LE(cache.statistics().max_estimated_error, tolerance);
+  }
+
+  TEST_F(MicroMaterialResponseCacheTest, NearestSampleIsUsed)
+  {
+    Mat::MicroMaterialResponseCache cache(1.0e-3, 3);
+    Core::LinAlg::Matrix<6, 1> stress;
+    Core::LinAlg::Matrix<6, 6> cmat;
+
+    // a piecewise constant response is only reproduced by the nearest sample
+    for (const double value : {-1.0, 1.0, 0.5, -0.5})
+    {
+      stress = strain(value);
+      cmat.clear();
+      cache.insert(strain(value), stress, cmat);
+    }
+    EXPECT_EQ(cache.num_samples(), 3);
+
+    for (const double value : {-1.0, 1.0, 0.5})
+    {
+      ASSERT_TRUE(cache.lookup(strain(value), stress, cmat));
+      FOUR_C_EXPECT_NEAR(stress, strain(value), 1.0e-14);
+    }
+
+    // the sample at -0.5 exceeded the capacity
+    EXPECT_FALSE(cache.lookup(strain(-0.5), stress, cmat));
+  }
+}  // namespace
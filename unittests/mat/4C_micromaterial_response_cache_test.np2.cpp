@@ -0,0 +1,52 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_micromaterial_response_cache.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <sstream>
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(MicroMaterialResponseCacheParallel, StatisticsAreSummedOverProcessors)
+  {
+    const MPI_Comm comm = MPI_COMM_WORLD;
+    const int myrank = Core::Communication::my_mpi_rank(comm);
+
+    // one lookup on the first and two lookups on the second processor, all misses
+    Mat::MicroMaterialResponseCache cache(1.0e-3, 100);
+    Core::LinAlg::Matrix<6, 1> glstrain(true);
+    Core::LinAlg::Matrix<6, 1> stress;
+    Core::LinAlg::Matrix<6, 6> cmat;
+    for (int i = 0; i <= myrank; ++i) EXPECT_FALSE(cache.lookup(glstrain, stress, cmat));
+
+    std::ostringstream output;
+    cache.print_statistics(output, comm);
+
+    if (myrank == 0)
+    {
+      EXPECT_NE(output.str().find("(2 processors): 3 lookups, 0 hits"), std::string::npos);
+      EXPECT_NE(output.str().find("0 samples"), std::string::npos);
+    }
+    else
+      EXPECT_TRUE(output.str().empty());
+  }
+
+  TEST(MicroMaterialResponseCacheParallel, NothingPrintedWithoutLookups)
+  {
+    Mat::MicroMaterialResponseCache cache(1.0e-3, 100);
+
+    std::ostringstream output;
+    cache.print_statistics(output, MPI_COMM_WORLD);
+    EXPECT_TRUE(output.str().empty());
+  }
+}  // namespace
@@ -0,0 +1,152 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_pair_loop.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+  using namespace FourC;
+
+  struct TestPair
+  {
+    PARTICLEENGINE::LocalIndexTuple tuple_i_;
+    PARTICLEENGINE::LocalIndexTuple tuple_j_;
+    int id_;
+  };
+
+  class ParticlePairLoopTest : public ::testing::Test
+  {
+   public:
+    static void SetUpTestSuite() { Kokkos::initialize(); }
+
+    static void TearDownTestSuite() { Kokkos::finalize(); }
+
+   protected:
+    void SetUp() override
+    {
+      // all pairs of owned particles of a chain of particles within distance 3 and one pair with a
+      // ghosted particle of the same local index
+      int id = 0;
+      for (int i = 0; i < numparticles_; ++i)
+        for (int j = i + 1; j < std::min(i + 4, numparticles_); ++j)
+          pairs_.push_back({tuple(i), tuple(j), id++});
+      pairs_.push_back({tuple(0), tuple(1, PARTICLEENGINE::Ghosted), id++});
+    }
+
+    static PARTICLEENGINE::LocalIndexTuple tuple(
+        int particle, PARTICLEENGINE::StatusEnum status = PARTICLEENGINE::Owned)
+    {
+      return {PARTICLEENGINE::Phase1, status, particle};
+    }
+
+    //! index of a particle in the vectors below
+    static int index(const PARTICLEENGINE::LocalIndexTuple& tuple)
+    {
+      const bool owned = std::get<1>(tuple) == PARTICLEENGINE::Owned;
+      return std::get<2>(tuple) + (owned ? 0 : numparticles_);
+    }
+
+    //! ids of the pairs contributing to each particle in the order of evaluation
+    std::vector<std::vector<int>> evaluate(
+        ParticleInteraction::ParticlePairLoop& loop, const std::vector<int>* pairindices) const
+    {
+      std::vector<std::vector<int>> contributions(2 * numparticles_);
+      const auto add_contributions = [&](const TestPair& pair)
+      {
+        contributions[index(pair.tuple_i_)].push_back(pair.id_);
+        contributions[index(pair.tuple_j_)].push_back(pair.id_);
+      };
+
+      if (pairindices)
+        loop.for_each(pairs_, *pairindices, add_contributions);
+      else
+        loop.for_each(pairs_, add_contributions);
+
+      return contributions;
+    }
+
+    static constexpr int numparticles_ = 50;
+    std::vector<TestPair> pairs_;
+  };
+
+  TEST_F(ParticlePairLoopTest, SerialLoopKeepsOrder)
+  {
+    ParticleInteraction::ParticlePairLoop loop(false);
+
+    std::vector<int> order;
+    loop.for_each(pairs_, [&](const TestPair& pair) { order.push_back(pair.id_); });
+
+    ASSERT_EQ(order.size(), pairs_.size());
+    for (std::size_t k = 0; k < order.size(); ++k) EXPECT_EQ(order[k], pairs_[k].id_);
+  }
+
+  TEST_F(ParticlePairLoopTest, ParallelLoopEvaluatesEachPairOnce)
+  {
+    ParticleInteraction::ParticlePairLoop serial(false);
+    ParticleInteraction::ParticlePairLoop parallel(true);
+
+    std::vector<std::vector<int>> reference = evaluate(serial, nullptr);
+    std::vector<std::vector<int>> result = evaluate(parallel, nullptr);
+
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+      std::sort(reference[i].begin(), reference[i].end());
+      std::sort(result[i].begin(), result[i].end());
+      EXPECT_EQ(result[i], reference[i]);
+    }
+  }
+
+  TEST_F(ParticlePairLoopTest, ParallelLoopIsDeterministic)
+  {
+    ParticleInteraction::ParticlePairLoop parallel(true);
+    const std::vector<std::vector<int>> first = evaluate(parallel, nullptr);
+
+    // a new loop computes the same coloring, i.e., the same order of contributions
+    ParticleInteraction::ParticlePairLoop other(true);
+    EXPECT_EQ(evaluate(parallel, nullptr), first);
+    EXPECT_EQ(evaluate(other, nullptr), first);
+
+    parallel.reset();
+    EXPECT_EQ(evaluate(parallel, nullptr), first);
+  }
+
+  TEST_F(ParticlePairLoopTest, ParallelLoopOverSubsetOfPairs)
+  {
+    std::vector<int> pairindices;
+    for (int k = static_cast<int>(pairs_.size()) - 1; k >= 0; k -= 2) pairindices.push_back(k);
+
+    ParticleInteraction::ParticlePairLoop serial(false);
+    ParticleInteraction::ParticlePairLoop parallel(true);
+
+    std::vector<std::vector<int>> reference = evaluate(serial, &pairindices);
+    std::vector<std::vector<int>> result = evaluate(parallel, &pairindices);
+
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+      std::sort(reference[i].begin(), reference[i].end());
+      std::sort(result[i].begin(), result[i].end());
+      EXPECT_EQ(result[i], reference[i]);
+    }
+  }
+
+  TEST_F(ParticlePairLoopTest, ParallelLoopRethrowsExceptions)
+  {
+    ParticleInteraction::ParticlePairLoop parallel(true);
+
+    EXPECT_THROW(parallel.for_each(pairs_,
+                     [&](const TestPair& pair)
+                     {
+                       if (pair.id_ == 7) throw std::runtime_error("pair 7");
+                     }),
+        std::runtime_error);
+  }
+}  // namespace